@@ -0,0 +1,162 @@
+/*
+ * SPDX-FileCopyrightText: (C) 2016-2022 Matthias Fehring <https://www.huessenbergnetz.de>
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#include "abstractitemscomponent_p.h"
+#include "../logging_p.h"
+#include "../error.h"
+#include <QJsonObject>
+#include <QJsonValue>
+
+using namespace Fuoten;
+
+AbstractItemsComponentPrivate::AbstractItemsComponentPrivate() :
+    ComponentPrivate()
+{
+
+}
+
+
+AbstractItemsComponentPrivate::~AbstractItemsComponentPrivate()
+{
+
+}
+
+
+AbstractItemsComponent::AbstractItemsComponent(AbstractItemsComponentPrivate &dd, QObject *parent) :
+    Component(dd, parent)
+{
+}
+
+
+AbstractItemsComponent::~AbstractItemsComponent()
+{
+
+}
+
+
+void AbstractItemsComponent::prepareItemsStream()
+{
+    Q_D(AbstractItemsComponent);
+    const bool stream = ((d->streamBatchSize > 0) && isUseStorageEnabled() && storage());
+    setStreamReply(stream);
+    if (stream) {
+        d->streamReader.reset(d->streamBatchSize);
+    }
+}
+
+
+void AbstractItemsComponent::finishItems()
+{
+    Q_D(AbstractItemsComponent);
+
+    if (d->streamReply) {
+        flushItemsStream(true);
+    } else {
+        if (isUseStorageEnabled() && storage()) {
+            storage()->itemsRequested(jsonResult());
+        }
+        Q_EMIT itemsReceived(jsonResult().object().value(QStringLiteral("items")).toArray());
+    }
+}
+
+
+void AbstractItemsComponent::flushItemsStream(bool lastBatch)
+{
+    Q_D(AbstractItemsComponent);
+
+    const QList<QJsonArray> batches = d->streamReader.takeBatches(lastBatch);
+    for (int i = 0; i < batches.size(); ++i) {
+        const QJsonArray &batch = batches.at(i);
+        storage()->itemsBatchRequested(batch, lastBatch && (i == batches.size() - 1));
+        Q_EMIT itemsReceived(batch);
+    }
+}
+
+
+bool AbstractItemsComponent::checkOutput()
+{
+    Q_D(AbstractItemsComponent);
+
+    if (d->streamReply) {
+
+        if (Q_UNLIKELY(!d->streamReader.atEnd())) {
+            if (d->streamReader.isFlushPending()) {
+                flushItemsStream(true);
+            }
+            //% "The data the server replied does not contain an \"items\" array."
+            setError(new Error(Error::OutputError, Error::Critical, qtTrId("libfuoten-err-no-items-array-in-reply"), QString(), this));
+            Q_EMIT failed(error());
+            return false;
+        }
+
+    } else if (Q_LIKELY(Component::checkOutput())) {
+
+        if (Q_UNLIKELY(!jsonResult().object().value(QStringLiteral("items")).isArray())) {
+            //% "The data the server replied does not contain an \"items\" array."
+            setError(new Error(Error::OutputError, Error::Critical, qtTrId("libfuoten-err-no-items-array-in-reply"), QString(), this));
+            Q_EMIT failed(error());
+            return false;
+        }
+
+    } else {
+        setInOperation(false);
+        return false;
+    }
+
+    return true;
+}
+
+
+bool AbstractItemsComponent::processReplyData(const QByteArray &data)
+{
+    Q_D(AbstractItemsComponent);
+
+    if (Q_UNLIKELY(!d->streamReader.addData(data))) {
+        if (d->streamReader.isFlushPending()) {
+            flushItemsStream(true);
+        }
+        //% "Failed to read the items from the data the server replied."
+        setError(new Error(Error::OutputError, Error::Critical, qtTrId("libfuoten-err-failed-read-items-stream"), d->streamReader.errorString(), this));
+        Q_EMIT failed(error());
+        return false;
+    }
+
+    flushItemsStream(false);
+
+    return true;
+}
+
+
+void AbstractItemsComponent::extractError(QNetworkReply *reply)
+{
+    Q_D(AbstractItemsComponent);
+
+    // already stored batches of an interrupted stream have to be finished
+    if (d->streamReply && d->streamReader.isFlushPending()) {
+        flushItemsStream(true);
+    }
+
+    Component::extractError(reply);
+}
+
+
+int AbstractItemsComponent::streamBatchSize() const { Q_D(const AbstractItemsComponent); return d->streamBatchSize; }
+
+void AbstractItemsComponent::setStreamBatchSize(int nStreamBatchSize)
+{
+    if (Q_UNLIKELY(inOperation())) {
+        qCWarning(FUOTEN_NETWORK, "Can not change property %s, still in operation.", "streamBatchSize");
+        return;
+    }
+
+    Q_D(AbstractItemsComponent);
+    if (nStreamBatchSize != d->streamBatchSize) {
+        d->streamBatchSize = nStreamBatchSize;
+        qCDebug(FUOTEN_NETWORK, "Changed streamBatchSize to %i.", d->streamBatchSize);
+        Q_EMIT streamBatchSizeChanged(streamBatchSize());
+    }
+}
+
+#include "moc_abstractitemscomponent.cpp"
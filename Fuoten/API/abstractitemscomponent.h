@@ -0,0 +1,136 @@
+/*
+ * SPDX-FileCopyrightText: (C) 2016-2022 Matthias Fehring <https://www.huessenbergnetz.de>
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#ifndef FUOTENABSTRACTITEMSCOMPONENT_H
+#define FUOTENABSTRACTITEMSCOMPONENT_H
+
+#include <QObject>
+#include <QJsonArray>
+#include "component.h"
+#include "fuoten_export.h"
+
+namespace Fuoten {
+
+class AbstractItemsComponentPrivate;
+
+/*!
+ * \brief Base class for API requests that return an \c "items" array.
+ *
+ * Implements the handling of the \c "items" array that is shared by GetItems and GetUpdatedItems.
+ * The items can either be handed to the storage after the complete reply has been received or
+ * they can be read incrementally and handed to the storage in batches while the reply is still
+ * received, see \link AbstractItemsComponent::streamBatchSize streamBatchSize \endlink.
+ *
+ * Independent of the mode, the itemsReceived() signal can be used to get the received items.
+ *
+ * \since 0.9.0
+ * \headerfile "" <Fuoten/API/AbstractItemsComponent>
+ */
+class FUOTEN_EXPORT AbstractItemsComponent : public Component
+{
+    Q_OBJECT
+    /*!
+     * \brief Number of items that will be handed to the storage at once while the reply is received.
+     *
+     * If this is greater than \c 0 and Component::isUseStorageEnabled() returns \c true, the \c "items" array of
+     * the reply will be read incrementally while the data is received from the network. Every time the set number
+     * of items has been read, they will be given to AbstractStorage::itemsBatchRequested(). So memory usage is
+     * bounded by the batch size instead of the reply size. The Component::succeeded() signal will contain an empty
+     * JSON document in this mode, use itemsReceived() to get the items.
+     *
+     * Defaults to \c 0, what disables streaming. This property can not be changed while Component::inOperation() returns \c true.
+     *
+     * \par Access functions:
+     * <TABLE><TR><TD>int</TD><TD>streamBatchSize() const</TD></TR><TR><TD>void</TD><TD>setStreamBatchSize(int nStreamBatchSize)</TD></TR></TABLE>
+     * \par Notifier signal:
+     * <TABLE><TR><TD>void</TD><TD>streamBatchSizeChanged(int streamBatchSize)</TD></TR></TABLE>
+     */
+    Q_PROPERTY(int streamBatchSize READ streamBatchSize WRITE setStreamBatchSize NOTIFY streamBatchSizeChanged)
+public:
+    /*!
+     * \brief Destroys the %AbstractItemsComponent object.
+     */
+    ~AbstractItemsComponent() override;
+
+    /*!
+     * \brief Getter function for the \link AbstractItemsComponent::streamBatchSize streamBatchSize \endlink property.
+     * \sa AbstractItemsComponent::setStreamBatchSize(), AbstractItemsComponent::streamBatchSizeChanged()
+     */
+    int streamBatchSize() const;
+
+    /*!
+     * \brief Setter function for the \link AbstractItemsComponent::streamBatchSize streamBatchSize \endlink property.
+     * Emits the streamBatchSizeChanged() signal if \a nStreamBatchSize is not equal to the stored value.
+     * \sa AbstractItemsComponent::streamBatchSize(), AbstractItemsComponent::streamBatchSizeChanged()
+     */
+    void setStreamBatchSize(int nStreamBatchSize);
+
+Q_SIGNALS:
+    /*!
+     * \brief This is emitted if the value of the \link AbstractItemsComponent::streamBatchSize streamBatchSize \endlink property changes.
+     * \sa AbstractItemsComponent::streamBatchSize(), AbstractItemsComponent::setStreamBatchSize()
+     */
+    void streamBatchSizeChanged(int streamBatchSize);
+
+    /*!
+     * \brief This is emitted for the \a items that have been received from the server.
+     *
+     * If the reply is streamed, this will be emitted for every batch of items that has been handed to
+     * AbstractStorage::itemsBatchRequested(). Otherwise it will be emitted once with the complete \c "items"
+     * array. In both cases the last emission happens before Component::succeeded() will be emitted.
+     */
+    void itemsReceived(const QJsonArray &items);
+
+protected:
+    AbstractItemsComponent(AbstractItemsComponentPrivate &dd, QObject *parent = nullptr);
+
+    /*!
+     * \brief Enables or disables streaming of the reply according to the current properties.
+     *
+     * Call this in the reimplementation of Component::execute() before calling Component::sendRequest().
+     */
+    void prepareItemsStream();
+
+    /*!
+     * \brief Hands the received items to the storage.
+     *
+     * If Component::storage points to a valid object, it will use AbstractStorage::itemsRequested() or,
+     * if the reply has been streamed, AbstractStorage::itemsBatchRequested() for the remaining items to store,
+     * update and delete the items in the local storage according to the server reply. Call this in the
+     * reimplementation of Component::successCallback() before emitting Component::succeeded().
+     */
+    void finishItems();
+
+    /*!
+     * \brief Checks for an \a items array in the JSON API reply.
+     *
+     * Will at first perform the checks from Component::checkOutput() and will than check if the \a items array is present.
+     * Will \b not check if the array is empty. If the reply has been streamed, it checks if the \a items array
+     * has been read completely.
+     */
+    bool checkOutput() override;
+
+    /*!
+     * \brief Reads the streamed reply data and hands complete batches of items to the storage.
+     *
+     * Only used if \link AbstractItemsComponent::streamBatchSize streamBatchSize \endlink is greater than \c 0.
+     */
+    bool processReplyData(const QByteArray &data) override;
+
+    /*!
+     * \brief Finishes already received item batches before extracting the error.
+     */
+    void extractError(QNetworkReply *reply) override;
+
+private:
+    void flushItemsStream(bool lastBatch);
+
+    Q_DISABLE_COPY(AbstractItemsComponent)
+    Q_DECLARE_PRIVATE(AbstractItemsComponent)
+};
+
+}
+
+#endif // FUOTENABSTRACTITEMSCOMPONENT_H
@@ -0,0 +1,27 @@
+/*
+ * SPDX-FileCopyrightText: (C) 2016-2022 Matthias Fehring <https://www.huessenbergnetz.de>
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#ifndef FUOTENABSTRACTITEMSCOMPONENT_P_H
+#define FUOTENABSTRACTITEMSCOMPONENT_P_H
+
+#include "abstractitemscomponent.h"
+#include "component_p.h"
+#include "itemsstreamreader_p.h"
+
+namespace Fuoten {
+
+class AbstractItemsComponentPrivate : public ComponentPrivate
+{
+public:
+    AbstractItemsComponentPrivate();
+    ~AbstractItemsComponentPrivate() override;
+
+    ItemsStreamReader streamReader;
+    int streamBatchSize = 0;
+};
+
+}
+
+#endif // FUOTENABSTRACTITEMSCOMPONENT_P_H
@@ -4,6 +4,7 @@
  */
 
 #include "component_p.h"
+#include "../logging_p.h"
 #include "../error.h"
 #include <QJsonParseError>
 #include <QUrl>
@@ -81,6 +82,16 @@ public:
         m_defaultNam = nam;
     }
 
+    ArticleActionCoalescer *actionCoalescer() const
+    {
+        return m_defaultActionCoalescer;
+    }
+
+    void setActionCoalescer(ArticleActionCoalescer *coalescer)
+    {
+        m_defaultActionCoalescer = coalescer;
+    }
+
 private:
     AbstractConfiguration *m_defaultConfig = nullptr;
     AbstractStorage *m_defaultStorage = nullptr;
@@ -88,6 +99,7 @@ private:
     AbstractNotificator *m_defaultNotificator = nullptr;
     WipeManager *m_defaultWipeManager = nullptr;
     QNetworkAccessManager *m_defaultNam = nullptr;
+    ArticleActionCoalescer *m_defaultActionCoalescer = nullptr;
 };
 Q_GLOBAL_STATIC(DefaultValues, defVals)
 
@@ -109,23 +121,23 @@ void ComponentPrivate::performNetworkOperation(const QNetworkRequest &request)
     switch(namOperation) {
     case QNetworkAccessManager::HeadOperation:
         reply = networkAccessManager->head(request);
-        qDebug("%s", "Performing HEAD network operation.");
+        qCDebug(FUOTEN_NETWORK, "%s", "Performing HEAD network operation.");
         break;
     case QNetworkAccessManager::PostOperation:
         reply = networkAccessManager->post(request, payload);
-        qDebug("%s", "Performing POST network operation.");
+        qCDebug(FUOTEN_NETWORK, "%s", "Performing POST network operation.");
         break;
     case QNetworkAccessManager::PutOperation:
         reply = networkAccessManager->put(request, payload);
-        qDebug("%s", "Performing PUT network operation.");
+        qCDebug(FUOTEN_NETWORK, "%s", "Performing PUT network operation.");
         break;
     case QNetworkAccessManager::DeleteOperation:
         reply = networkAccessManager->deleteResource(request);
-        qDebug("%s", "Performing DELETE network operation");
+        qCDebug(FUOTEN_NETWORK, "%s", "Performing DELETE network operation");
         break;
     default:
         reply = networkAccessManager->get(request);
-        qDebug("%s", "Performing GET network operation.");
+        qCDebug(FUOTEN_NETWORK, "%s", "Performing GET network operation.");
         break;
     }
 }
@@ -149,7 +161,7 @@ void ComponentPrivate::setDefaultConfiguration(AbstractConfiguration *config)
     DefaultValues *defs = defVals();
     Q_ASSERT(defs);
     QWriteLocker locker(&defs->lock);
-    qDebug("%s", "Setting default configuration.");
+    qCDebug(FUOTEN_NETWORK, "%s", "Setting default configuration.");
     defs->setConfiguration(config);
 }
 
@@ -172,7 +184,7 @@ void ComponentPrivate::setDefaultStorage(AbstractStorage *storage)
     DefaultValues *defs = defVals();
     Q_ASSERT(defs);
     QWriteLocker locker(&defs->lock);
-    qDebug("%s", "Setting default storage.");
+    qCDebug(FUOTEN_NETWORK, "%s", "Setting default storage.");
     defs->setStorage(storage);
 }
 
@@ -195,7 +207,7 @@ void ComponentPrivate::setNetworkAccessManagerFactory(AbstractNamFactory *factor
     DefaultValues *defs = defVals();
     Q_ASSERT(defs);
     QWriteLocker locker(&defs->lock);
-    qDebug("%s", "Setting network access manager factory.");
+    qCDebug(FUOTEN_NETWORK, "%s", "Setting network access manager factory.");
     defs->setNetworkAccessManagerFactory(factory);
 }
 
@@ -218,7 +230,7 @@ void ComponentPrivate::setDefaultNotificator(AbstractNotificator *notificator)
     DefaultValues *defs = defVals();
     Q_ASSERT(defs);
     QWriteLocker locker(&defs->lock);
-    qDebug("%s", "Setting default notificator.");
+    qCDebug(FUOTEN_NETWORK, "%s", "Setting default notificator.");
     defs->setNotificator(notificator);
 }
 
@@ -241,7 +253,7 @@ void ComponentPrivate::setDefaultWipeManager(WipeManager *wipeManager)
     DefaultValues *defs = defVals();
     Q_ASSERT(defs);
     QWriteLocker locker(&defs->lock);
-    qDebug("%s", "Setting default wipe manager.");
+    qCDebug(FUOTEN_NETWORK, "%s", "Setting default wipe manager.");
     defs->setWipeManager(wipeManager);
 }
 
@@ -261,11 +273,31 @@ void ComponentPrivate::setDefaultNam(QNetworkAccessManager *nam)
     DefaultValues *defs = defVals();
     Q_ASSERT(defs);
     QWriteLocker locker(&defs->lock);
-    qDebug("%s", "Setting default QNetworkAccessManager.");
+    qCDebug(FUOTEN_NETWORK, "%s", "Setting default QNetworkAccessManager.");
     defs->setDefaultNam(nam);
 }
 
 
+ArticleActionCoalescer *ComponentPrivate::defaultActionCoalescer()
+{
+    const DefaultValues *defs = defVals();
+    Q_ASSERT(defs);
+
+    QReadLocker locker(&defs->lock);
+    return defs->actionCoalescer();
+}
+
+
+void ComponentPrivate::setDefaultActionCoalescer(ArticleActionCoalescer *coalescer)
+{
+    DefaultValues *defs = defVals();
+    Q_ASSERT(defs);
+    QWriteLocker locker(&defs->lock);
+    qCDebug(FUOTEN_NETWORK, "%s", "Setting default article action coalescer.");
+    defs->setActionCoalescer(coalescer);
+}
+
+
 Component::Component(QObject *parent) :
     QObject(parent), d_ptr(new ComponentPrivate)
 {
@@ -282,7 +314,13 @@ Component::Component(ComponentPrivate &dd, QObject *parent) :
 
 Component::~Component()
 {
-
+    Q_D(Component);
+    // the reply is owned by a network access manager that might outlive this component
+    if (d->reply) {
+        disconnect(d->reply, nullptr, this, nullptr);
+        d->reply->abort();
+        d->reply->deleteLater();
+    }
 }
 
 
@@ -305,6 +343,7 @@ void Component::sendRequest()
 
     d->result.clear();
     d->jsonResult = QJsonDocument();
+    d->streamAborted = false;
 
     if (Q_UNLIKELY(!checkInput())) {
         setInOperation(false);
@@ -344,15 +383,20 @@ void Component::sendRequest()
         } else {
             d->networkAccessManager = Component::defaultNam();
             if (!d->networkAccessManager) {
-                d->networkAccessManager = new QNetworkAccessManager(this);
+                d->networkSession = NetworkSession::forConfiguration(d->configuration);
+                if (Q_LIKELY(d->networkSession)) {
+                    d->networkAccessManager = d->networkSession->networkAccessManager();
+                } else {
+                    d->networkAccessManager = new QNetworkAccessManager(this);
+                }
             }
         }
-        if (d->configuration->getIgnoreSSLErrors()) {
-            connect(d->networkAccessManager, &QNetworkAccessManager::sslErrors, this, &Component::_ignoreSSLErrors);
-        }
     }
 
     QNetworkRequest nr(url);
+    if (d->networkSession) {
+        d->networkSession->prepareRequest(nr);
+    }
 #if (QT_VERSION >= QT_VERSION_CHECK(5, 15, 0))
     if (Q_LIKELY(d->requestTimeout > 0)) {
         nr.setTransferTimeout(static_cast<int>(d->requestTimeout) * 1000);
@@ -387,18 +431,18 @@ void Component::sendRequest()
     }
 
 #ifdef QT_DEBUG
-    qDebug("Start performing network operation.");
-    qDebug("API URL: %s", qUtf8Printable(url.toString()));
+    qCDebug(FUOTEN_NETWORK, "Start performing network operation.");
+    qCDebug(FUOTEN_NETWORK, "API URL: %s", qUtf8Printable(url.toString()));
     if (!nr.rawHeaderList().empty()) {
         const QList<QByteArray> hl = nr.rawHeaderList();
         for (const QByteArray &h : hl) {
             if (h != QByteArrayLiteral("Authorization")) {
-                qDebug("%s: %s", h.constData(), nr.rawHeader(h).constData());
+                qCDebug(FUOTEN_NETWORK, "%s: %s", h.constData(), nr.rawHeader(h).constData());
             }
         }
     }
     if (!d->payload.isEmpty()) {
-        qDebug("Payload: %s", d->payload.constData());
+        qCDebug(FUOTEN_NETWORK, "Payload: %s", d->payload.constData());
     }
 #endif
 
@@ -406,13 +450,13 @@ void Component::sendRequest()
     if (Q_LIKELY(d->requestTimeout > 0)) {
         if (!d->timeoutTimer) {
             d->timeoutTimer = new QTimer(this);
-            qDebug("%s", "Created new timeout timer.");
+            qCDebug(FUOTEN_NETWORK, "%s", "Created new timeout timer.");
             d->timeoutTimer->setSingleShot(true);
             d->timeoutTimer->setTimerType(Qt::VeryCoarseTimer);
             connect(d->timeoutTimer, &QTimer::timeout, this, &Component::_requestTimedOut);
         }
         d->timeoutTimer->start(static_cast<int>(d->requestTimeout) * 1000);
-        qDebug("Started timeout timer with %hu seconds.", d->requestTimeout);
+        qCDebug(FUOTEN_NETWORK, "Started timeout timer with %hu seconds.", d->requestTimeout);
     }
 #endif
 
@@ -421,6 +465,35 @@ void Component::sendRequest()
     if (!connect(d->reply, &QNetworkReply::finished, this, &Component::_requestFinished)) {
         qFatal("Failed to connect QNetworkReply to Component::_requestFinished slot.");
     }
+    if (d->streamReply) {
+        connect(d->reply, &QNetworkReply::readyRead, this, &Component::_replyReadyRead);
+    }
+    // connected to the reply and not to the network access manager, that might be shared
+    // with other components that do not ignore SSL errors
+    if (d->configuration->getIgnoreSSLErrors()) {
+        connect(d->reply, &QNetworkReply::sslErrors, this, &Component::_ignoreSSLErrors);
+    }
+}
+
+
+void Component::_replyReadyRead()
+{
+    Q_D(Component);
+
+    if (Q_UNLIKELY(!d->reply || d->streamAborted || (d->reply->error() != QNetworkReply::NoError))) {
+        return;
+    }
+
+    // keep error replies untouched for extractError()
+    if (Q_UNLIKELY(d->reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt() >= 400)) {
+        return;
+    }
+
+    if (Q_UNLIKELY(!processReplyData(d->reply->readAll()))) {
+        qCDebug(FUOTEN_NETWORK, "%s", "Failed to process streamed reply data. Aborting network operation.");
+        d->streamAborted = true;
+        d->reply->abort();
+    }
 }
 
 
@@ -428,39 +501,48 @@ void Component::_requestFinished()
 {
     Q_D(Component);
 
-    qDebug("%s", "Finished network operation.");
+    qCDebug(FUOTEN_NETWORK, "%s", "Finished network operation.");
 #ifdef QT_DEBUG
-    qDebug("API URL: %s", qUtf8Printable(d->reply->url().toString()));
-    qDebug("Reply size: %lli", d->reply->size());
+    qCDebug(FUOTEN_NETWORK, "API URL: %s", qUtf8Printable(d->reply->url().toString()));
+    qCDebug(FUOTEN_NETWORK, "Reply size: %lli", d->reply->size());
     const QList<QByteArray> hl = d->reply->rawHeaderList();
     for (const QByteArray &h : hl) {
-        qDebug("%s: %s", h.constData(), d->reply->rawHeader(h).constData());
+        qCDebug(FUOTEN_NETWORK, "%s: %s", h.constData(), d->reply->rawHeader(h).constData());
     }
 #endif
 
 #if (QT_VERSION < QT_VERSION_CHECK(5, 15, 0))
     if (Q_LIKELY(d->timeoutTimer && d->timeoutTimer->isActive())) {
-        qDebug("Stopping timeout timer with %i seconds left.", d->timeoutTimer->remainingTime()/1000);
+        qCDebug(FUOTEN_NETWORK, "Stopping timeout timer with %i seconds left.", d->timeoutTimer->remainingTime()/1000);
         d->timeoutTimer->stop();
     }
 #endif
 
-    if (Q_LIKELY(d->reply->error() == QNetworkReply::NoError)) {
+    if (Q_UNLIKELY(d->streamAborted)) {
 
+        setInOperation(false);
 
-        qDebug("%s", "Reading network reply data.");
+    } else if (Q_LIKELY(d->reply->error() == QNetworkReply::NoError)) {
 
-        d->result = d->reply->readAll();
+        bool dataProcessed = true;
 
-        if (checkOutput()) {
-            qDebug("%s", "Calling successCallback().");
+        if (d->streamReply) {
+            qCDebug(FUOTEN_NETWORK, "%s", "Processing remaining streamed network reply data.");
+            dataProcessed = processReplyData(d->reply->readAll());
+        } else {
+            qCDebug(FUOTEN_NETWORK, "%s", "Reading network reply data.");
+            d->result = d->reply->readAll();
+        }
+
+        if (dataProcessed && checkOutput()) {
+            qCDebug(FUOTEN_NETWORK, "%s", "Calling successCallback().");
             successCallback();
         } else {
             setInOperation(false);
         }
 
     } else {
-        qDebug("%s", "Extracting error data from network reply.");
+        qCDebug(FUOTEN_NETWORK, "%s", "Extracting error data from network reply.");
         extractError(d->reply);
         setInOperation(false);
     }
@@ -506,11 +588,12 @@ void Component::_requestTimedOut()
 #endif
 
 
-void Component::_ignoreSSLErrors(QNetworkReply *reply, const QList<QSslError> &errors)
+void Component::_ignoreSSLErrors(const QList<QSslError> &errors)
 {
     Q_UNUSED(errors);
-    if (reply) {
-        reply->ignoreSslErrors();
+    Q_D(Component);
+    if (d->reply) {
+        d->reply->ignoreSslErrors();
     }
 }
 
@@ -541,6 +624,10 @@ bool Component::checkOutput()
 {
     Q_D(Component);
 
+    if (d->streamReply) {
+        return true;
+    }
+
     if (d->expectedJSONType != Empty) {
         QJsonParseError jsonError;
         d->jsonResult = QJsonDocument::fromJson(d->result, &jsonError);
@@ -583,7 +670,7 @@ void Component::setInOperation(bool nInOperation)
     Q_D(Component);
     if (nInOperation != d->inOperation) {
         d->inOperation = nInOperation;
-        qDebug("Changed inOperation to %s.", d->inOperation ? "true" : "false");
+        qCDebug(FUOTEN_NETWORK, "Changed inOperation to %s.", d->inOperation ? "true" : "false");
         Q_EMIT inOperationChanged(inOperation());
     }
 }
@@ -596,7 +683,7 @@ void Component::setRequestTimeout(quint16 seconds)
     Q_D(Component);
     if (seconds != d->requestTimeout) {
         d->requestTimeout = seconds;
-        qDebug("Changed requestTimeout to %hu seconds.", d->requestTimeout);
+        qCDebug(FUOTEN_NETWORK, "Changed requestTimeout to %hu seconds.", d->requestTimeout);
         Q_EMIT requestTimeoutChanged(requestTimeout());
     }
 }
@@ -613,7 +700,7 @@ void Component::setError(Error *nError)
         if (oldError) {
             delete oldError;
         }
-        qDebug("Changed error to %p.", d->error);
+        qCDebug(FUOTEN_NETWORK, "Changed error to %p.", d->error);
         Q_EMIT errorChanged(error());
     }
 }
@@ -634,14 +721,21 @@ AbstractConfiguration *Component::configuration() const
 void Component::setConfiguration(AbstractConfiguration *nAbstractConfiguration)
 {
     if (Q_UNLIKELY(inOperation())) {
-        qWarning("Can not change property %s, still in operation.", "configuration");
+        qCWarning(FUOTEN_NETWORK, "Can not change property %s, still in operation.", "configuration");
         return;
     }
 
     Q_D(Component);
     if (nAbstractConfiguration != d->configuration) {
         d->configuration = nAbstractConfiguration;
-        qDebug("Changed configuration to %p.", d->configuration);
+        // use the session and the network access manager of the new configuration on the next request,
+        // a manager that has been created for this component is not needed anymore
+        d->networkSession = nullptr;
+        if (d->networkAccessManager && (d->networkAccessManager->parent() == this)) {
+            d->networkAccessManager->deleteLater();
+        }
+        d->networkAccessManager = nullptr;
+        qCDebug(FUOTEN_NETWORK, "Changed configuration to %p.", d->configuration);
         Q_EMIT configurationChanged(configuration());
     }
 }
@@ -660,14 +754,14 @@ AbstractStorage *Component::storage() const
 void Component::setStorage(AbstractStorage *localStorage)
 {
     if (Q_UNLIKELY(inOperation())) {
-        qWarning("Can not change property %s, still in operation.", "storage");
+        qCWarning(FUOTEN_NETWORK, "Can not change property %s, still in operation.", "storage");
         return;
     }
 
     Q_D(Component);
     if (localStorage != d->storage) {
         d->storage = localStorage;
-        qDebug("Changed storage to %p.", d->storage);
+        qCDebug(FUOTEN_NETWORK, "Changed storage to %p.", d->storage);
         Q_EMIT storageChanged(storage());
     }
 }
@@ -680,7 +774,7 @@ void Component::setUseStorage(bool useStorage)
     Q_D(Component);
     if (useStorage != d->useStorage) {
         d->useStorage = useStorage;
-        qDebug("Changed useStorage to %s.", d->useStorage ? "true" : "false");
+        qCDebug(FUOTEN_NETWORK, "Changed useStorage to %s.", d->useStorage ? "true" : "false");
         Q_EMIT useStorageChanged(d->useStorage);
     }
 }
@@ -701,7 +795,7 @@ void Component::setNotificator(AbstractNotificator *notificator)
     Q_D(Component);
     if (notificator != d->notificator) {
         d->notificator = notificator;
-        qDebug("Changed notificator to %p.", d->notificator);
+        qCDebug(FUOTEN_NETWORK, "Changed notificator to %p.", d->notificator);
         Q_EMIT notificatorChanged(d->notificator);
     }
 }
@@ -721,7 +815,7 @@ void Component::setWipeManager(WipeManager *wipeManager)
     Q_D(Component);
     if (wipeManager != d->wipeManager) {
         d->wipeManager = wipeManager;
-        qDebug("%s", "Changed wipeManager.");
+        qCDebug(FUOTEN_NETWORK, "%s", "Changed wipeManager.");
         Q_EMIT wipeManagerChanged(d->wipeManager);
     }
 }
@@ -798,6 +892,18 @@ QNetworkAccessManager *Component::defaultNam()
 }
 
 
+void Component::setDefaultActionCoalescer(ArticleActionCoalescer *coalescer)
+{
+    ComponentPrivate::setDefaultActionCoalescer(coalescer);
+}
+
+
+ArticleActionCoalescer *Component::defaultActionCoalescer()
+{
+    return ComponentPrivate::defaultActionCoalescer();
+}
+
+
 void Component::setExpectedJSONType(ExpectedJSONType type)
 {
     Q_D(Component);
@@ -895,6 +1001,20 @@ void Component::setUrlQuery(const QUrlQuery &query)
 }
 
 
+void Component::setStreamReply(bool streamReply)
+{
+    Q_D(Component);
+    d->streamReply = streamReply;
+}
+
+
+bool Component::processReplyData(const QByteArray &data)
+{
+    Q_UNUSED(data);
+    return true;
+}
+
+
 void Component::setRequiresAuth(bool reqAuth)
 {
     Q_D(Component);
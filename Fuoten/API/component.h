@@ -26,6 +26,7 @@ class AbstractStorage;
 class AbstractNamFactory;
 class AbstractNotificator;
 class WipeManager;
+class ArticleActionCoalescer;
 
 /*!
  * \brief Base class for all API requests.
@@ -44,6 +45,12 @@ class WipeManager;
  * This will than be used to create new QNetworkAccessManager instances on the fly that will
  * be children of the Component object.
  *
+ * If neither a factory nor a default QNetworkAccessManager via setDefaultNam() has been set,
+ * all components using the same configuration share a network session that is a child of the
+ * configuration object. Its single QNetworkAccessManager reuses open connections, allows HTTP/2
+ * and resumes the last TLS session, so subsequent requests to the same server do not need new
+ * TCP and TLS handshakes.
+ *
  * When creating a subclass of Component, you have to reimplement successCallback(),
  * extractError() and checkOutput(). Optionally you should reimplement checkInput()
  * if your derived class provides own input properties that should be checked before
@@ -504,6 +511,24 @@ public:
      */
     static QNetworkAccessManager *defaultNam();
 
+    /*!
+     * \brief Sets the global default article action coalescer.
+     *
+     * If set, Article::mark() and Article::star() will hand their actions over to the
+     * \a coalescer instead of performing them directly. Set a \c nullptr to disable it again.
+     *
+     * \sa defaultActionCoalescer()
+     * \since 0.9.0
+     */
+    static void setDefaultActionCoalescer(ArticleActionCoalescer *coalescer);
+
+    /*!
+     * \brief Returns the global default article action coalescer.
+     * \sa setDefaultActionCoalescer()
+     * \since 0.9.0
+     */
+    static ArticleActionCoalescer *defaultActionCoalescer();
+
 Q_SIGNALS:
     /*!
      * \brief This signal is emitted when the in operation status changes.
@@ -769,6 +794,33 @@ protected:
      */
     virtual void extractError(QNetworkReply *reply);
 
+    /*!
+     * \brief Set this to \c true to process the reply data while it is received.
+     *
+     * If enabled, the reply data will not be collected and parsed as a whole after the request
+     * has been finished. Instead, every chunk of data will be given to processReplyData() as soon
+     * as it is available. jsonResult() will return an empty document in this case and checkOutput()
+     * will not try to parse the reply data.
+     *
+     * Default: false
+     *
+     * \since 0.9.0
+     */
+    void setStreamReply(bool streamReply);
+
+    /*!
+     * \brief Processes a chunk of reply \a data if streaming is enabled.
+     *
+     * Reimplement this in a subclass that enables setStreamReply() to incrementally process the
+     * reply data. If this returns \c false, the network operation will be aborted. In that case
+     * you should set an error and emit the failed() signal in your implementation.
+     *
+     * The default implementation does nothing and returns \c true.
+     *
+     * \since 0.9.0
+     */
+    virtual bool processReplyData(const QByteArray &data);
+
     /*!
      * \brief Set this to true if the request requires authentication.
      *
@@ -790,10 +842,11 @@ protected:
 
 private Q_SLOTS:
     void _requestFinished();
+    void _replyReadyRead();
 #if (QT_VERSION < QT_VERSION_CHECK(5, 15, 0))
     void _requestTimedOut();
 #endif
-    void _ignoreSSLErrors(QNetworkReply *reply, const QList<QSslError> &errors);
+    void _ignoreSSLErrors(const QList<QSslError> &errors);
 
 private:
     Q_DISABLE_COPY(Component)
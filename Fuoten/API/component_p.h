@@ -7,6 +7,7 @@
 #define FUOTENCOMPONENT_P_H
 
 #include "component.h"
+#include "networksession_p.h"
 #include "../Helpers/abstractconfiguration.h"
 #include "../Storage/abstractstorage.h"
 #include "../Helpers/abstractnamfactory.h"
@@ -14,6 +15,7 @@
 #include <QTimer>
 #include <QNetworkReply>
 #include <QNetworkRequest>
+#include <QPointer>
 
 namespace Fuoten {
 
@@ -31,7 +33,8 @@ public:
     QByteArray payloadContentType = QByteArrayLiteral("application/json");
     QJsonDocument jsonResult;
     QUrlQuery urlQuery;
-    QNetworkAccessManager *networkAccessManager = nullptr;
+    QPointer<QNetworkAccessManager> networkAccessManager;
+    QPointer<NetworkSession> networkSession;
     Error *error = nullptr;
     AbstractConfiguration *configuration = nullptr;
     AbstractStorage *storage = nullptr;
@@ -49,6 +52,8 @@ public:
     bool inOperation = false;
     bool useStorage = true;
     bool checkForWipe = true;
+    bool streamReply = false;
+    bool streamAborted = false;
 
     void performNetworkOperation(const QNetworkRequest &request);
     static AbstractConfiguration *defaultConfiguration();
@@ -63,6 +68,8 @@ public:
     static void setDefaultWipeManager(WipeManager *wipeManager);
     static QNetworkAccessManager *defaultNam();
     static void setDefaultNam(QNetworkAccessManager *nam);
+    static ArticleActionCoalescer *defaultActionCoalescer();
+    static void setDefaultActionCoalescer(ArticleActionCoalescer *coalescer);
 
 private:
     Q_DISABLE_COPY(ComponentPrivate)
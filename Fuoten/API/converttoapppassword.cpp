@@ -4,6 +4,7 @@
  */
 
 #include "converttoapppassword_p.h"
+#include "../logging_p.h"
 #include "../error.h"
 #include <QJsonObject>
 #include <QUrlQuery>
@@ -47,11 +48,11 @@ ConvertToAppPassword::~ConvertToAppPassword()
 void ConvertToAppPassword::execute()
 {
     if (Q_UNLIKELY(inOperation())) {
-        qWarning("%s", "Still in operation. Returning.");
+        qCWarning(FUOTEN_NETWORK, "%s", "Still in operation. Returning.");
         return;
     }
 
-    qDebug("%s", "Start request to upgrade to application password.");
+    qCDebug(FUOTEN_NETWORK, "%s", "Start request to upgrade to application password.");
 
     if (!configuration()) {
         setConfiguration(Component::defaultConfiguration());
@@ -79,7 +80,7 @@ void ConvertToAppPassword::successCallback()
         const QString appPass = ocs.value(QStringLiteral("data")).toObject().value(QStringLiteral("apppassword")).toString();
         if (Q_LIKELY(!appPass.isEmpty())) {
             configuration()->setPassword(appPass);
-            qDebug("%s", "Successfully upgraded to application password.");
+            qCDebug(FUOTEN_NETWORK, "%s", "Successfully upgraded to application password.");
             QVariantMap notificationData{
                 {QStringLiteral("username"), configuration()->getUsername()},
                 {QStringLiteral("useragent"), configuration()->getLoginFlowUserAgent()}
@@ -117,7 +118,7 @@ void ConvertToAppPassword::extractError(QNetworkReply *reply)
     if (reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt() != 403) {
         Component::extractError(reply);
     } else {
-        qDebug("%s", "Client is already authenticated with an app password. All fine.");
+        qCDebug(FUOTEN_NETWORK, "%s", "Client is already authenticated with an app password. All fine.");
         Q_EMIT succeeded(QJsonDocument());
     }
 }
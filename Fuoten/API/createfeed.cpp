@@ -4,6 +4,7 @@
  */
 
 #include "createfeed_p.h"
+#include "../logging_p.h"
 #include "../error.h"
 #include <QJsonObject>
 #include <QJsonValue>
@@ -49,11 +50,11 @@ CreateFeed::~CreateFeed()
 void CreateFeed::execute()
 {
     if (inOperation()) {
-        qWarning("Still in operation. Returning.");
+        qCWarning(FUOTEN_NETWORK, "Still in operation. Returning.");
         return;
     }
 
-    qDebug("%s", "Start to create a feed on the server.");
+    qCDebug(FUOTEN_NETWORK, "%s", "Start to create a feed on the server.");
 
     setInOperation(true);
 
@@ -140,7 +141,7 @@ void CreateFeed::successCallback()
 
     setInOperation(false);
 
-    qDebug("%s", "Successfully create the feed on the server.");
+    qCDebug(FUOTEN_NETWORK, "%s", "Successfully create the feed on the server.");
 
     Q_EMIT succeeded(jsonResult());
 }
@@ -151,14 +152,14 @@ QUrl CreateFeed::url() const { Q_D(const CreateFeed); return d->url; }
 void CreateFeed::setUrl(const QUrl &nUrl)
 {
     if (Q_UNLIKELY(inOperation())) {
-        qWarning("Can not change property %s, still in operation.", "url");
+        qCWarning(FUOTEN_NETWORK, "Can not change property %s, still in operation.", "url");
         return;
     }
 
     Q_D(CreateFeed);
     if (nUrl != d->url) {
         d->url = nUrl;
-        qDebug("Changed URL to %s.", d->url.toString().toLocal8Bit().constData());
+        qCDebug(FUOTEN_NETWORK, "Changed URL to %s.", d->url.toString().toLocal8Bit().constData());
         Q_EMIT urlChanged(url());
     }
 }
@@ -169,14 +170,14 @@ qint64 CreateFeed::folderId() const { Q_D(const CreateFeed); return d->folderId;
 void CreateFeed::setFolderId(qint64 nFolderId)
 {
     if (Q_UNLIKELY(inOperation())) {
-        qWarning("Can not change property %s, still in operation.", "folderId");
+        qCWarning(FUOTEN_NETWORK, "Can not change property %s, still in operation.", "folderId");
         return;
     }
 
     Q_D(CreateFeed);
     if (nFolderId != d->folderId) {
         d->folderId = nFolderId;
-        qDebug("Changed folderId to %lli.", d->folderId);
+        qCDebug(FUOTEN_NETWORK, "Changed folderId to %lli.", d->folderId);
         Q_EMIT folderIdChanged(folderId());
     }
 }
@@ -4,6 +4,7 @@
  */
 
 #include "createfolder_p.h"
+#include "../logging_p.h"
 #include <QJsonObject>
 #include <QJsonArray>
 #include <QJsonValue>
@@ -49,7 +50,7 @@ CreateFolder::~CreateFolder()
 void CreateFolder::execute()
 {
     if (Q_UNLIKELY(inOperation())) {
-        qWarning("Still in operation. Returning.");
+        qCWarning(FUOTEN_NETWORK, "Still in operation. Returning.");
         return;
     }
 
@@ -57,7 +58,7 @@ void CreateFolder::execute()
 
     setError(nullptr);
 
-    qDebug("Start creating folder \"%s\" on the server.", qUtf8Printable(name()));
+    qCDebug(FUOTEN_NETWORK, "Start creating folder \"%s\" on the server.", qUtf8Printable(name()));
 
     QJsonObject plo; // payload object
     plo.insert(QStringLiteral("name"), QJsonValue(name()));
@@ -133,7 +134,7 @@ void CreateFolder::successCallback()
 
     setInOperation(false);
 
-    qDebug("Successfully created the folder \"%s\" on the server.", qUtf8Printable(name()));
+    qCDebug(FUOTEN_NETWORK, "Successfully created the folder \"%s\" on the server.", qUtf8Printable(name()));
 
     Q_EMIT succeeded(jsonResult());
 }
@@ -144,14 +145,14 @@ QString CreateFolder::name() const { Q_D(const CreateFolder); return d->name; }
 void CreateFolder::setName(const QString &nName)
 {
     if (Q_UNLIKELY(inOperation())) {
-        qWarning("Can not change property %s, still in operation.", "name");
+        qCWarning(FUOTEN_NETWORK, "Can not change property %s, still in operation.", "name");
         return;
     }
 
     Q_D(CreateFolder);
     if (nName.simplified() != d->name) {
         d->name = nName.simplified();
-        qDebug("Changed name to \"%s\".", qUtf8Printable(d->name));
+        qCDebug(FUOTEN_NETWORK, "Changed name to \"%s\".", qUtf8Printable(d->name));
         Q_EMIT nameChanged(name());
     }
 }
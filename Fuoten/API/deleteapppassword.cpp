@@ -4,6 +4,7 @@
  */
 
 #include "deleteapppassword_p.h"
+#include "../logging_p.h"
 
 using namespace Fuoten;
 
@@ -37,13 +38,13 @@ DeleteAppPassword::~DeleteAppPassword() = default;
 void DeleteAppPassword::execute()
 {
     if (Q_UNLIKELY(inOperation())) {
-        qWarning("%s", "Still in operation. Returning.");
+        qCWarning(FUOTEN_NETWORK, "%s", "Still in operation. Returning.");
         return;
     }
 
     setInOperation(true);
 
-    qDebug("%s", "Start deleting app password on the remote server.");
+    qCDebug(FUOTEN_NETWORK, "%s", "Start deleting app password on the remote server.");
 
     if (!configuration()) {
         setConfiguration(Component::defaultConfiguration());
@@ -4,6 +4,7 @@
  */
 
 #include "deletefeed_p.h"
+#include "../logging_p.h"
 #include "../error.h"
 
 using namespace Fuoten;
@@ -46,14 +47,14 @@ qint64 DeleteFeed::feedId() const { Q_D(const DeleteFeed); return d->feedId; }
 void DeleteFeed::setFeedId(qint64 nFeedId)
 {
     if (Q_UNLIKELY(inOperation())) {
-        qWarning("Can not change property %s, still in operation.", "feedId");
+        qCWarning(FUOTEN_NETWORK, "Can not change property %s, still in operation.", "feedId");
         return;
     }
 
     Q_D(DeleteFeed);
     if (nFeedId != d->feedId) {
         d->feedId = nFeedId;
-        qDebug("Changed feedId to %lli.", d->feedId);
+        qCDebug(FUOTEN_NETWORK, "Changed feedId to %lli.", d->feedId);
         Q_EMIT feedIdChanged(feedId());
     }
 }
@@ -62,11 +63,11 @@ void DeleteFeed::setFeedId(qint64 nFeedId)
 void DeleteFeed::execute()
 {
     if (Q_UNLIKELY(inOperation())) {
-        qWarning("Still in operation. Returning.");
+        qCWarning(FUOTEN_NETWORK, "Still in operation. Returning.");
         return;
     }
 
-    qDebug("Start to delete feed with ID %lli.", feedId());
+    qCDebug(FUOTEN_NETWORK, "Start to delete feed with ID %lli.", feedId());
 
     setInOperation(true);
 
@@ -108,7 +109,7 @@ void DeleteFeed::successCallback()
 
     setInOperation(false);
 
-    qDebug("Successfully deleted feed with ID %lli.", feedId());
+    qCDebug(FUOTEN_NETWORK, "Successfully deleted feed with ID %lli.", feedId());
 
     Q_EMIT succeeded(feedId());
 }
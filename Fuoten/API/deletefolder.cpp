@@ -4,6 +4,7 @@
  */
 
 #include "deletefolder_p.h"
+#include "../logging_p.h"
 #include "../error.h"
 
 using namespace Fuoten;
@@ -44,11 +45,11 @@ DeleteFolder::~DeleteFolder()
 void DeleteFolder::execute()
 {
     if (Q_UNLIKELY(inOperation())) {
-        qWarning("Still in operation. Returning.");
+        qCWarning(FUOTEN_NETWORK, "Still in operation. Returning.");
         return;
     }
 
-    qDebug("Start to delete folder with ID %lli.", folderId());
+    qCDebug(FUOTEN_NETWORK, "Start to delete folder with ID %lli.", folderId());
 
     setInOperation(true);
 
@@ -90,7 +91,7 @@ void DeleteFolder::successCallback()
 
     setInOperation(false);
 
-    qDebug("Successfully deleted folder with ID %lli.", folderId());
+    qCDebug(FUOTEN_NETWORK, "Successfully deleted folder with ID %lli.", folderId());
 
     Q_EMIT succeeded(folderId());
 }
@@ -114,14 +115,14 @@ qint64 DeleteFolder::folderId() const { Q_D(const DeleteFolder); return d->folde
 void DeleteFolder::setFolderId(qint64 nFolderId)
 {
     if (Q_UNLIKELY(inOperation())) {
-        qWarning("Can not change property %s, still in operation.", "folderId");
+        qCWarning(FUOTEN_NETWORK, "Can not change property %s, still in operation.", "folderId");
         return;
     }
 
     Q_D(DeleteFolder);
     if (nFolderId != d->folderId) {
         d->folderId = nFolderId;
-        qDebug("Changed folderId to %lli.", d->folderId);
+        qCDebug(FUOTEN_NETWORK, "Changed folderId to %lli.", d->folderId);
         Q_EMIT folderIdChanged(folderId());
     }
 }
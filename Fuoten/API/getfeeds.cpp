@@ -4,6 +4,7 @@
  */
 
 #include "getfeeds_p.h"
+#include "../logging_p.h"
 #include "../error.h"
 #include <QJsonObject>
 #include <QJsonValue>
@@ -48,11 +49,11 @@ GetFeeds::~GetFeeds()
 void GetFeeds::execute()
 {
     if (Q_UNLIKELY(inOperation())) {
-        qWarning("Still in operation. Returning.");
+        qCWarning(FUOTEN_NETWORK, "Still in operation. Returning.");
         return;
     }
 
-    qDebug("%s", "Start requesting feeds from the server.");
+    qCDebug(FUOTEN_NETWORK, "%s", "Start requesting feeds from the server.");
 
     setInOperation(true);
 
@@ -68,7 +69,7 @@ void GetFeeds::successCallback()
 
     setInOperation(false);
 
-    qDebug("Successfully requested the feed list from the server.");
+    qCDebug(FUOTEN_NETWORK, "Successfully requested the feed list from the server.");
 
     Q_EMIT succeeded(jsonResult());
 }
@@ -4,6 +4,7 @@
  */
 
 #include "getfolders_p.h"
+#include "../logging_p.h"
 #include "../error.h"
 #include <QJsonObject>
 #include <QJsonValue>
@@ -49,11 +50,11 @@ GetFolders::~GetFolders()
 void GetFolders::execute()
 {
     if (Q_UNLIKELY(inOperation())) {
-        qWarning("Still in operation. Returning.");
+        qCWarning(FUOTEN_NETWORK, "Still in operation. Returning.");
         return;
     }
 
-    qDebug("%s", "Start requesting folders from the server.");
+    qCDebug(FUOTEN_NETWORK, "%s", "Start requesting folders from the server.");
 
     setInOperation(true);
 
@@ -69,7 +70,7 @@ void GetFolders::successCallback()
 
     setInOperation(false);
 
-    qDebug("Successfully requested the folder list from the server.");
+    qCDebug(FUOTEN_NETWORK, "Successfully requested the folder list from the server.");
 
     Q_EMIT succeeded(jsonResult());
 }
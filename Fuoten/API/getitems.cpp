@@ -4,6 +4,7 @@
  */
 
 #include "getitems_p.h"
+#include "../logging_p.h"
 #include "../error.h"
 #include <QJsonObject>
 #include <QJsonValue>
@@ -13,14 +14,14 @@
 using namespace Fuoten;
 
 GetItemsPrivate::GetItemsPrivate() :
-    ComponentPrivate()
+    AbstractItemsComponentPrivate()
 {
     apiRoute = QStringLiteral("/items");
     expectedJSONType = Component::Object;
 }
 
 GetItemsPrivate::GetItemsPrivate(int nBatchSize, qint64 nOffset, FuotenEnums::Type nType, qint64 nParentId, bool nGetRead, bool nOldestFirst) :
-    ComponentPrivate(),
+    AbstractItemsComponentPrivate(),
     offset(nOffset),
     parentId(nParentId),
     batchSize(nBatchSize),
@@ -39,19 +40,19 @@ GetItemsPrivate::~GetItemsPrivate()
 
 
 GetItems::GetItems(QObject *parent) :
-    Component(* new GetItemsPrivate, parent)
+    AbstractItemsComponent(* new GetItemsPrivate, parent)
 {
 }
 
 
 GetItems::GetItems(int batchSize, qint64 offset, FuotenEnums::Type type, qint64 parentId, bool getRead, bool oldestFirst, QObject *parent) :
-    Component(* new GetItemsPrivate(batchSize, offset, type, parentId, getRead, oldestFirst), parent)
+    AbstractItemsComponent(* new GetItemsPrivate(batchSize, offset, type, parentId, getRead, oldestFirst), parent)
 {
 }
 
 
 GetItems::GetItems(GetItemsPrivate &dd, QObject *parent) :
-    Component(dd, parent)
+    AbstractItemsComponent(dd, parent)
 {
 }
 
@@ -65,11 +66,11 @@ GetItems::~GetItems()
 void GetItems::execute()
 {
     if (Q_UNLIKELY(inOperation())) {
-        qWarning("Still in operation. Returning.");
+        qCWarning(FUOTEN_NETWORK, "Still in operation. Returning.");
         return;
     }
 
-    qDebug("%s", "Start requesting items from the server.");
+    qCDebug(FUOTEN_NETWORK, "%s", "Start requesting items from the server.");
 
     setInOperation(true);
 
@@ -92,45 +93,24 @@ void GetItems::execute()
 
     setUrlQuery(uq);
 
+    prepareItemsStream();
+
     sendRequest();
 }
 
 
 void GetItems::successCallback()
 {
-    if (isUseStorageEnabled() && storage()) {
-        storage()->itemsRequested(jsonResult());
-    }
+    finishItems();
 
     setInOperation(false);
 
-    qDebug("Successfully requested the items from the server.");
+    qCDebug(FUOTEN_NETWORK, "Successfully requested the items from the server.");
 
     Q_EMIT succeeded(jsonResult());
 }
 
 
-bool GetItems::checkOutput()
-{
-    if (Q_LIKELY(Component::checkOutput())) {
-
-        if (Q_UNLIKELY(!jsonResult().object().value(QStringLiteral("items")).isArray())) {
-            //% "The data the server replied does not contain an \"items\" array."
-            setError(new Error(Error::OutputError, Error::Critical, qtTrId("libfuoten-err-no-items-array-in-reply"), QString(), this));
-            Q_EMIT failed(error());
-            return false;
-        }
-
-
-    } else {
-        setInOperation(false);
-        return false;
-    }
-
-    return true;
-}
-
-
 bool GetItems::checkInput()
 {
     if (Q_LIKELY(Component::checkInput())) {
@@ -155,14 +135,14 @@ int GetItems::batchSize() const { Q_D(const GetItems); return d->batchSize; }
 void GetItems::setBatchSize(int nBatchSize)
 {
     if (inOperation()) {
-        qWarning("Can not change property %s, still in operation.", "batchSize");
+        qCWarning(FUOTEN_NETWORK, "Can not change property %s, still in operation.", "batchSize");
         return;
     }
 
     Q_D(GetItems);
     if (nBatchSize != d->batchSize) {
         d->batchSize = nBatchSize;
-        qDebug("Changed batchSize to %i.", d->batchSize);
+        qCDebug(FUOTEN_NETWORK, "Changed batchSize to %i.", d->batchSize);
         Q_EMIT batchSizeChanged(batchSize());
     }
 }
@@ -173,14 +153,14 @@ qint64 GetItems::offset() const { Q_D(const GetItems); return d->offset; }
 void GetItems::setOffset(qint64 nOffset)
 {
     if (inOperation()) {
-        qWarning("Can not change property %s, still in operation.", "offset");
+        qCWarning(FUOTEN_NETWORK, "Can not change property %s, still in operation.", "offset");
         return;
     }
 
     Q_D(GetItems);
     if (nOffset != d->offset) {
         d->offset = nOffset;
-        qDebug("Changed offset to %lli.", d->offset);
+        qCDebug(FUOTEN_NETWORK, "Changed offset to %lli.", d->offset);
         Q_EMIT offsetChanged(offset());
     }
 }
@@ -191,14 +171,14 @@ FuotenEnums::Type GetItems::type() const { Q_D(const GetItems); return d->type;
 void GetItems::setType(FuotenEnums::Type nType)
 {
     if (inOperation()) {
-        qWarning("Can not change property %s, still in operation.", "type");
+        qCWarning(FUOTEN_NETWORK, "Can not change property %s, still in operation.", "type");
         return;
     }
 
     Q_D(GetItems);
     if (nType != d->type) {
         d->type = nType;
-        qDebug("Changed type to %s.", FuotenEnums::staticMetaObject.enumerator(FuotenEnums::staticMetaObject.indexOfEnumerator("Type")).valueToKey(d->type));
+        qCDebug(FUOTEN_NETWORK, "Changed type to %s.", FuotenEnums::staticMetaObject.enumerator(FuotenEnums::staticMetaObject.indexOfEnumerator("Type")).valueToKey(d->type));
         Q_EMIT typeChanged(type());
     }
 }
@@ -209,14 +189,14 @@ qint64 GetItems::parentId() const { Q_D(const GetItems); return d->parentId; }
 void GetItems::setParentId(qint64 nParentId)
 {
     if (inOperation()) {
-        qWarning("Can not change property %s, still in operation.", "parentId");
+        qCWarning(FUOTEN_NETWORK, "Can not change property %s, still in operation.", "parentId");
         return;
     }
 
     Q_D(GetItems);
     if (nParentId != d->parentId) {
         d->parentId = nParentId;
-        qDebug("Changed parentId to %lli.", d->parentId);
+        qCDebug(FUOTEN_NETWORK, "Changed parentId to %lli.", d->parentId);
         Q_EMIT parentIdChanged(parentId());
     }
 }
@@ -227,14 +207,14 @@ bool GetItems::getRead() const { Q_D(const GetItems); return d->getRead; }
 void GetItems::setGetRead(bool nGetRead)
 {
     if (inOperation()) {
-        qWarning("Can not change property %s, still in operation.", "getRead");
+        qCWarning(FUOTEN_NETWORK, "Can not change property %s, still in operation.", "getRead");
         return;
     }
 
     Q_D(GetItems);
     if (nGetRead != d->getRead) {
         d->getRead = nGetRead;
-        qDebug("Changed getRead to %s.", d->getRead ? "true" : "false");
+        qCDebug(FUOTEN_NETWORK, "Changed getRead to %s.", d->getRead ? "true" : "false");
         Q_EMIT getReadChanged(getRead());
     }
 }
@@ -245,14 +225,14 @@ bool GetItems::oldestFirst() const { Q_D(const GetItems); return d->oldestFirst;
 void GetItems::setOldestFirst(bool nOldestFirst)
 {
     if (inOperation()) {
-        qWarning("Can not change property %s, still in operation.", "oldestFirst");
+        qCWarning(FUOTEN_NETWORK, "Can not change property %s, still in operation.", "oldestFirst");
         return;
     }
 
     Q_D(GetItems);
     if (nOldestFirst != d->oldestFirst) {
         d->oldestFirst = nOldestFirst;
-        qDebug("Changed oldestFirst to %s.", d->oldestFirst ? "true" : "false");
+        qCDebug(FUOTEN_NETWORK, "Changed oldestFirst to %s.", d->oldestFirst ? "true" : "false");
         Q_EMIT oldestFirstChanged(oldestFirst());
     }
 }
@@ -7,7 +7,7 @@
 #define FUOTENGETITEMS_H
 
 #include <QObject>
-#include "component.h"
+#include "abstractitemscomponent.h"
 #include "../fuoten.h"
 #include "../fuoten_global.h"
 #include "fuoten_export.h"
@@ -41,7 +41,7 @@ class GetItemsPrivate;
  * \sa Synchronizer
  * \headerfile "" <Fuoten/API/GetItems>
  */
-class FUOTEN_EXPORT GetItems : public Component
+class FUOTEN_EXPORT GetItems : public AbstractItemsComponent
 {
     Q_OBJECT
     /*!
@@ -252,20 +252,12 @@ protected:
     /*!
      * \brief Finishes the the operation if the request was successful.
      *
-     * If Component::storage points to a valid object, it will use AbstractStorage::itemsRequested() to store, update and delete the
-     * items in the local storage according to the server reply. Afterwards it will set Component::inOperation to false and will emit
+     * Uses AbstractItemsComponent::finishItems() to store, update and delete the items in the local storage according to the
+     * server reply. Afterwards it will set Component::inOperation to false and will emit
      * the Component::succeeded() signal.
      */
     void successCallback() override;
 
-    /*!
-     * \brief Checks for an \a items array in the JSON API reply.
-     *
-     * Will at first perform the checks from Component::checkOutput() and will than check if the \a items array is present.
-     * Will \b not check if the array is empty.
-     */
-    bool checkOutput() override;
-
     /*!
      * \brief Checks for valid input values.
      *
@@ -7,11 +7,11 @@
 #define FUOTENGETITEMS_P_H
 
 #include "getitems.h"
-#include "component_p.h"
+#include "abstractitemscomponent_p.h"
 
 namespace Fuoten {
 
-class GetItemsPrivate : public ComponentPrivate
+class GetItemsPrivate : public AbstractItemsComponentPrivate
 {
 public:
     GetItemsPrivate();
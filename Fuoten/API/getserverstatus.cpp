@@ -4,6 +4,7 @@
  */
 
 #include "getserverstatus_p.h"
+#include "../logging_p.h"
 #include <QJsonObject>
 #include <QDebug>
 
@@ -46,15 +47,15 @@ GetServerStatus::~GetServerStatus()
 void GetServerStatus::execute()
 {
     if (Q_UNLIKELY(inOperation())) {
-        qWarning("%s", "Still in operation. Returning.");
+        qCWarning(FUOTEN_NETWORK, "%s", "Still in operation. Returning.");
         return;
     }
 
-    qDebug("%s", "Start requesting server status.");
+    qCDebug(FUOTEN_NETWORK, "%s", "Start requesting server status.");
 
     setInOperation(true);
 
-    qDebug("%s", "Clearing old status data.");
+    qCDebug(FUOTEN_NETWORK, "%s", "Clearing old status data.");
     Q_D(GetServerStatus);
     d->setIsInstalled(false);
     d->setIsInMaintenance(false);
@@ -127,7 +128,7 @@ void GetServerStatus::successCallback()
 
     setInOperation(false);
 
-    qDebug("%s", "Successfully requested the server status.");
+    qCDebug(FUOTEN_NETWORK, "%s", "Successfully requested the server status.");
 
     const QJsonObject o = jsonResult().object();
 
@@ -168,7 +169,7 @@ int GetServerStatus::compareVersion(const QVersionNumber &version) const
 void GetServerStatusPrivate::setEdition(const QString &_edition)
 {
     if (edition != _edition) {
-        qDebug("Changing edition from %s to %s", qUtf8Printable(edition), qUtf8Printable(_edition));
+        qCDebug(FUOTEN_NETWORK, "Changing edition from %s to %s", qUtf8Printable(edition), qUtf8Printable(_edition));
         edition = _edition;
         Q_Q(GetServerStatus);
         Q_EMIT q->editionChanged(edition);
@@ -178,7 +179,7 @@ void GetServerStatusPrivate::setEdition(const QString &_edition)
 void GetServerStatusPrivate::setProductname(const QString &_productname)
 {
     if (productname != _productname) {
-        qDebug("Changing productname from %s to %s", qUtf8Printable(productname), qUtf8Printable(_productname));
+        qCDebug(FUOTEN_NETWORK, "Changing productname from %s to %s", qUtf8Printable(productname), qUtf8Printable(_productname));
         productname = _productname;
         Q_Q(GetServerStatus);
         Q_EMIT q->productnameChanged(productname);
@@ -188,7 +189,7 @@ void GetServerStatusPrivate::setProductname(const QString &_productname)
 void GetServerStatusPrivate::setVersion(const QVersionNumber &_version)
 {
     if (version != _version) {
-        qDebug("Changing version from %s to %s", qUtf8Printable(version.toString()), qUtf8Printable(_version.toString()));
+        qCDebug(FUOTEN_NETWORK, "Changing version from %s to %s", qUtf8Printable(version.toString()), qUtf8Printable(_version.toString()));
         version = _version;
         Q_Q(GetServerStatus);
         Q_EMIT q->versionChanged(version);
@@ -199,7 +200,7 @@ void GetServerStatusPrivate::setVersion(const QVersionNumber &_version)
 void GetServerStatusPrivate::setSetupPossible(GetServerStatus::SetupPossible _setupPossible)
 {
     if (setupPossible != _setupPossible) {
-        qDebug() << "Changing setupPossible from" << setupPossible << "to" << _setupPossible;
+        qCDebug(FUOTEN_NETWORK) << "Changing setupPossible from" << setupPossible << "to" << _setupPossible;
         setupPossible = _setupPossible;
         Q_Q(GetServerStatus);
         Q_EMIT q->setupPossibleChanged(setupPossible);
@@ -209,7 +210,7 @@ void GetServerStatusPrivate::setSetupPossible(GetServerStatus::SetupPossible _se
 void GetServerStatusPrivate::setIsInstalled(bool _isInstalled)
 {
     if (isInstalled != _isInstalled) {
-        qDebug() << "Changing isInstalled from" << isInstalled << "to" << _isInstalled;
+        qCDebug(FUOTEN_NETWORK) << "Changing isInstalled from" << isInstalled << "to" << _isInstalled;
         isInstalled = _isInstalled;
         Q_Q(GetServerStatus);
         Q_EMIT q->isInstalledChanged(isInstalled);
@@ -219,7 +220,7 @@ void GetServerStatusPrivate::setIsInstalled(bool _isInstalled)
 void GetServerStatusPrivate::setIsInMaintenance(bool _isInMaintenance)
 {
     if (isInMaintenance != _isInMaintenance) {
-        qDebug() << "Changing isInMaintenance from" << isInMaintenance << "to" << _isInMaintenance;
+        qCDebug(FUOTEN_NETWORK) << "Changing isInMaintenance from" << isInMaintenance << "to" << _isInMaintenance;
         isInMaintenance = _isInMaintenance;
         Q_Q(GetServerStatus);
         Q_EMIT q->isInMaintenanceChanged(isInMaintenance);
@@ -229,7 +230,7 @@ void GetServerStatusPrivate::setIsInMaintenance(bool _isInMaintenance)
 void GetServerStatusPrivate::setHasExtendedSupport(bool _hasExtendedSupport)
 {
     if (hasExtendedSupport != _hasExtendedSupport) {
-        qDebug() << "Changing hasExtendedSupport from" << hasExtendedSupport << "to" << _hasExtendedSupport;
+        qCDebug(FUOTEN_NETWORK) << "Changing hasExtendedSupport from" << hasExtendedSupport << "to" << _hasExtendedSupport;
         hasExtendedSupport = _hasExtendedSupport;
         Q_Q(GetServerStatus);
         Q_EMIT q->hasExtendedSupportChanged(hasExtendedSupport);
@@ -239,7 +240,7 @@ void GetServerStatusPrivate::setHasExtendedSupport(bool _hasExtendedSupport)
 void GetServerStatusPrivate::setNeedsDbUpgrade(bool _needsDbUpgrade)
 {
     if (needsDbUpgrade != _needsDbUpgrade) {
-        qDebug() << "Changing needsDbUpgrade from" << needsDbUpgrade << "to" << _needsDbUpgrade;
+        qCDebug(FUOTEN_NETWORK) << "Changing needsDbUpgrade from" << needsDbUpgrade << "to" << _needsDbUpgrade;
         needsDbUpgrade = _needsDbUpgrade;
         Q_Q(GetServerStatus);
         Q_EMIT q->needsDbUpgradeChanged(needsDbUpgrade);
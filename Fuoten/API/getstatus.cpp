@@ -4,6 +4,7 @@
  */
 
 #include "getstatus_p.h"
+#include "../logging_p.h"
 #include "../error.h"
 #include <QJsonValue>
 
@@ -46,15 +47,15 @@ GetStatus::~GetStatus()
 void GetStatus::execute()
 {
     if (Q_UNLIKELY(inOperation())) {
-        qWarning("Still in operation. Returning.");
+        qCWarning(FUOTEN_NETWORK, "Still in operation. Returning.");
         return;
     }
 
-    qDebug("%s", "Start requesting the status from the server.");
+    qCDebug(FUOTEN_NETWORK, "%s", "Start requesting the status from the server.");
 
     setInOperation(true);
 
-    qDebug("%s", "Clearing old status data.");
+    qCDebug(FUOTEN_NETWORK, "%s", "Clearing old status data.");
     Q_D(GetStatus);
     d->setVersion(QVersionNumber());
     d->setIncorrectDbCharset(false);
@@ -90,7 +91,7 @@ void GetStatus::successCallback()
     d->setIncorrectDbCharset(w.value(QStringLiteral("incorrectDbCharset")).toBool());
     setInOperation(false);
 
-    qDebug("%s", "Successfully requested the status from the server.");
+    qCDebug(FUOTEN_NETWORK, "%s", "Successfully requested the status from the server.");
 
     Q_EMIT succeeded(jsonResult());
 }
@@ -133,7 +134,7 @@ void GetStatusPrivate::setVersion(const QString &_version)
 void GetStatusPrivate::setVersion(const QVersionNumber &_version)
 {
     if (version != _version) {
-        qDebug("Changing version from %s to %s.", qUtf8Printable(version.toString()), qUtf8Printable(_version.toString()));
+        qCDebug(FUOTEN_NETWORK, "Changing version from %s to %s.", qUtf8Printable(version.toString()), qUtf8Printable(_version.toString()));
         version = _version;
         Q_Q(GetStatus);
         Q_EMIT q->versionStringChanged(version.toString());
@@ -143,7 +144,7 @@ void GetStatusPrivate::setVersion(const QVersionNumber &_version)
 void GetStatusPrivate::setIncorrectDbCharset(bool _incorrectDbCharset)
 {
     if (incorrectDbCharset != _incorrectDbCharset) {
-        qDebug("Changing incorrectDbCharset from %s to %s.", incorrectDbCharset ? "true" : "false", _incorrectDbCharset ? "true" : "false");
+        qCDebug(FUOTEN_NETWORK, "Changing incorrectDbCharset from %s to %s.", incorrectDbCharset ? "true" : "false", _incorrectDbCharset ? "true" : "false");
         incorrectDbCharset = _incorrectDbCharset;
         Q_Q(GetStatus);
         Q_EMIT q->incorrectDbCharsetChanged(incorrectDbCharset);
@@ -153,7 +154,7 @@ void GetStatusPrivate::setIncorrectDbCharset(bool _incorrectDbCharset)
 void GetStatusPrivate::setImproperlyConfiguredCrond(bool _improperlyConfiguredCron)
 {
     if (improperlyConfiguredCron != _improperlyConfiguredCron) {
-        qDebug("Changing improperlyConfiguredCron from %s to %s.", improperlyConfiguredCron ? "true" : "false", _improperlyConfiguredCron ? "true" : "false");
+        qCDebug(FUOTEN_NETWORK, "Changing improperlyConfiguredCron from %s to %s.", improperlyConfiguredCron ? "true" : "false", _improperlyConfiguredCron ? "true" : "false");
         improperlyConfiguredCron = _improperlyConfiguredCron;
         Q_Q(GetStatus);
         Q_EMIT q->improperlyConfiguredCronChanged(improperlyConfiguredCron);
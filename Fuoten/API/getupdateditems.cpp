@@ -4,6 +4,7 @@
  */
 
 #include "getupdateditems_p.h"
+#include "../logging_p.h"
 #include "../error.h"
 #include <QJsonObject>
 #include <QJsonValue>
@@ -14,14 +15,14 @@
 using namespace Fuoten;
 
 GetUpdatedItemsPrivate::GetUpdatedItemsPrivate() :
-    ComponentPrivate()
+    AbstractItemsComponentPrivate()
 {
     apiRoute = QStringLiteral("/items/updated");
     expectedJSONType = Component::Object;
 }
 
 GetUpdatedItemsPrivate::GetUpdatedItemsPrivate(const QDateTime &nLastModified, FuotenEnums::Type nType, qint64 nParentId) :
-    ComponentPrivate(),
+    AbstractItemsComponentPrivate(),
     parentId(nParentId),
     lastModified(nLastModified),
     type(nType)
@@ -38,19 +39,19 @@ GetUpdatedItemsPrivate::~GetUpdatedItemsPrivate()
 
 
 GetUpdatedItems::GetUpdatedItems(QObject *parent) :
-    Component(* new GetUpdatedItemsPrivate, parent)
+    AbstractItemsComponent(* new GetUpdatedItemsPrivate, parent)
 {
 }
 
 
 GetUpdatedItems::GetUpdatedItems(const QDateTime &lastModified, FuotenEnums::Type type, qint64 parentId, QObject *parent) :
-    Component(* new GetUpdatedItemsPrivate(lastModified, type, parentId), parent)
+    AbstractItemsComponent(* new GetUpdatedItemsPrivate(lastModified, type, parentId), parent)
 {
 }
 
 
 GetUpdatedItems::GetUpdatedItems(GetUpdatedItemsPrivate &dd, QObject *parent) :
-    Component(dd, parent)
+    AbstractItemsComponent(dd, parent)
 {
 }
 
@@ -64,11 +65,11 @@ GetUpdatedItems::~GetUpdatedItems()
 void GetUpdatedItems::execute()
 {
     if (Q_UNLIKELY(inOperation())) {
-        qWarning("Still in operation. Returning.");
+        qCWarning(FUOTEN_NETWORK, "Still in operation. Returning.");
         return;
     }
 
-    qDebug("%s", "Start requesting updated items from the server.");
+    qCDebug(FUOTEN_NETWORK, "%s", "Start requesting updated items from the server.");
 
     setInOperation(true);
 
@@ -83,44 +84,24 @@ void GetUpdatedItems::execute()
 
     setUrlQuery(uq);
 
+    prepareItemsStream();
+
     sendRequest();
 }
 
 
 void GetUpdatedItems::successCallback()
 {
-    if (isUseStorageEnabled() && storage()) {
-        storage()->itemsRequested(jsonResult());
-    }
+    finishItems();
 
     setInOperation(false);
 
-    qDebug("%s", "Successfully requested updated items from the server.");
+    qCDebug(FUOTEN_NETWORK, "%s", "Successfully requested updated items from the server.");
 
     Q_EMIT succeeded(jsonResult());
 }
 
 
-bool GetUpdatedItems::checkOutput()
-{
-    if (Q_LIKELY(Component::checkOutput())) {
-
-        if (Q_UNLIKELY(!jsonResult().object().value(QStringLiteral("items")).isArray())) {
-            //% "The data the server replied does not contain an \"items\" array."
-            setError(new Error(Error::OutputError, Error::Critical, qtTrId("libfuoten-err-no-items-array-in-reply"), QString(), this));
-            Q_EMIT failed(error());
-            return false;
-        }
-
-
-    } else {
-        return false;
-    }
-
-    return true;
-}
-
-
 bool GetUpdatedItems::checkInput()
 {
     if (Q_LIKELY(Component::checkInput())) {
@@ -152,14 +133,14 @@ QDateTime GetUpdatedItems::lastModified() const { Q_D(const GetUpdatedItems); re
 void GetUpdatedItems::setLastModified(const QDateTime &nLastModified)
 {
     if (Q_UNLIKELY(inOperation())) {
-        qWarning("Can not change property %s, still in operation.", "lastModified");
+        qCWarning(FUOTEN_NETWORK, "Can not change property %s, still in operation.", "lastModified");
         return;
     }
 
     Q_D(GetUpdatedItems);
     if (nLastModified != d->lastModified) {
         d->lastModified = nLastModified;
-        qDebug("Changed lastModified to %s.", qUtf8Printable(d->lastModified.toString(Qt::ISODate)));
+        qCDebug(FUOTEN_NETWORK, "Changed lastModified to %s.", qUtf8Printable(d->lastModified.toString(Qt::ISODate)));
         Q_EMIT lastModifiedChanged(lastModified());
     }
 }
@@ -170,14 +151,14 @@ FuotenEnums::Type GetUpdatedItems::type() const { Q_D(const GetUpdatedItems); re
 void GetUpdatedItems::setType(FuotenEnums::Type nType)
 {
     if (Q_UNLIKELY(inOperation())) {
-        qWarning("Can not change property %s, still in operation.", "type");
+        qCWarning(FUOTEN_NETWORK, "Can not change property %s, still in operation.", "type");
         return;
     }
 
     Q_D(GetUpdatedItems);
     if (nType != d->type) {
         d->type = nType;
-        qDebug("Changed type to %s.", FuotenEnums::staticMetaObject.enumerator(FuotenEnums::staticMetaObject.indexOfEnumerator("Type")).valueToKey(d->type));
+        qCDebug(FUOTEN_NETWORK, "Changed type to %s.", FuotenEnums::staticMetaObject.enumerator(FuotenEnums::staticMetaObject.indexOfEnumerator("Type")).valueToKey(d->type));
         Q_EMIT typeChanged(type());
     }
 }
@@ -188,14 +169,14 @@ qint64 GetUpdatedItems::parentId() const { Q_D(const GetUpdatedItems); return d-
 void GetUpdatedItems::setParentId(qint64 nParentId)
 {
     if (Q_UNLIKELY(inOperation())) {
-        qWarning("Can not change property %s, still in operation.", "parentId");
+        qCWarning(FUOTEN_NETWORK, "Can not change property %s, still in operation.", "parentId");
         return;
     }
 
     Q_D(GetUpdatedItems);
     if (nParentId != d->parentId) {
         d->parentId = nParentId;
-        qDebug("Changed parentId to %lli.", d->parentId);
+        qCDebug(FUOTEN_NETWORK, "Changed parentId to %lli.", d->parentId);
         Q_EMIT parentIdChanged(parentId());
     }
 }
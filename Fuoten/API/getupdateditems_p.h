@@ -7,11 +7,11 @@
 #define FUOTENGETUPDATEDITEMS_P_H
 
 #include "getupdateditems.h"
-#include "component_p.h"
+#include "abstractitemscomponent_p.h"
 
 namespace Fuoten {
 
-class GetUpdatedItemsPrivate : public ComponentPrivate
+class GetUpdatedItemsPrivate : public AbstractItemsComponentPrivate
 {
 public:
     GetUpdatedItemsPrivate();
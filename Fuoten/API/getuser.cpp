@@ -4,6 +4,7 @@
  */
 
 #include "getuser_p.h"
+#include "../logging_p.h"
 #include "../error.h"
 #include <QJsonObject>
 #include <QJsonValue>
@@ -48,11 +49,11 @@ GetUser::~GetUser()
 void GetUser::execute()
 {
     if (Q_UNLIKELY(inOperation())) {
-        qWarning("Still in operation. Returning.");
+        qCWarning(FUOTEN_NETWORK, "Still in operation. Returning.");
         return;
     }
 
-    qDebug("%s", "Start requesting user information from the server.");
+    qCDebug(FUOTEN_NETWORK, "%s", "Start requesting user information from the server.");
 
     setInOperation(true);
 
@@ -64,7 +65,7 @@ void GetUser::successCallback()
 {
     setInOperation(false);
 
-    qDebug("%s", "Successfully requested user information from the server.");
+    qCDebug(FUOTEN_NETWORK, "%s", "Successfully requested user information from the server.");
     Q_EMIT succeeded(jsonResult());
 }
 
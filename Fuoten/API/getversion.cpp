@@ -4,6 +4,7 @@
  */
 
 #include "getversion_p.h"
+#include "../logging_p.h"
 #include "../error.h"
 #include <QJsonObject>
 #include <QJsonValue>
@@ -48,13 +49,13 @@ GetVersion::~GetVersion()
 void GetVersion::execute()
 {
     if (Q_UNLIKELY(inOperation())) {
-        qWarning("Still in operation. Returning.");
+        qCWarning(FUOTEN_NETWORK, "Still in operation. Returning.");
         return;
     }
 
     Q_D(GetVersion);
 
-    qDebug("%s", "Start requesting version information from the server.");
+    qCDebug(FUOTEN_NETWORK, "%s", "Start requesting version information from the server.");
 
     setInOperation(true);
 
@@ -83,7 +84,7 @@ void GetVersion::successCallback()
 
     setInOperation(false);
 
-    qDebug("%s", "Successfully requested version information from the server.");
+    qCDebug(FUOTEN_NETWORK, "%s", "Successfully requested version information from the server.");
 
     Q_EMIT succeeded(jsonResult());
 }
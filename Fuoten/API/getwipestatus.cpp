@@ -4,6 +4,7 @@
  */
 
 #include "getwipestatus_p.h"
+#include "../logging_p.h"
 #include "../error.h"
 #include <QJsonObject>
 
@@ -47,11 +48,11 @@ GetWipeStatus::~GetWipeStatus()
 void GetWipeStatus::execute()
 {
     if (Q_UNLIKELY(inOperation())) {
-        qWarning("%s", "Still in operation. Returning.");
+        qCWarning(FUOTEN_NETWORK, "%s", "Still in operation. Returning.");
         return;
     }
 
-    qDebug("%s", "Start checking wipe status.");
+    qCDebug(FUOTEN_NETWORK, "%s", "Start checking wipe status.");
 
     setInOperation(true);
 
@@ -83,10 +84,10 @@ void GetWipeStatus::successCallback()
     const QJsonObject o = jsonResult().object();
     const bool doWipe = o.value(QStringLiteral("wipe")).toBool();
 
-    qDebug("%s", "Successfully requested wipe success status.");
+    qCDebug(FUOTEN_NETWORK, "%s", "Successfully requested wipe success status.");
 
     if (doWipe) {
-        qInfo("%s", "Remote wipe requested.");
+        qCInfo(FUOTEN_NETWORK, "%s", "Remote wipe requested.");
         Q_EMIT wipeRequested();
     }
 
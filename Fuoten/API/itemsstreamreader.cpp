@@ -0,0 +1,206 @@
+/*
+ * SPDX-FileCopyrightText: (C) 2016-2022 Matthias Fehring <https://www.huessenbergnetz.de>
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#include "itemsstreamreader_p.h"
+#include <QJsonDocument>
+#include <QJsonParseError>
+
+using namespace Fuoten;
+
+ItemsStreamReader::ItemsStreamReader(int batchSize) :
+    m_batchSize(batchSize)
+{
+
+}
+
+
+void ItemsStreamReader::reset(int batchSize)
+{
+    m_items.clear();
+    m_buffer.clear();
+    m_lastString.clear();
+    m_currentKey.clear();
+    m_errorString.clear();
+    m_batchSize = batchSize;
+    m_count = 0;
+    m_depth = 0;
+    m_stringStart = -1;
+    m_elementStart = -1;
+    m_state = SeekingItems;
+    m_inString = false;
+    m_escape = false;
+    m_lastBatchTaken = false;
+}
+
+
+bool ItemsStreamReader::addData(const QByteArray &data)
+{
+    if (data.isEmpty() || (m_state == Finished)) {
+        return true;
+    }
+
+    int pos = m_buffer.size();
+    m_buffer.append(data);
+    const int size = m_buffer.size();
+    const char *buf = m_buffer.constData();
+
+    for (; pos < size; ++pos) {
+
+        const char c = buf[pos];
+
+        if (m_inString) {
+            if (m_escape) {
+                m_escape = false;
+            } else if (c == '\\') {
+                m_escape = true;
+            } else if (c == '"') {
+                m_inString = false;
+                if ((m_state == SeekingItems) && (m_depth == 1)) {
+                    m_lastString = m_buffer.mid(m_stringStart, pos - m_stringStart);
+                }
+                m_stringStart = -1;
+            }
+            continue;
+        }
+
+        switch (c) {
+        case '"':
+            m_inString = true;
+            m_stringStart = pos + 1;
+            break;
+        case ':':
+            if ((m_state == SeekingItems) && (m_depth == 1)) {
+                m_currentKey = m_lastString;
+            }
+            break;
+        case ',':
+            if ((m_state == SeekingItems) && (m_depth == 1)) {
+                m_currentKey.clear();
+            }
+            break;
+        case '{':
+        case '[':
+            ++m_depth;
+            if (m_state == SeekingItems) {
+                if ((c == '[') && (m_depth == 2) && (m_currentKey == QByteArrayLiteral("items"))) {
+                    m_state = InItems;
+                }
+            } else if ((m_state == InItems) && (c == '{') && (m_depth == 3)) {
+                m_elementStart = pos;
+            }
+            break;
+        case '}':
+        case ']':
+            if ((m_state == InItems) && (m_depth == 3) && (c == '}') && (m_elementStart > -1)) {
+                QJsonParseError jsonError;
+                const QJsonDocument item = QJsonDocument::fromJson(m_buffer.mid(m_elementStart, pos - m_elementStart + 1), &jsonError);
+                if (Q_UNLIKELY(jsonError.error != QJsonParseError::NoError)) {
+                    m_errorString = jsonError.errorString();
+                    return false;
+                }
+                m_items.append(item.object());
+                ++m_count;
+                m_elementStart = -1;
+            } else if ((m_state == InItems) && (m_depth == 2) && (c == ']')) {
+                m_state = Finished;
+            }
+            --m_depth;
+            if (Q_UNLIKELY(m_depth < 0)) {
+                m_errorString = QStringLiteral("unbalanced closing bracket at byte %1").arg(pos);
+                return false;
+            }
+            break;
+        default:
+            break;
+        }
+
+        if (m_state == Finished) {
+            break;
+        }
+    }
+
+    // only keep the bytes of an incomplete item object or of an incomplete top level key
+    int keepFrom = size;
+    if (m_elementStart > -1) {
+        keepFrom = m_elementStart;
+    } else if (m_inString && (m_stringStart > -1) && (m_state == SeekingItems)) {
+        keepFrom = m_stringStart;
+    }
+
+    if (m_state == Finished) {
+        m_buffer.clear();
+        m_stringStart = -1;
+        m_elementStart = -1;
+    } else if (keepFrom > 0) {
+        m_buffer.remove(0, keepFrom);
+        if (m_elementStart > -1) {
+            m_elementStart -= keepFrom;
+        }
+        if (m_stringStart > -1) {
+            m_stringStart -= keepFrom;
+        }
+    }
+
+    return true;
+}
+
+
+QJsonArray ItemsStreamReader::takeBatch()
+{
+    QJsonArray batch;
+
+    const int n = (m_batchSize > 0) ? qMin(m_batchSize, m_items.size()) : m_items.size();
+    for (int i = 0; i < n; ++i) {
+        batch.append(m_items.takeFirst());
+    }
+
+    return batch;
+}
+
+
+QList<QJsonArray> ItemsStreamReader::takeBatches(bool lastBatch)
+{
+    QList<QJsonArray> batches;
+
+    if (Q_UNLIKELY(m_lastBatchTaken)) {
+        return batches;
+    }
+
+    // keep back a complete batch if no further items follow it, it might be the last one
+    while ((m_batchSize > 0) && (m_items.size() > m_batchSize)) {
+        batches.append(takeBatch());
+    }
+
+    if (lastBatch) {
+        m_lastBatchTaken = true;
+        batches.append(takeBatch());
+    }
+
+    return batches;
+}
+
+
+bool ItemsStreamReader::isFlushPending() const
+{
+    return (m_count > 0) && !m_lastBatchTaken;
+}
+
+
+bool ItemsStreamReader::atEnd() const
+{
+    return m_state == Finished;
+}
+
+
+int ItemsStreamReader::count() const
+{
+    return m_count;
+}
+
+
+QString ItemsStreamReader::errorString() const
+{
+    return m_errorString;
+}
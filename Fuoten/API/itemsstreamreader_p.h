@@ -0,0 +1,107 @@
+/*
+ * SPDX-FileCopyrightText: (C) 2016-2022 Matthias Fehring <https://www.huessenbergnetz.de>
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#ifndef FUOTENITEMSSTREAMREADER_P_H
+#define FUOTENITEMSSTREAMREADER_P_H
+
+#include <QByteArray>
+#include <QJsonArray>
+#include <QJsonObject>
+#include <QList>
+#include <QString>
+
+namespace Fuoten {
+
+/*!
+ * \internal
+ * \brief Incremental reader for the \c "items" array of GetItems and GetUpdatedItems replies.
+ *
+ * Data is added chunk by chunk as it arrives from the network. The reader only keeps the
+ * bytes of the currently incomplete item object in memory. Every completed item object
+ * is parsed on its own and can be fetched in batches via takeBatches().
+ */
+class ItemsStreamReader
+{
+public:
+    explicit ItemsStreamReader(int batchSize = 0);
+
+    /*!
+     * \brief Resets the reader to its initial state and sets a new \a batchSize.
+     */
+    void reset(int batchSize);
+
+    /*!
+     * \brief Adds \a data to the reader and extracts all completed item objects.
+     *
+     * Returns \c false if the data could not be parsed. errorString() will than contain
+     * a description of the error.
+     */
+    bool addData(const QByteArray &data);
+
+    /*!
+     * \brief Returns up to batch size items and removes them from the reader.
+     *
+     * If the batch size is \c 0 or lower, all available items will be returned.
+     */
+    QJsonArray takeBatch();
+
+    /*!
+     * \brief Takes the available items in batches from the reader.
+     *
+     * Only complete batches will be returned, and only if further items follow them, except
+     * \a lastBatch is \c true. In that case also the remaining items will be returned as the
+     * last element of the list. So the last batch is never empty, except no item has been read
+     * at all. If the batch size is \c 0 or lower, items will only be returned if \a lastBatch is
+     * \c true.
+     */
+    QList<QJsonArray> takeBatches(bool lastBatch = false);
+
+    /*!
+     * \brief Returns \c true if takeBatches() has not been called with \a lastBatch set to \c true
+     * but items have already been read.
+     */
+    bool isFlushPending() const;
+
+    /*!
+     * \brief Returns \c true if the closing bracket of the \c "items" array has been read.
+     */
+    bool atEnd() const;
+
+    /*!
+     * \brief Returns the number of items that have been extracted so far.
+     */
+    int count() const;
+
+    /*!
+     * \brief Returns a description of the last parsing error.
+     */
+    QString errorString() const;
+
+private:
+    enum State : quint8 {
+        SeekingItems,
+        InItems,
+        Finished
+    };
+
+    QList<QJsonObject> m_items;
+    QByteArray m_buffer;
+    QByteArray m_lastString;
+    QByteArray m_currentKey;
+    QString m_errorString;
+    int m_batchSize = 0;
+    int m_count = 0;
+    int m_depth = 0;
+    int m_stringStart = -1;
+    int m_elementStart = -1;
+    State m_state = SeekingItems;
+    bool m_inString = false;
+    bool m_escape = false;
+    bool m_lastBatchTaken = false;
+};
+
+}
+
+#endif // FUOTENITEMSSTREAMREADER_P_H
@@ -4,6 +4,7 @@
  */
 
 #include "loginflowv2_p.h"
+#include "../logging_p.h"
 #include "../error.h"
 #include <QJsonObject>
 
@@ -46,11 +47,11 @@ LoginFlowV2::~LoginFlowV2()
 void LoginFlowV2::execute()
 {
     if (Q_UNLIKELY(inOperation())) {
-        qWarning("%s", "Still in operation. Returning.");
+        qCWarning(FUOTEN_NETWORK, "%s", "Still in operation. Returning.");
         return;
     }
 
-    qDebug("%s", "Start requesting Login Flow v2 token and endpoint.");
+    qCDebug(FUOTEN_NETWORK, "%s", "Start requesting Login Flow v2 token and endpoint.");
 
     if (!configuration()) {
         setConfiguration(Component::defaultConfiguration());
@@ -74,7 +75,7 @@ void LoginFlowV2::successCallback()
     const QJsonObject o = jsonResult().object();
     const QUrl login = QUrl(o.value(QStringLiteral("login")).toString());
     if (!login.isValid()) {
-        qCritical("Invalid login flow v2 login url: %s", qUtf8Printable(o.value(QStringLiteral("login")).toString()));
+        qCCritical(FUOTEN_NETWORK, "Invalid login flow v2 login url: %s", qUtf8Printable(o.value(QStringLiteral("login")).toString()));
         //% "The login URL returned by the Nextcloud API is invalid."
         setError(new Error(Error::OutputError, Error::Critical, qtTrId("libfuoten-err-loginflowv2-invalid-login-url"), o.value(QStringLiteral("login")).toString(), this));
         setInOperation(false);
@@ -87,7 +88,7 @@ void LoginFlowV2::successCallback()
     const QJsonObject pollObject = o.value(QStringLiteral("poll")).toObject();
     const QString pollingToken = pollObject.value(QStringLiteral("token")).toString();
     if (pollingToken.isEmpty()) {
-        qCritical("%s", "Empty login flow v2 polling token.");
+        qCCritical(FUOTEN_NETWORK, "%s", "Empty login flow v2 polling token.");
         //% "The Nextcloud API returned an empty polling token."
         setError(new Error(Error::OutputError, Error::Critical, qtTrId("liburoten-err-loginflowv2-empty-token"), QString(), this));
         setInOperation(false);
@@ -96,7 +97,7 @@ void LoginFlowV2::successCallback()
     }
     const QUrl pollingEndpoint = QUrl(pollObject.value(QStringLiteral("endpoint")).toString());
     if (!pollingEndpoint.isValid()) {
-        qCritical("Invalid login flow v2 polling endpoint: %s", qUtf8Printable(pollObject.value(QStringLiteral("endpoint")).toString()));
+        qCCritical(FUOTEN_NETWORK, "Invalid login flow v2 polling endpoint: %s", qUtf8Printable(pollObject.value(QStringLiteral("endpoint")).toString()));
         //% "The Nextcloud API returned an invalid polling URL."
         setError(new Error(Error::OutputError, Error::Critical, qtTrId("libfuoten-err-loginflowv2-invalid-polling-url"), pollObject.value(QStringLiteral("endpoint")).toString(), this));
         setInOperation(false);
@@ -106,8 +107,8 @@ void LoginFlowV2::successCallback()
 
     Q_EMIT gotLoginUrl(login);
 
-    qDebug("Got valid login flow v2 data. Login URL: %s, Polling URL: %s, Polling Token: %s", qUtf8Printable(login.toString()), qUtf8Printable(pollingEndpoint.toString()), qUtf8Printable(pollingToken));
-    qDebug("%s", "Staring polling.");
+    qCDebug(FUOTEN_NETWORK, "Got valid login flow v2 data. Login URL: %s, Polling URL: %s, Polling Token: %s", qUtf8Printable(login.toString()), qUtf8Printable(pollingEndpoint.toString()), qUtf8Printable(pollingToken));
+    qCDebug(FUOTEN_NETWORK, "%s", "Staring polling.");
 
     d->startPolling(pollingEndpoint, pollingToken);
 }
@@ -132,7 +133,7 @@ void LoginFlowV2::setPollingInterval(int pollingInterval)
 {
     Q_D(LoginFlowV2);
     if (d->pollingInterval != pollingInterval) {
-        qDebug("Changing pollingInterval from %i to %i seconds.", d->pollingInterval, pollingInterval);
+        qCDebug(FUOTEN_NETWORK, "Changing pollingInterval from %i to %i seconds.", d->pollingInterval, pollingInterval);
         d->pollingInterval = pollingInterval;
         Q_EMIT pollingIntervalChanged(d->pollingInterval);
     }
@@ -149,12 +150,12 @@ void LoginFlowV2::setPollingTimeout(int pollingTimeout)
     Q_D(LoginFlowV2);
 
     if (d->inOperation) {
-        qWarning("Can not change property %s, still in operation.", "pollingTimeout");
+        qCWarning(FUOTEN_NETWORK, "Can not change property %s, still in operation.", "pollingTimeout");
         return;
     }
 
     if (d->pollingTimeout != pollingTimeout) {
-        qDebug("Changing pollingTimeout from %i to %i seconds.", d->pollingTimeout, pollingTimeout);
+        qCDebug(FUOTEN_NETWORK, "Changing pollingTimeout from %i to %i seconds.", d->pollingTimeout, pollingTimeout);
         d->pollingTimeout = pollingTimeout;
         Q_EMIT pollingTimeoutChanged(d->pollingTimeout);
     }
@@ -171,7 +172,7 @@ void LoginFlowV2::setPollingRequestTimeout(int pollingRequestTimeout)
     Q_D(LoginFlowV2);
 
     if (d->pollingRequestTimeout != pollingRequestTimeout) {
-        qDebug("Changing pollingRequestTimeout from %i to %i seconds.", d->pollingRequestTimeout, pollingRequestTimeout);
+        qCDebug(FUOTEN_NETWORK, "Changing pollingRequestTimeout from %i to %i seconds.", d->pollingRequestTimeout, pollingRequestTimeout);
         d->pollingRequestTimeout = pollingRequestTimeout;
         Q_EMIT pollingRequestTimeoutChanged(d->pollingRequestTimeout);
     }
@@ -218,7 +219,7 @@ void LoginFlowV2Private::sendPollingRequest()
         return;
     }
 
-    qDebug("%s", "Sending polling request.");
+    qCDebug(FUOTEN_NETWORK, "%s", "Sending polling request.");
 
     Q_Q(LoginFlowV2);
 
@@ -232,13 +233,17 @@ void LoginFlowV2Private::sendPollingRequest()
 
     pollingReply = networkAccessManager->post(pollingRequest, pollingData);
     QObject::connect(pollingReply, &QNetworkReply::finished, q, [this](){ pollingRequestFinished(); });
+    if (configuration->getIgnoreSSLErrors()) {
+        QNetworkReply *reply = pollingReply;
+        QObject::connect(pollingReply, &QNetworkReply::sslErrors, q, [reply](){ reply->ignoreSslErrors(); });
+    }
 }
 
 void LoginFlowV2Private::pollingRequestFinished()
 {
-    qDebug("%s", "Polling request finished.");
+    qCDebug(FUOTEN_NETWORK, "%s", "Polling request finished.");
 
-    qDebug("Stopping polling request timeout timer with %i seconds left.", pollingRequestTimeoutTimer->remainingTime()/1000);
+    qCDebug(FUOTEN_NETWORK, "Stopping polling request timeout timer with %i seconds left.", pollingRequestTimeoutTimer->remainingTime()/1000);
     pollingRequestTimeoutTimer->stop();
 
     timeoutsInARow = 0;
@@ -252,12 +257,12 @@ void LoginFlowV2Private::pollingRequestFinished()
 
     if (httpStatusCode == 404) {
 
-        qDebug("Authentication information not yet available. Trying again in %i seconds.", pollingInterval);
+        qCDebug(FUOTEN_NETWORK, "Authentication information not yet available. Trying again in %i seconds.", pollingInterval);
         QTimer::singleShot(pollingInterval * 1000, q, [this](){ sendPollingRequest(); });
 
     } else if (httpStatusCode == 200) {
 
-        qDebug("%s", "Authentication information available.");
+        qCDebug(FUOTEN_NETWORK, "%s", "Authentication information available.");
         overallTimeoutTimer->stop();
         secondsLeftTimer->stop();
         const QByteArray data = pr->readAll();
@@ -285,7 +290,7 @@ void LoginFlowV2Private::pollingRequestFinished()
 
     } else {
 
-        qDebug("%s", "Extracting error data from network reply.");
+        qCDebug(FUOTEN_NETWORK, "%s", "Extracting error data from network reply.");
         overallTimeoutTimer->stop();
         if (secondsLeftTimer) {
             secondsLeftTimer->stop();
@@ -311,7 +316,7 @@ void LoginFlowV2Private::pollingRequestTimedOut()
         q->setInOperation(false);
         Q_EMIT q->failed(q->error());
     } else {
-        qDebug("Polling request timed out after %i seconds. Trying again.", pollingRequestTimeout);
+        qCDebug(FUOTEN_NETWORK, "Polling request timed out after %i seconds. Trying again.", pollingRequestTimeout);
         sendPollingRequest();
     }
 }
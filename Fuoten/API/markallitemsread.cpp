@@ -4,6 +4,7 @@
  */
 
 #include "markallitemsread_p.h"
+#include "../logging_p.h"
 #include <QJsonObject>
 #include "../error.h"
 
@@ -58,11 +59,11 @@ MarkAllItemsRead::~MarkAllItemsRead()
 void MarkAllItemsRead::execute()
 {
     if (Q_UNLIKELY(inOperation())) {
-        qWarning("Still in operation. Returning.");
+        qCWarning(FUOTEN_NETWORK, "Still in operation. Returning.");
         return;
     }
 
-    qDebug("%s", "Start to mark all items on the server as read.");
+    qCDebug(FUOTEN_NETWORK, "%s", "Start to mark all items on the server as read.");
 
     setInOperation(true);
 
@@ -104,7 +105,7 @@ void MarkAllItemsRead::successCallback()
 
     setInOperation(false);
 
-    qDebug("%s", "Successfully marked all items as read on the server.");
+    qCDebug(FUOTEN_NETWORK, "%s", "Successfully marked all items as read on the server.");
 
     Q_EMIT succeeded(newestItemId());
 }
@@ -115,14 +116,14 @@ qint64 MarkAllItemsRead::newestItemId() const { Q_D(const MarkAllItemsRead); ret
 void MarkAllItemsRead::setNewestItemId(qint64 nNewestItemId)
 {
     if (Q_UNLIKELY(inOperation())) {
-        qWarning("Can not change property %s, still in operation.", "newestItemId");
+        qCWarning(FUOTEN_NETWORK, "Can not change property %s, still in operation.", "newestItemId");
         return;
     }
 
     Q_D(MarkAllItemsRead);
     if (nNewestItemId != d->newestItemId) {
         d->newestItemId = nNewestItemId;
-        qDebug("Changed newestItemId to %lli.", d->newestItemId);
+        qCDebug(FUOTEN_NETWORK, "Changed newestItemId to %lli.", d->newestItemId);
         Q_EMIT newestItemIdChanged(newestItemId());
     }
 }
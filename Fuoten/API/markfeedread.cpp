@@ -4,6 +4,7 @@
  */
 
 #include "markfeedread_p.h"
+#include "../logging_p.h"
 #include <QJsonObject>
 #include "../error.h"
 
@@ -46,11 +47,11 @@ MarkFeedRead::~MarkFeedRead()
 void MarkFeedRead::execute()
 {
     if (Q_UNLIKELY(inOperation())) {
-        qWarning("Still in operation. Returning.");
+        qCWarning(FUOTEN_NETWORK, "Still in operation. Returning.");
         return;
     }
 
-    qDebug("Start to mark all items in feed with ID %lli as read on server. Newest item ID: %lli.", feedId(), newestItemId());
+    qCDebug(FUOTEN_NETWORK, "Start to mark all items in feed with ID %lli as read on server. Newest item ID: %lli.", feedId(), newestItemId());
 
     setInOperation(true);
 
@@ -104,7 +105,7 @@ void MarkFeedRead::successCallback()
 
     setInOperation(false);
 
-    qDebug("Successfully marked the feed with ID %lli as read on the server. Newest itme ID: %lli.", feedId(), newestItemId());
+    qCDebug(FUOTEN_NETWORK, "Successfully marked the feed with ID %lli as read on the server. Newest itme ID: %lli.", feedId(), newestItemId());
 
     Q_EMIT succeeded(feedId(), newestItemId());
 }
@@ -129,14 +130,14 @@ qint64 MarkFeedRead::feedId() const { Q_D(const MarkFeedRead); return d->feedId;
 void MarkFeedRead::setFeedId(qint64 nFeedId)
 {
     if (Q_UNLIKELY(inOperation())) {
-        qWarning("Can not change property %s, still in operation.", "feedId");
+        qCWarning(FUOTEN_NETWORK, "Can not change property %s, still in operation.", "feedId");
         return;
     }
 
     Q_D(MarkFeedRead);
     if (nFeedId != d->feedId) {
         d->feedId = nFeedId;
-        qDebug("Changed feedId to %lli.", d->feedId);
+        qCDebug(FUOTEN_NETWORK, "Changed feedId to %lli.", d->feedId);
         Q_EMIT feedIdChanged(feedId());
     }
 }
@@ -147,14 +148,14 @@ qint64 MarkFeedRead::newestItemId() const { Q_D(const MarkFeedRead); return d->n
 void MarkFeedRead::setNewestItemId(qint64 nNewestItemId)
 {
     if (Q_UNLIKELY(inOperation())) {
-        qWarning("Can not change property %s, still in operation.", "newestItemId");
+        qCWarning(FUOTEN_NETWORK, "Can not change property %s, still in operation.", "newestItemId");
         return;
     }
 
     Q_D(MarkFeedRead);
     if (nNewestItemId != d->newestItemId) {
         d->newestItemId = nNewestItemId;
-        qDebug("Changed newestItemId to %lli.", d->newestItemId);
+        qCDebug(FUOTEN_NETWORK, "Changed newestItemId to %lli.", d->newestItemId);
         Q_EMIT newestItemIdChanged(newestItemId());
     }
 }
@@ -4,6 +4,7 @@
  */
 
 #include "markfolderread_p.h"
+#include "../logging_p.h"
 #include "../error.h"
 #include <QJsonObject>
 #include <QJsonValue>
@@ -47,11 +48,11 @@ MarkFolderRead::~MarkFolderRead()
 void MarkFolderRead::execute()
 {
     if (Q_UNLIKELY(inOperation())) {
-        qWarning("Still in operation. Returning.");
+        qCWarning(FUOTEN_NETWORK, "Still in operation. Returning.");
         return;
     }
 
-    qDebug("Start to mark all items in folder with ID %lli as read on the server. Newest item ID: %lli.", folderId(), newestItemId());
+    qCDebug(FUOTEN_NETWORK, "Start to mark all items in folder with ID %lli as read on the server. Newest item ID: %lli.", folderId(), newestItemId());
 
     setInOperation(true);
 
@@ -106,7 +107,7 @@ void MarkFolderRead::successCallback()
 
     setInOperation(false);
 
-    qDebug("Successfully marked the folder with ID %lli as read on the server. Newest item ID: %lli.", folderId(), newestItemId());
+    qCDebug(FUOTEN_NETWORK, "Successfully marked the folder with ID %lli as read on the server. Newest item ID: %lli.", folderId(), newestItemId());
 
     Q_EMIT succeeded(folderId(), newestItemId());
 }
@@ -131,14 +132,14 @@ qint64 MarkFolderRead::folderId() const { Q_D(const MarkFolderRead); return d->f
 void MarkFolderRead::setFolderId(qint64 nFolderId)
 {
     if (Q_UNLIKELY(inOperation())) {
-        qWarning("Can not change property %s, still in operation.", "folderId");
+        qCWarning(FUOTEN_NETWORK, "Can not change property %s, still in operation.", "folderId");
         return;
     }
 
     Q_D(MarkFolderRead);
     if (nFolderId != d->folderId) {
         d->folderId = nFolderId;
-        qDebug("Changed folderId to %lli.", d->folderId);
+        qCDebug(FUOTEN_NETWORK, "Changed folderId to %lli.", d->folderId);
         Q_EMIT folderIdChanged(folderId());
     }
 }
@@ -149,14 +150,14 @@ qint64 MarkFolderRead::newestItemId() const { Q_D(const MarkFolderRead); return
 void MarkFolderRead::setNewestItemId(qint64 nNewestItemId)
 {
     if (Q_UNLIKELY(inOperation())) {
-        qWarning("Can not change property %s, still in operation.", "newestItemId");
+        qCWarning(FUOTEN_NETWORK, "Can not change property %s, still in operation.", "newestItemId");
         return;
     }
 
     Q_D(MarkFolderRead);
     if (nNewestItemId != d->newestItemId) {
         d->newestItemId = nNewestItemId;
-        qDebug("Changed newestItemId to %lli.", d->newestItemId);
+        qCDebug(FUOTEN_NETWORK, "Changed newestItemId to %lli.", d->newestItemId);
         Q_EMIT newestItemIdChanged(newestItemId());
     }
 }
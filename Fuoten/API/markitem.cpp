@@ -4,6 +4,7 @@
  */
 
 #include "markitem_p.h"
+#include "../logging_p.h"
 #include "../error.h"
 
 using namespace Fuoten;
@@ -58,11 +59,11 @@ MarkItem::~MarkItem()
 void MarkItem::execute()
 {
     if (Q_UNLIKELY(inOperation())) {
-        qWarning("Still in operation. Returning.");
+        qCWarning(FUOTEN_NETWORK, "Still in operation. Returning.");
         return;
     }
 
-    qDebug("Start to mark item with ID %lli as %s on the server.", itemId(), unread() ? "unread" : "read");
+    qCDebug(FUOTEN_NETWORK, "Start to mark item with ID %lli as %s on the server.", itemId(), unread() ? "unread" : "read");
 
     setInOperation(true);
 
@@ -111,7 +112,7 @@ void MarkItem::successCallback()
 
     setInOperation(false);
 
-    qDebug("Successfully marked the item with ID %lli as %s on the server.", itemId(), unread() ? "unread" : "read");
+    qCDebug(FUOTEN_NETWORK, "Successfully marked the item with ID %lli as %s on the server.", itemId(), unread() ? "unread" : "read");
 
     Q_EMIT succeeded(itemId(), unread());
 }
@@ -136,14 +137,14 @@ qint64 MarkItem::itemId() const { Q_D(const MarkItem); return d->itemId; }
 void MarkItem::setItemId(qint64 nItemId)
 {
     if (Q_UNLIKELY(inOperation())) {
-        qWarning("Can not change property %s, still in operation.", "itemId");
+        qCWarning(FUOTEN_NETWORK, "Can not change property %s, still in operation.", "itemId");
         return;
     }
 
     Q_D(MarkItem);
     if (nItemId != d->itemId) {
         d->itemId = nItemId;
-        qDebug("Changed itemId to %lli.", d->itemId);
+        qCDebug(FUOTEN_NETWORK, "Changed itemId to %lli.", d->itemId);
         Q_EMIT itemIdChanged(itemId());
     }
 }
@@ -154,14 +155,14 @@ bool MarkItem::unread() const { Q_D(const MarkItem); return d->unread; }
 void MarkItem::setUnread(bool nUnread)
 {
     if (Q_UNLIKELY(inOperation())) {
-        qWarning("Can not change property %s, still in operation.", "unread");
+        qCWarning(FUOTEN_NETWORK, "Can not change property %s, still in operation.", "unread");
         return;
     }
 
     Q_D(MarkItem);
     if (nUnread != d->unread) {
         d->unread = nUnread;
-        qDebug("Changed unread to %s.", d->unread ? "true" : "false");
+        qCDebug(FUOTEN_NETWORK, "Changed unread to %s.", d->unread ? "true" : "false");
         Q_EMIT unreadChanged(unread());
     }
 }
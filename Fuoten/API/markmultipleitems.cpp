@@ -4,6 +4,7 @@
  */
 
 #include "markmultipleitems_p.h"
+#include "../logging_p.h"
 #include <QJsonArray>
 #include <QJsonObject>
 #include <QJsonValue>
@@ -60,11 +61,11 @@ MarkMultipleItems::~MarkMultipleItems()
 void MarkMultipleItems::execute()
 {
     if (Q_UNLIKELY(inOperation())) {
-        qWarning("Still in operation. Returning.");
+        qCWarning(FUOTEN_NETWORK, "Still in operation. Returning.");
         return;
     }
 
-    qDebug("Start to mark mutltiple items as %s on the server.", unread() ? "unread" : "read");
+    qCDebug(FUOTEN_NETWORK, "Start to mark mutltiple items as %s on the server.", unread() ? "unread" : "read");
 
     setInOperation(true);
 
@@ -120,7 +121,7 @@ void MarkMultipleItems::successCallback()
 
     setInOperation(false);
 
-    qDebug("Successfully marked multiple items as %s on the server.", unread() ? "unread" : "read");
+    qCDebug(FUOTEN_NETWORK, "Successfully marked multiple items as %s on the server.", unread() ? "unread" : "read");
 
     Q_EMIT succeeded(itemIds(), unread());
 }
@@ -131,14 +132,14 @@ IdList MarkMultipleItems::itemIds() const { Q_D(const MarkMultipleItems); return
 void MarkMultipleItems::setItemIds(const IdList &nItemIds)
 {
     if (Q_UNLIKELY(inOperation())) {
-        qWarning("Can not change property %s, still in operation.", "itemIds");
+        qCWarning(FUOTEN_NETWORK, "Can not change property %s, still in operation.", "itemIds");
         return;
     }
 
     Q_D(MarkMultipleItems);
     if (nItemIds != d->itemIds) {
         d->itemIds = nItemIds;
-        qDebug("Changed itemIds.");
+        qCDebug(FUOTEN_NETWORK, "Changed itemIds.");
         Q_EMIT itemIdsChanged(itemIds());
     }
 }
@@ -149,14 +150,14 @@ bool MarkMultipleItems::unread() const { Q_D(const MarkMultipleItems); return d-
 void MarkMultipleItems::setUnread(bool nUnread)
 {
     if (Q_UNLIKELY(inOperation())) {
-        qWarning("Can not change property %s, still in operation.", "unread");
+        qCWarning(FUOTEN_NETWORK, "Can not change property %s, still in operation.", "unread");
         return;
     }
 
     Q_D(MarkMultipleItems);
     if (nUnread != d->unread) {
         d->unread = nUnread;
-        qDebug("Changed unread to %s.", d->unread ? "true" : "false");
+        qCDebug(FUOTEN_NETWORK, "Changed unread to %s.", d->unread ? "true" : "false");
         Q_EMIT unreadChanged(unread());
     }
 }
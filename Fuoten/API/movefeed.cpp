@@ -4,6 +4,7 @@
  */
 
 #include "movefeed_p.h"
+#include "../logging_p.h"
 #include <QJsonObject>
 #include <QJsonValue>
 #include "../error.h"
@@ -47,11 +48,11 @@ MoveFeed::~MoveFeed()
 void MoveFeed::execute()
 {
     if (Q_UNLIKELY(inOperation())) {
-        qWarning("Still in operation. Returning.");
+        qCWarning(FUOTEN_NETWORK, "Still in operation. Returning.");
         return;
     }
 
-    qDebug("Start to move feed with ID %lli to folder with ID %lli.", feedId(), folderId());
+    qCDebug(FUOTEN_NETWORK, "Start to move feed with ID %lli to folder with ID %lli.", feedId(), folderId());
 
     setInOperation(true);
 
@@ -119,7 +120,7 @@ void MoveFeed::successCallback()
 
     setInOperation(false);
 
-    qDebug("Successfully moved feed with ID %lli to folder with ID %lli.", feedId(), folderId());
+    qCDebug(FUOTEN_NETWORK, "Successfully moved feed with ID %lli to folder with ID %lli.", feedId(), folderId());
 
     Q_EMIT succeeded(feedId(), folderId());
 }
@@ -130,14 +131,14 @@ qint64 MoveFeed::feedId() const { Q_D(const MoveFeed); return d->feedId; }
 void MoveFeed::setFeedId(qint64 nFeedId)
 {
     if (Q_UNLIKELY(inOperation())) {
-        qWarning("Can not change property %s, still in operation.", "feedId");
+        qCWarning(FUOTEN_NETWORK, "Can not change property %s, still in operation.", "feedId");
         return;
     }
 
     Q_D(MoveFeed);
     if (nFeedId != d->feedId) {
         d->feedId = nFeedId;
-        qDebug("Changed feedId to %lli.", d->feedId);
+        qCDebug(FUOTEN_NETWORK, "Changed feedId to %lli.", d->feedId);
         Q_EMIT feedIdChanged(feedId());
     }
 }
@@ -148,14 +149,14 @@ qint64 MoveFeed::folderId() const { Q_D(const MoveFeed); return d->folderId; }
 void MoveFeed::setFolderId(qint64 nFolderId)
 {
     if (Q_UNLIKELY(inOperation())) {
-        qWarning("Can not change property %s, still in operation.", "folderId");
+        qCWarning(FUOTEN_NETWORK, "Can not change property %s, still in operation.", "folderId");
         return;
     }
 
     Q_D(MoveFeed);
     if (nFolderId != d->folderId) {
         d->folderId = nFolderId;
-        qDebug("Changed folderId to %lli.", d->folderId);
+        qCDebug(FUOTEN_NETWORK, "Changed folderId to %lli.", d->folderId);
         Q_EMIT folderIdChanged(folderId());
     }
 }
@@ -0,0 +1,93 @@
+/*
+ * SPDX-FileCopyrightText: (C) 2016-2022 Matthias Fehring <https://www.huessenbergnetz.de>
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#include "networksession_p.h"
+#include "../logging_p.h"
+#include "../Helpers/abstractconfiguration.h"
+#include <QNetworkAccessManager>
+#include <QNetworkRequest>
+#include <QNetworkReply>
+#include <QThread>
+#ifndef QT_NO_SSL
+#include <QSslConfiguration>
+#endif
+
+using namespace Fuoten;
+
+NetworkSession::NetworkSession(AbstractConfiguration *config) :
+    QObject(config), m_nam(new QNetworkAccessManager(this))
+{
+    connect(m_nam, &QNetworkAccessManager::finished, this, &NetworkSession::replyFinished);
+}
+
+NetworkSession::~NetworkSession()
+{
+
+}
+
+NetworkSession *NetworkSession::forConfiguration(AbstractConfiguration *config)
+{
+    Q_ASSERT_X(config, "get network session", "invalid configuration");
+
+    if (Q_UNLIKELY(config->thread() != QThread::currentThread())) {
+        return nullptr;
+    }
+
+    NetworkSession *session = config->findChild<NetworkSession*>(QString(), Qt::FindDirectChildrenOnly);
+    if (!session) {
+        session = new NetworkSession(config);
+        qCDebug(FUOTEN_NETWORK, "Created new network session for configuration %p.", config);
+    }
+
+    return session;
+}
+
+QNetworkAccessManager *NetworkSession::networkAccessManager() const
+{
+    return m_nam;
+}
+
+void NetworkSession::prepareRequest(QNetworkRequest &request) const
+{
+#if (QT_VERSION >= QT_VERSION_CHECK(5, 15, 0))
+    request.setAttribute(QNetworkRequest::Http2AllowedAttribute, true);
+#elif (QT_VERSION >= QT_VERSION_CHECK(5, 8, 0))
+    request.setAttribute(QNetworkRequest::HTTP2AllowedAttribute, true);
+#endif
+
+#if (QT_VERSION >= QT_VERSION_CHECK(6, 3, 0))
+    // keep idle connections open long enough for the actions sent while reading
+    request.setAttribute(QNetworkRequest::ConnectionCacheExpiryTimeoutSecondsAttribute, 300);
+#endif
+
+#ifndef QT_NO_SSL
+    if (request.url().scheme() == QLatin1String("https")) {
+        QSslConfiguration conf = request.sslConfiguration();
+        conf.setSslOption(QSsl::SslOptionDisableSessionPersistence, false);
+        if (!m_sessionTicket.isEmpty() && request.url().host() == m_sessionHost) {
+            conf.setSessionTicket(m_sessionTicket);
+        }
+        request.setSslConfiguration(conf);
+    }
+#endif
+}
+
+void NetworkSession::replyFinished(QNetworkReply *reply)
+{
+#ifndef QT_NO_SSL
+    if (reply->url().scheme() != QLatin1String("https")) {
+        return;
+    }
+
+    const QByteArray ticket = reply->sslConfiguration().sessionTicket();
+    if (!ticket.isEmpty() && ticket != m_sessionTicket) {
+        m_sessionTicket = ticket;
+        m_sessionHost = reply->url().host();
+        qCDebug(FUOTEN_NETWORK, "Stored TLS session ticket of %s for resumption.", qUtf8Printable(m_sessionHost));
+    }
+#else
+    Q_UNUSED(reply)
+#endif
+}
@@ -0,0 +1,60 @@
+/*
+ * SPDX-FileCopyrightText: (C) 2016-2022 Matthias Fehring <https://www.huessenbergnetz.de>
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#ifndef FUOTENNETWORKSESSION_P_H
+#define FUOTENNETWORKSESSION_P_H
+
+#include <QObject>
+#include <QByteArray>
+#include <QString>
+
+class QNetworkAccessManager;
+class QNetworkRequest;
+class QNetworkReply;
+
+namespace Fuoten {
+
+class AbstractConfiguration;
+
+/*
+ * Network session that is shared by all components using the same configuration
+ * if neither a NAM factory nor a default NAM has been set.
+ *
+ * All requests go through the same QNetworkAccessManager and reuse its open
+ * connections, requests allow HTTP/2 and the TLS session of the last reply is
+ * offered again when a new connection has to be opened. The session is a child
+ * of the configuration and is destroyed together with it.
+ */
+class NetworkSession : public QObject
+{
+    Q_OBJECT
+public:
+    ~NetworkSession() override;
+
+    /*
+     * Returns the session of config and creates it on first use. Returns a nullptr
+     * if config lives in another thread, as the session can not be its child then.
+     */
+    static NetworkSession *forConfiguration(AbstractConfiguration *config);
+
+    QNetworkAccessManager *networkAccessManager() const;
+
+    void prepareRequest(QNetworkRequest &request) const;
+
+private:
+    explicit NetworkSession(AbstractConfiguration *config);
+
+    void replyFinished(QNetworkReply *reply);
+
+    QNetworkAccessManager *m_nam = nullptr;
+    QByteArray m_sessionTicket;
+    QString m_sessionHost;
+
+    Q_DISABLE_COPY(NetworkSession)
+};
+
+}
+
+#endif // FUOTENNETWORKSESSION_P_H
@@ -4,6 +4,7 @@
  */
 
 #include "postwipesuccess_p.h"
+#include "../logging_p.h"
 #include "../error.h"
 
 using namespace Fuoten;
@@ -46,11 +47,11 @@ PostWipeSuccess::~PostWipeSuccess()
 void PostWipeSuccess::execute()
 {
     if (Q_UNLIKELY(inOperation())) {
-        qWarning("%s", "Still in operation. Returning.");
+        qCWarning(FUOTEN_NETWORK, "%s", "Still in operation. Returning.");
         return;
     }
 
-    qDebug("%s", "Start sending wipe success message.");
+    qCDebug(FUOTEN_NETWORK, "%s", "Start sending wipe success message.");
 
     setInOperation(true);
 
@@ -76,7 +77,7 @@ bool PostWipeSuccess::checkInput()
 
 void PostWipeSuccess::successCallback()
 {
-    qDebug("%s", "Successfully send wipe success message.");
+    qCDebug(FUOTEN_NETWORK, "%s", "Successfully send wipe success message.");
     setInOperation(false);
     Q_EMIT succeeded(QJsonDocument());
 }
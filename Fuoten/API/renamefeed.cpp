@@ -4,6 +4,7 @@
  */
 
 #include "renamefeed_p.h"
+#include "../logging_p.h"
 #include "../error.h"
 #include <QJsonObject>
 
@@ -47,7 +48,7 @@ void RenameFeed::setFeedId(qint64 nFeedId)
     Q_D(RenameFeed);
     if (nFeedId != d->feedId) {
         d->feedId = nFeedId;
-        qDebug("Changed feedId to %lli.", d->feedId);
+        qCDebug(FUOTEN_NETWORK, "Changed feedId to %lli.", d->feedId);
         Q_EMIT feedIdChanged(feedId());
     }
 }
@@ -60,7 +61,7 @@ void RenameFeed::setNewName(const QString &nNewName)
     Q_D(RenameFeed);
     if (nNewName != d->newName) {
         d->newName = nNewName;
-        qDebug("Changed newName to \"%s\".", qUtf8Printable(d->newName));
+        qCDebug(FUOTEN_NETWORK, "Changed newName to \"%s\".", qUtf8Printable(d->newName));
         Q_EMIT newNameChanged(newName());
     }
 }
@@ -69,7 +70,7 @@ void RenameFeed::setNewName(const QString &nNewName)
 void RenameFeed::execute()
 {
     if (Q_UNLIKELY(inOperation())) {
-        qWarning("Still in operation. Returning.");
+        qCWarning(FUOTEN_NETWORK, "Still in operation. Returning.");
         return;
     }
 
@@ -77,7 +78,7 @@ void RenameFeed::execute()
 
     setError(nullptr);
 
-    qDebug("Start renaming feed with ID %lli to \"%s\".", feedId(), qUtf8Printable(newName()));
+    qCDebug(FUOTEN_NETWORK, "Start renaming feed with ID %lli to \"%s\".", feedId(), qUtf8Printable(newName()));
 
     QStringList rl(QStringLiteral("feeds"));
     rl.append(QString::number(feedId()));
@@ -128,7 +129,7 @@ void RenameFeed::successCallback()
 
     setInOperation(false);
 
-    qDebug("Successfully renamed feed with ID %lli to \"%s\".", feedId(), qUtf8Printable(newName()));
+    qCDebug(FUOTEN_NETWORK, "Successfully renamed feed with ID %lli to \"%s\".", feedId(), qUtf8Printable(newName()));
 
     Q_EMIT succeeded(feedId(), newName());
 }
@@ -4,6 +4,7 @@
  */
 
 #include "renamefolder_p.h"
+#include "../logging_p.h"
 #include <QJsonObject>
 #include <QJsonValue>
 #include "../error.h"
@@ -45,7 +46,7 @@ RenameFolder::~RenameFolder()
 void RenameFolder::execute()
 {
     if (Q_UNLIKELY(inOperation())) {
-        qWarning("Still in operation. Returning.");
+        qCWarning(FUOTEN_NETWORK, "Still in operation. Returning.");
         return;
     }
 
@@ -53,7 +54,7 @@ void RenameFolder::execute()
 
     setError(nullptr);
 
-    qDebug("Start to rename folder with ID %lli to \"%s\".", folderId(), qUtf8Printable(newName()));
+    qCDebug(FUOTEN_NETWORK, "Start to rename folder with ID %lli to \"%s\".", folderId(), qUtf8Printable(newName()));
 
     QStringList rl(QStringLiteral("folders"));
     rl.append(QString::number(folderId()));
@@ -103,7 +104,7 @@ void RenameFolder::successCallback()
 
     setInOperation(false);
 
-    qDebug("Successfully renamed folder with ID %lli to \"%s\".", folderId(), qUtf8Printable(newName()));
+    qCDebug(FUOTEN_NETWORK, "Successfully renamed folder with ID %lli to \"%s\".", folderId(), qUtf8Printable(newName()));
 
     Q_EMIT succeeded(folderId(), newName());
 }
@@ -136,14 +137,14 @@ qint64 RenameFolder::folderId() const { Q_D(const RenameFolder); return d->folde
 void RenameFolder::setFolderId(qint64 nFolderId)
 {
     if (Q_UNLIKELY(inOperation())) {
-        qWarning("Can not change property %s, still in operation.", "folderId");
+        qCWarning(FUOTEN_NETWORK, "Can not change property %s, still in operation.", "folderId");
         return;
     }
 
     Q_D(RenameFolder);
     if (nFolderId != d->folderId) {
         d->folderId = nFolderId;
-        qDebug("Changed folderId to %lli.", d->folderId);
+        qCDebug(FUOTEN_NETWORK, "Changed folderId to %lli.", d->folderId);
         Q_EMIT folderIdChanged(folderId());
     }
 }
@@ -154,14 +155,14 @@ QString RenameFolder::newName() const { Q_D(const RenameFolder); return d->newNa
 void RenameFolder::setNewName(const QString &nNewName)
 {
     if (Q_UNLIKELY(inOperation())) {
-        qWarning("Can not change property %s, still in operation.", "newName");
+        qCWarning(FUOTEN_NETWORK, "Can not change property %s, still in operation.", "newName");
         return;
     }
 
     Q_D(RenameFolder);
     if (nNewName.simplified() != d->newName) {
         d->newName = nNewName.simplified();
-        qDebug("Changed newName to \"%s\".", qUtf8Printable(d->newName));
+        qCDebug(FUOTEN_NETWORK, "Changed newName to \"%s\".", qUtf8Printable(d->newName));
         Q_EMIT newNameChanged(newName());
     }
 }
@@ -4,6 +4,7 @@
  */
 
 #include "staritem_p.h"
+#include "../logging_p.h"
 #include "../error.h"
 
 using namespace Fuoten;
@@ -61,11 +62,11 @@ StarItem::~StarItem()
 void StarItem::execute()
 {
     if (Q_UNLIKELY(inOperation())) {
-        qWarning("Still in operation. Returning.");
+        qCWarning(FUOTEN_NETWORK, "Still in operation. Returning.");
         return;
     }
 
-    qDebug("Start to %s the item with GUID %s on the server.", starred() ? "start" : "unstar", qUtf8Printable(guidHash()));
+    qCDebug(FUOTEN_NETWORK, "Start to %s the item with GUID %s on the server.", starred() ? "start" : "unstar", qUtf8Printable(guidHash()));
 
     setInOperation(true);
 
@@ -122,7 +123,7 @@ void StarItem::successCallback()
 
     setInOperation(false);
 
-    qDebug("Successfully %s the item with GUID %s on the server.", starred() ? "starred" : "unstarred", qUtf8Printable(guidHash()));
+    qCDebug(FUOTEN_NETWORK, "Successfully %s the item with GUID %s on the server.", starred() ? "starred" : "unstarred", qUtf8Printable(guidHash()));
 
     Q_EMIT succeeded(feedId(), guidHash(), starred());
 }
@@ -147,14 +148,14 @@ qint64 StarItem::feedId() const { Q_D(const StarItem); return d->feedId; }
 void StarItem::setFeedId(qint64 nFeedId)
 {
     if (Q_UNLIKELY(inOperation())) {
-        qWarning("Can not change property %s, still in operation.", "feedId");
+        qCWarning(FUOTEN_NETWORK, "Can not change property %s, still in operation.", "feedId");
         return;
     }
 
     Q_D(StarItem);
     if (nFeedId != d->feedId) {
         d->feedId = nFeedId;
-        qDebug("Changed feedId to %lli.", d->feedId);
+        qCDebug(FUOTEN_NETWORK, "Changed feedId to %lli.", d->feedId);
         Q_EMIT feedIdChanged(feedId());
     }
 }
@@ -165,14 +166,14 @@ QString StarItem::guidHash() const { Q_D(const StarItem); return d->guidHash; }
 void StarItem::setGuidHash(const QString &nGuidHash)
 {
     if (Q_UNLIKELY(inOperation())) {
-        qWarning("Can not change property %s, still in operation.", "guidHash");
+        qCWarning(FUOTEN_NETWORK, "Can not change property %s, still in operation.", "guidHash");
         return;
     }
 
     Q_D(StarItem);
     if (nGuidHash != d->guidHash) {
         d->guidHash = nGuidHash;
-        qDebug("Changed guidHash to \"%s\".", qUtf8Printable(d->guidHash));
+        qCDebug(FUOTEN_NETWORK, "Changed guidHash to \"%s\".", qUtf8Printable(d->guidHash));
         Q_EMIT guidHashChanged(guidHash());
     }
 }
@@ -183,14 +184,14 @@ bool StarItem::starred() const { Q_D(const StarItem); return d->starred; }
 void StarItem::setStarred(bool nStarred)
 {
     if (Q_UNLIKELY(inOperation())) {
-        qWarning("Can not change property %s, still in operation.", "starred");
+        qCWarning(FUOTEN_NETWORK, "Can not change property %s, still in operation.", "starred");
         return;
     }
 
     Q_D(StarItem);
     if (nStarred != d->starred) {
         d->starred = nStarred;
-        qDebug("Changed starred to %s.", d->starred ? "true" : "false");
+        qCDebug(FUOTEN_NETWORK, "Changed starred to %s.", d->starred ? "true" : "false");
         Q_EMIT starredChanged(starred());
     }
 }
@@ -4,6 +4,7 @@
  */
 
 #include "starmultipleitems_p.h"
+#include "../logging_p.h"
 #include "../error.h"
 #include <QJsonArray>
 #include <QJsonObject>
@@ -59,11 +60,11 @@ StarMultipleItems::~StarMultipleItems()
 void StarMultipleItems::execute()
 {
     if (Q_UNLIKELY(inOperation())) {
-        qWarning("Still in operation. Returning.");
+        qCWarning(FUOTEN_NETWORK, "Still in operation. Returning.");
         return;
     }
 
-    qDebug("Start to %s multiple items on the remote server.", starred() ? "start" : "unstar");
+    qCDebug(FUOTEN_NETWORK, "Start to %s multiple items on the remote server.", starred() ? "start" : "unstar");
 
     setInOperation(true);
 
@@ -122,7 +123,7 @@ void StarMultipleItems::successCallback()
 
     setInOperation(false);
 
-    qDebug("Successfully %s multiple items on the remote server.", starred() ? "starred" : "unstarred");
+    qCDebug(FUOTEN_NETWORK, "Successfully %s multiple items on the remote server.", starred() ? "starred" : "unstarred");
 
     Q_EMIT succeeded(itemsToStar(), starred());
 }
@@ -133,11 +134,11 @@ QList<QPair<qint64,QString>> StarMultipleItems::itemsToStar() const { Q_D(const
 void StarMultipleItems::setItemsToStar(const QList<QPair<qint64, QString> > &items)
 {
     if (Q_UNLIKELY(inOperation())) {
-        qWarning("Can not set items, still in operation.");
+        qCWarning(FUOTEN_NETWORK, "Can not set items, still in operation.");
         return;
     }
 
-    qDebug("Set %i items to star/unstar.", items.size());
+    qCDebug(FUOTEN_NETWORK, "Set %i items to star/unstar.", items.size());
 
     Q_D(StarMultipleItems);
     d->itemsToStar = items;
@@ -147,11 +148,11 @@ void StarMultipleItems::setItemsToStar(const QList<QPair<qint64, QString> > &ite
 void StarMultipleItems::addItem(qint64 feedId, const QString &guidHash)
 {
     if (Q_UNLIKELY(inOperation())) {
-        qWarning("Can not add the item, still in operation.");
+        qCWarning(FUOTEN_NETWORK, "Can not add the item, still in operation.");
         return;
     }
 
-    qDebug("Add item to star/unstar. Feed ID %lli, GUID: %s", feedId, qUtf8Printable(guidHash));
+    qCDebug(FUOTEN_NETWORK, "Add item to star/unstar. Feed ID %lli, GUID: %s", feedId, qUtf8Printable(guidHash));
 
     Q_D(StarMultipleItems);
     d->itemsToStar.append(qMakePair(feedId, guidHash));
@@ -163,14 +164,14 @@ bool StarMultipleItems::starred() const { Q_D(const StarMultipleItems); return d
 void StarMultipleItems::setStarred(bool nStarred)
 {
     if (Q_UNLIKELY(inOperation())) {
-        qWarning("Can not change property %s, still in operation.", "starred");
+        qCWarning(FUOTEN_NETWORK, "Can not change property %s, still in operation.", "starred");
         return;
     }
 
     Q_D(StarMultipleItems);
     if (nStarred != d->starred) {
         d->starred = nStarred;
-        qDebug("Changed starred to %s.", d->starred ? "true" : "false");
+        qCDebug(FUOTEN_NETWORK, "Changed starred to %s.", d->starred ? "true" : "false");
         Q_EMIT starredChanged(starred());
     }
 }
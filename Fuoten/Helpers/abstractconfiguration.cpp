@@ -4,6 +4,7 @@
  */
 
 #include "abstractconfiguration.h"
+#include "../logging_p.h"
 #include <QUrl>
 #include <QJsonDocument>
 #include <QJsonObject>
@@ -102,6 +103,20 @@ QDateTime AbstractConfiguration::getLastSync() const
 }
 
 
+qint64 AbstractConfiguration::getInitialSyncOffset(FuotenEnums::Type type) const
+{
+    Q_UNUSED(type)
+    return 0;
+}
+
+
+void AbstractConfiguration::setInitialSyncOffset(FuotenEnums::Type type, qint64 offset)
+{
+    Q_UNUSED(type)
+    Q_UNUSED(offset)
+}
+
+
 FuotenEnums::ItemDeletionStrategy AbstractConfiguration::getPerFeedDeletionStrategy(qint64 feedId) const
 {
     Q_UNUSED(feedId)
@@ -132,7 +147,7 @@ bool AbstractConfiguration::setLoginFlowCredentials(const QUrl &credentialUrl)
 bool AbstractConfiguration::setLoginFlowCredentials(const QByteArray &credentials)
 {
     if (Q_UNLIKELY(credentials.isEmpty())) {
-        qCritical("%s", "Failed to set login flow credentials from empty data.");
+        qCCritical(FUOTEN_CORE, "%s", "Failed to set login flow credentials from empty data.");
         return false;
     }
 
@@ -140,7 +155,7 @@ bool AbstractConfiguration::setLoginFlowCredentials(const QByteArray &credential
     const QJsonDocument json = QJsonDocument::fromJson(credentials, &jsonError);
 
     if (Q_UNLIKELY(jsonError.error != QJsonParseError::NoError)) {
-        qCritical("Failed to parse the login flow credential JSON data: %s", qUtf8Printable(jsonError.errorString()));
+        qCCritical(FUOTEN_CORE, "Failed to parse the login flow credential JSON data: %s", qUtf8Printable(jsonError.errorString()));
         return false;
     }
 
@@ -151,12 +166,12 @@ bool AbstractConfiguration::setLoginFlowCredentials(const QByteArray &credential
 bool AbstractConfiguration::setLoginFlowCredentials(const QJsonDocument &credentials)
 {
     if (Q_UNLIKELY(credentials.isEmpty() || credentials.isNull())) {
-        qCritical("%s", "Failed to set login flow credentials from empty JSON document.");
+        qCCritical(FUOTEN_CORE, "%s", "Failed to set login flow credentials from empty JSON document.");
         return false;
     }
 
     if (Q_UNLIKELY(!credentials.isObject())) {
-        qCritical("%s", "Failed to set login flow credentials from a non JSON object.");
+        qCCritical(FUOTEN_CORE, "%s", "Failed to set login flow credentials from a non JSON object.");
         return false;
     }
 
@@ -167,27 +182,27 @@ bool AbstractConfiguration::setLoginFlowCredentials(const QJsonDocument &credent
 bool AbstractConfiguration::setLoginFlowCredentials(const QJsonObject &credentials)
 {
     if (Q_UNLIKELY(credentials.empty())) {
-        qCritical("%s", "Failed to set login flow credentials from empty JSON object.");
+        qCCritical(FUOTEN_CORE, "%s", "Failed to set login flow credentials from empty JSON object.");
         return false;
     }
 
-    qDebug() << "Login Flow return value:" << credentials;
+    qCDebug(FUOTEN_CORE) << "Login Flow return value:" << credentials;
 
     const QUrl serverUrl = QUrl(credentials.value(QStringLiteral("server")).toString(), QUrl::StrictMode);
     if (Q_UNLIKELY(!setServerUrl(serverUrl))) {
-        qCritical("Failed to set login flow credentials with invalid server URL: %s", qUtf8Printable(credentials.value(QStringLiteral("server")).toString()));
+        qCCritical(FUOTEN_CORE, "Failed to set login flow credentials with invalid server URL: %s", qUtf8Printable(credentials.value(QStringLiteral("server")).toString()));
         return false;
     }
 
     const QString loginName = credentials.value(QStringLiteral("loginName")).toString();
     if (Q_UNLIKELY(loginName.isEmpty())) {
-        qCritical("%s", "Failed to set login flow credentials with empty login name.");
+        qCCritical(FUOTEN_CORE, "%s", "Failed to set login flow credentials with empty login name.");
         return false;
     }
 
     const QString appPassword = credentials.value(QStringLiteral("appPassword")).toString();
     if (Q_UNLIKELY(appPassword.isEmpty())) {
-        qCritical("%s", "Failed to set login flow credentials with empty application apssword.");
+        qCCritical(FUOTEN_CORE, "%s", "Failed to set login flow credentials with empty application apssword.");
         return false;
     }
 
@@ -202,7 +217,7 @@ bool AbstractConfiguration::setLoginFlowCredentials(const QJsonObject &credentia
 bool AbstractConfiguration::setServerUrl(const QUrl &url)
 {
     if (Q_UNLIKELY(!url.isValid())) {
-        qCritical("%s", "Invalid server URL.");
+        qCCritical(FUOTEN_CORE, "%s", "Invalid server URL.");
         return false;
     }
 
@@ -212,13 +227,13 @@ bool AbstractConfiguration::setServerUrl(const QUrl &url)
     } else if (url.scheme() == QLatin1String("http")) {
         ssl = false;
     } else {
-        qCritical("Invalid server URL scheme: %s", qUtf8Printable(url.scheme()));
+        qCCritical(FUOTEN_CORE, "Invalid server URL scheme: %s", qUtf8Printable(url.scheme()));
         return false;
     }
 
     const QString host = url.host();
     if (Q_UNLIKELY(host.isEmpty())) {
-        qCritical("%s", "Empty server host name.");
+        qCCritical(FUOTEN_CORE, "%s", "Empty server host name.");
         return false;
     }
 
@@ -179,6 +179,38 @@ public:
      */
     virtual void setLastSync(const QDateTime &syncTime);
 
+    /*!
+     * \brief Returns the offset to resume the chunked initial synchronization of articles of \a type at.
+     *
+     * Used by the Synchronizer if Synchronizer::initialSyncChunkSize is greater than \c 0. \a type is
+     * FuotenEnums::All for the unread articles and FuotenEnums::Starred for the starred articles. A value
+     * of \c 0 means that the synchronization starts at the newest article, \c -1 means that all articles
+     * of \a type have already been synchronized.
+     *
+     * Reimplement this in a subclass together with setInitialSyncOffset() if you want to be able to resume
+     * an interrupted initial synchronization. The default implementation returns \c 0.
+     *
+     * \since 0.9.0
+     * \sa setInitialSyncOffset()
+     * \param type  the type of articles to get the offset for
+     */
+    virtual qint64 getInitialSyncOffset(FuotenEnums::Type type) const;
+
+    /*!
+     * \brief Saves the \a offset to resume the chunked initial synchronization of articles of \a type at.
+     *
+     * Will be called by the Synchronizer after every chunk that has been written to the storage. After the
+     * initial synchronization has been finished successfully, the offsets will be reset to \c 0.
+     *
+     * Reimplement this in a subclass together with getInitialSyncOffset(). The default implementation does nothing.
+     *
+     * \since 0.9.0
+     * \sa getInitialSyncOffset()
+     * \param type      the type of articles to save the offset for
+     * \param offset    ID of the oldest article that has been stored, or \c -1 if all articles of \a type have been stored
+     */
+    virtual void setInitialSyncOffset(FuotenEnums::Type type, qint64 offset);
+
     /*!
      * \brief Returns the item deletion strategy for the feed identified by \a feedId.
      *
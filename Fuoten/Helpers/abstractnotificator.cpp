@@ -4,6 +4,7 @@
  */
 
 #include "abstractnotificator_p.h"
+#include "../logging_p.h"
 #include "../error.h"
 
 #include <QVariant>
@@ -30,7 +31,7 @@ void AbstractNotificator::setAppIcon(const QString &appIcon)
     Q_D(AbstractNotificator);
     if (d->appIcon != appIcon) {
         d->appIcon = appIcon;
-        qDebug("Changed appIcon to \"%s\"", qUtf8Printable(d->appIcon));
+        qCDebug(FUOTEN_CORE, "Changed appIcon to \"%s\"", qUtf8Printable(d->appIcon));
         Q_EMIT appIconChanged(d->appIcon);
     }
 }
@@ -43,7 +44,7 @@ void AbstractNotificator::setAppName(const QString &appName)
     Q_D(AbstractNotificator);
     if (d->appName != appName) {
         d->appName = appName;
-        qDebug("Changed appName to \"%s\".", qUtf8Printable(d->appName));
+        qCDebug(FUOTEN_CORE, "Changed appName to \"%s\".", qUtf8Printable(d->appName));
         Q_EMIT appNameChanged(d->appName);
     }
 }
@@ -56,7 +57,7 @@ void AbstractNotificator::setEnabled(bool enabled)
     Q_D(AbstractNotificator);
     if (d->enabled != enabled) {
         d->enabled = enabled;
-        qDebug("Changed enabled to %s.", d->enabled ? "true" : "false");
+        qCDebug(FUOTEN_CORE, "Changed enabled to %s.", d->enabled ? "true" : "false");
         Q_EMIT enabledChanged(d->enabled);
     }
 }
@@ -69,7 +70,7 @@ void AbstractNotificator::setArticlePublishingEnabled(bool enabled)
     Q_D(AbstractNotificator);
     if (d->articlePublishing != enabled) {
         d->articlePublishing = enabled;
-        qDebug("Cahnged article publishing to %s.", d->articlePublishing ? "true" : "false");
+        qCDebug(FUOTEN_CORE, "Cahnged article publishing to %s.", d->articlePublishing ? "true" : "false");
         Q_EMIT articlePublishingChanged(d->articlePublishing);
     }
 }
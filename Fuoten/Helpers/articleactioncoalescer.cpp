@@ -0,0 +1,285 @@
+/*
+ * SPDX-FileCopyrightText: (C) 2016-2022 Matthias Fehring <https://www.huessenbergnetz.de>
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#include "articleactioncoalescer_p.h"
+#include "../logging_p.h"
+#include "../article.h"
+#include "../API/component.h"
+#include "../API/markmultipleitems.h"
+#include "../API/starmultipleitems.h"
+#include "../Storage/abstractstorage.h"
+#include <QMap>
+
+using namespace Fuoten;
+
+ArticleActionCoalescerPrivate::ArticleActionCoalescerPrivate(ArticleActionCoalescer *q) :
+    q_ptr(q)
+{
+    timer.setSingleShot(true);
+    timer.setInterval(2000);
+}
+
+ArticleActionCoalescerPrivate::~ArticleActionCoalescerPrivate()
+{
+
+}
+
+AbstractConfiguration *ArticleActionCoalescerPrivate::getConfiguration() const
+{
+    return configuration ? configuration : Component::defaultConfiguration();
+}
+
+AbstractStorage *ArticleActionCoalescerPrivate::getStorage() const
+{
+    return storage ? storage : Component::defaultStorage();
+}
+
+void ArticleActionCoalescerPrivate::actionAdded(int oldCount)
+{
+    Q_Q(ArticleActionCoalescer);
+
+    const int newCount = remote.count() + local.count();
+
+    if (newCount == 0) {
+        timer.stop();
+    } else if (!timer.isActive()) {
+        // the interval starts with the first action, so actions are not delayed forever while scrolling
+        timer.start();
+    }
+
+    if (newCount != oldCount) {
+        Q_EMIT q->pendingCountChanged(newCount);
+    }
+}
+
+void ArticleActionCoalescerPrivate::sendActions(const Actions &actions)
+{
+    AbstractConfiguration *config = getConfiguration();
+    AbstractStorage *stor = getStorage();
+
+    if (Q_UNLIKELY(!config)) {
+        qCWarning(FUOTEN_SYNC, "%s", "No configuration available to send the collected article actions, enqueueing them.");
+        enqueueActions(actions);
+        return;
+    }
+
+    IdList ids[2];
+    for (auto it = actions.marks.cbegin(), end = actions.marks.cend(); it != end; ++it) {
+        ids[it.value() ? 1 : 0].append(it.key());
+    }
+
+    for (int i = 0; i < 2; ++i) {
+        if (ids[i].isEmpty()) {
+            continue;
+        }
+        const bool unread = (i == 1);
+        const IdList itemIds = ids[i];
+        auto mmi = new MarkMultipleItems(itemIds, unread);
+        mmi->setConfiguration(config);
+        mmi->setStorage(stor);
+        QObject::connect(mmi, &MarkMultipleItems::succeeded, mmi, &QObject::deleteLater);
+        QObject::connect(mmi, &Component::failed, mmi, [mmi, stor, itemIds, unread](){
+            if (stor) {
+                stor->enqueueItems(unread ? FuotenEnums::MarkAsUnread : FuotenEnums::MarkAsRead, itemIds);
+            }
+            mmi->deleteLater();
+        });
+        mmi->execute();
+    }
+
+    IdList starIds[2];
+    QList<QPair<qint64, QString>> starItems[2];
+    for (auto it = actions.stars.cbegin(), end = actions.stars.cend(); it != end; ++it) {
+        const int i = it.value().starred ? 1 : 0;
+        starIds[i].append(it.key());
+        starItems[i].append(qMakePair(it.value().feedId, it.value().guidHash));
+    }
+
+    for (int i = 0; i < 2; ++i) {
+        if (starItems[i].isEmpty()) {
+            continue;
+        }
+        const bool starred = (i == 1);
+        const IdList itemIds = starIds[i];
+        auto smi = new StarMultipleItems(starred);
+        smi->setItemsToStar(starItems[i]);
+        smi->setConfiguration(config);
+        smi->setStorage(stor);
+        QObject::connect(smi, &StarMultipleItems::succeeded, smi, &QObject::deleteLater);
+        QObject::connect(smi, &Component::failed, smi, [smi, stor, itemIds, starred](){
+            if (stor) {
+                stor->enqueueItems(starred ? FuotenEnums::Star : FuotenEnums::Unstar, itemIds);
+            }
+            smi->deleteLater();
+        });
+        smi->execute();
+    }
+}
+
+void ArticleActionCoalescerPrivate::enqueueActions(const Actions &actions)
+{
+    AbstractStorage *stor = getStorage();
+
+    if (Q_UNLIKELY(!stor)) {
+        qCWarning(FUOTEN_SYNC, "%s", "No storage available to enqueue the collected article actions.");
+        return;
+    }
+
+    QMap<FuotenEnums::QueueAction, IdList> queue;
+
+    for (auto it = actions.marks.cbegin(), end = actions.marks.cend(); it != end; ++it) {
+        queue[it.value() ? FuotenEnums::MarkAsUnread : FuotenEnums::MarkAsRead].append(it.key());
+    }
+
+    for (auto it = actions.stars.cbegin(), end = actions.stars.cend(); it != end; ++it) {
+        queue[it.value().starred ? FuotenEnums::Star : FuotenEnums::Unstar].append(it.key());
+    }
+
+    if (!stor->enqueueItems(queue)) {
+        qCWarning(FUOTEN_SYNC, "%s", "Failed to enqueue the collected article actions.");
+    }
+}
+
+ArticleActionCoalescer::ArticleActionCoalescer(QObject *parent) :
+    QObject(parent), d_ptr(new ArticleActionCoalescerPrivate(this))
+{
+    Q_D(ArticleActionCoalescer);
+    connect(&d->timer, &QTimer::timeout, this, &ArticleActionCoalescer::flush);
+}
+
+ArticleActionCoalescer::~ArticleActionCoalescer()
+{
+    Q_D(ArticleActionCoalescer);
+
+    // requests started now would be aborted on shutdown, so let the next synchronization send them
+    if (d->local.count() > 0) {
+        d->enqueueActions(d->local);
+    }
+
+    if (d->remote.count() > 0) {
+        qCDebug(FUOTEN_SYNC, "Enqueueing %i collected article actions on destruction.", d->remote.count());
+        d->enqueueActions(d->remote);
+    }
+}
+
+int ArticleActionCoalescer::interval() const { Q_D(const ArticleActionCoalescer); return d->timer.interval(); }
+
+void ArticleActionCoalescer::setInterval(int nInterval)
+{
+    Q_D(ArticleActionCoalescer);
+    if (nInterval != d->timer.interval()) {
+        d->timer.setInterval(nInterval);
+        qCDebug(FUOTEN_SYNC, "Changed interval to %i.", nInterval);
+        Q_EMIT intervalChanged(interval());
+    }
+}
+
+int ArticleActionCoalescer::pendingCount() const
+{
+    Q_D(const ArticleActionCoalescer);
+    return d->remote.count() + d->local.count();
+}
+
+AbstractConfiguration *ArticleActionCoalescer::configuration() const
+{
+    Q_D(const ArticleActionCoalescer);
+    return d->getConfiguration();
+}
+
+void ArticleActionCoalescer::setConfiguration(AbstractConfiguration *configuration)
+{
+    Q_D(ArticleActionCoalescer);
+    d->configuration = configuration;
+}
+
+AbstractStorage *ArticleActionCoalescer::storage() const
+{
+    Q_D(const ArticleActionCoalescer);
+    return d->getStorage();
+}
+
+void ArticleActionCoalescer::setStorage(AbstractStorage *storage)
+{
+    Q_D(ArticleActionCoalescer);
+    d->storage = storage;
+}
+
+void ArticleActionCoalescer::mark(Article *article, bool unread, bool enqueue)
+{
+    Q_ASSERT_X(article, "coalesce article marking", "invalid article");
+
+    Q_D(ArticleActionCoalescer);
+
+    const int oldCount = pendingCount();
+    QHash<qint64, bool> &marks = enqueue ? d->local.marks : d->remote.marks;
+
+    auto it = marks.find(article->id());
+    if (it != marks.end()) {
+        // an opposite action restores the state the article had before the first one
+        if (it.value() != unread) {
+            marks.erase(it);
+        }
+    } else if (article->unread() != unread) {
+        marks.insert(article->id(), unread);
+    }
+
+    article->setUnread(unread);
+
+    d->actionAdded(oldCount);
+}
+
+void ArticleActionCoalescer::star(Article *article, bool starred, bool enqueue)
+{
+    Q_ASSERT_X(article, "coalesce article starring", "invalid article");
+
+    Q_D(ArticleActionCoalescer);
+
+    const int oldCount = pendingCount();
+    QHash<qint64, ArticleActionCoalescerPrivate::StarAction> &stars = enqueue ? d->local.stars : d->remote.stars;
+
+    auto it = stars.find(article->id());
+    if (it != stars.end()) {
+        if (it.value().starred != starred) {
+            stars.erase(it);
+        }
+    } else if (article->starred() != starred) {
+        stars.insert(article->id(), {article->feedId(), article->guidHash(), starred});
+    }
+
+    article->setStarred(starred);
+
+    d->actionAdded(oldCount);
+}
+
+void ArticleActionCoalescer::flush()
+{
+    Q_D(ArticleActionCoalescer);
+
+    d->timer.stop();
+
+    const int oldCount = pendingCount();
+    if (oldCount == 0) {
+        return;
+    }
+
+    qCDebug(FUOTEN_SYNC, "Flushing %i collected article actions.", oldCount);
+
+    const ArticleActionCoalescerPrivate::Actions remote = d->remote;
+    const ArticleActionCoalescerPrivate::Actions local = d->local;
+    d->remote.clear();
+    d->local.clear();
+
+    if (local.count() > 0) {
+        d->enqueueActions(local);
+    }
+
+    if (remote.count() > 0) {
+        d->sendActions(remote);
+    }
+
+    Q_EMIT pendingCountChanged(0);
+}
+
+#include "moc_articleactioncoalescer.cpp"
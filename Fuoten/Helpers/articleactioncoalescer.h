@@ -0,0 +1,169 @@
+/*
+ * SPDX-FileCopyrightText: (C) 2016-2022 Matthias Fehring <https://www.huessenbergnetz.de>
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#ifndef FUOTENARTICLEACTIONCOALESCER_H
+#define FUOTENARTICLEACTIONCOALESCER_H
+
+#include <QObject>
+#include "../fuoten_global.h"
+#include "fuoten_export.h"
+
+namespace Fuoten {
+
+class ArticleActionCoalescerPrivate;
+class AbstractConfiguration;
+class AbstractStorage;
+class Article;
+
+/*!
+ * \brief Collects mark and star actions on articles and performs them in batches.
+ *
+ * Marking articles while scrolling through a list would create a single API request or a single
+ * storage update for every article. This class collects the actions for the time set to
+ * \link ArticleActionCoalescer::interval interval\endlink, starting with the first collected
+ * action, and performs them afterwards with one MarkMultipleItems and one StarMultipleItems request
+ * per state or with a single call of AbstractStorage::enqueueItems() if the actions should be enqueued.
+ *
+ * The state of the Article objects is changed immediately. Opposite actions on the same article that
+ * happen in the same interval cancel each other out, so marking an article as read and as unread again
+ * will not result in any request. If a request to the server fails, the actions will be enqueued in the
+ * local storage to be performed on the next synchronization.
+ *
+ * If no \link AbstractConfiguration configuration\endlink or no \link AbstractStorage storage\endlink
+ * has been set to this object, Component::defaultConfiguration() or Component::defaultStorage() will be used.
+ *
+ * To let Article::mark() and Article::star() use a coalescer, set it via Component::setDefaultActionCoalescer().
+ * They will only use it if they are called with the same configuration and storage as returned by
+ * configuration() and storage(), otherwise they perform the action directly.
+ * Pending actions are performed when flush() is called. When the object gets destroyed, pending actions
+ * are written to the local queue of the storage instead, so that the next synchronization sends them.
+ *
+ * \since 0.9.0
+ *
+ * \headerfile "" <Fuoten/Helpers/ArticleActionCoalescer>
+ */
+class FUOTEN_EXPORT ArticleActionCoalescer : public QObject
+{
+    Q_OBJECT
+    /*!
+     * \brief Time in milliseconds actions are collected before they are performed.
+     *
+     * The interval starts with the first action that is collected after the last flush. Default: \c 2000
+     *
+     * \par Access functions:
+     * <TABLE><TR><TD>int</TD><TD>interval() const</TD></TR><TR><TD>void</TD><TD>setInterval(int nInterval)</TD></TR></TABLE>
+     * \par Notifier signal:
+     * <TABLE><TR><TD>void</TD><TD>intervalChanged(int interval)</TD></TR></TABLE>
+     */
+    Q_PROPERTY(int interval READ interval WRITE setInterval NOTIFY intervalChanged)
+    /*!
+     * \brief Number of collected actions that have not been performed yet.
+     *
+     * \par Access functions:
+     * <TABLE><TR><TD>int</TD><TD>pendingCount() const</TD></TR></TABLE>
+     * \par Notifier signal:
+     * <TABLE><TR><TD>void</TD><TD>pendingCountChanged(int pendingCount)</TD></TR></TABLE>
+     */
+    Q_PROPERTY(int pendingCount READ pendingCount NOTIFY pendingCountChanged)
+public:
+    /*!
+     * \brief Constructs a new %ArticleActionCoalescer object with the given \a parent.
+     */
+    explicit ArticleActionCoalescer(QObject *parent = nullptr);
+
+    /*!
+     * \brief Destroys the %ArticleActionCoalescer object and enqueues the pending actions in the storage.
+     */
+    ~ArticleActionCoalescer() override;
+
+    /*!
+     * \brief Getter function for the \link ArticleActionCoalescer::interval interval \endlink property.
+     * \sa ArticleActionCoalescer::setInterval(), ArticleActionCoalescer::intervalChanged()
+     */
+    int interval() const;
+
+    /*!
+     * \brief Setter function for the \link ArticleActionCoalescer::interval interval \endlink property.
+     * Emits the intervalChanged() signal if \a nInterval is not equal to the stored value.
+     * \sa ArticleActionCoalescer::interval(), ArticleActionCoalescer::intervalChanged()
+     */
+    void setInterval(int nInterval);
+
+    /*!
+     * \brief Getter function for the \link ArticleActionCoalescer::pendingCount pendingCount \endlink property.
+     * \sa ArticleActionCoalescer::pendingCountChanged()
+     */
+    int pendingCount() const;
+
+    /*!
+     * \brief Returns the configuration used to perform the actions.
+     *
+     * This is the configuration set via setConfiguration() or Component::defaultConfiguration().
+     */
+    AbstractConfiguration *configuration() const;
+
+    /*!
+     * \brief Sets the \a configuration.
+     *
+     * If no configuration has been set, Component::defaultConfiguration() will be used.
+     */
+    void setConfiguration(AbstractConfiguration *configuration);
+
+    /*!
+     * \brief Returns the storage used to perform the actions.
+     *
+     * This is the storage set via setStorage() or Component::defaultStorage().
+     */
+    AbstractStorage *storage() const;
+
+    /*!
+     * \brief Sets the \a storage.
+     *
+     * If no storage has been set, Component::defaultStorage() will be used.
+     */
+    void setStorage(AbstractStorage *storage);
+
+    /*!
+     * \brief Collects the marking of \a article as read or \a unread.
+     *
+     * Set \a enqueue to \c true to add the action to the local queue instead of sending it to the server.
+     */
+    Q_INVOKABLE void mark(Fuoten::Article *article, bool unread, bool enqueue = false);
+
+    /*!
+     * \brief Collects the marking of \a article as \a starred or unstarred.
+     *
+     * Set \a enqueue to \c true to add the action to the local queue instead of sending it to the server.
+     */
+    Q_INVOKABLE void star(Fuoten::Article *article, bool starred, bool enqueue = false);
+
+public Q_SLOTS:
+    /*!
+     * \brief Performs all collected actions now.
+     */
+    void flush();
+
+Q_SIGNALS:
+    /*!
+     * \brief This is emitted if the value of the \link ArticleActionCoalescer::interval interval \endlink property changes.
+     * \sa ArticleActionCoalescer::interval(), ArticleActionCoalescer::setInterval()
+     */
+    void intervalChanged(int interval);
+
+    /*!
+     * \brief This is emitted if the value of the \link ArticleActionCoalescer::pendingCount pendingCount \endlink property changes.
+     * \sa ArticleActionCoalescer::pendingCount()
+     */
+    void pendingCountChanged(int pendingCount);
+
+private:
+    const QScopedPointer<ArticleActionCoalescerPrivate> d_ptr;
+    Q_DECLARE_PRIVATE(ArticleActionCoalescer)
+    Q_DISABLE_COPY(ArticleActionCoalescer)
+};
+
+}
+
+#endif // FUOTENARTICLEACTIONCOALESCER_H
@@ -0,0 +1,56 @@
+/*
+ * SPDX-FileCopyrightText: (C) 2016-2022 Matthias Fehring <https://www.huessenbergnetz.de>
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#ifndef FUOTENARTICLEACTIONCOALESCER_P_H
+#define FUOTENARTICLEACTIONCOALESCER_P_H
+
+#include "articleactioncoalescer.h"
+#include <QHash>
+#include <QTimer>
+
+namespace Fuoten {
+
+class ArticleActionCoalescerPrivate {
+public:
+    explicit ArticleActionCoalescerPrivate(ArticleActionCoalescer *q);
+    ~ArticleActionCoalescerPrivate();
+
+    struct StarAction {
+        qint64 feedId;
+        QString guidHash;
+        bool starred;
+    };
+
+    /*
+     * Collected target states, either for the server or for the local queue.
+     */
+    struct Actions {
+        QHash<qint64, bool> marks;
+        QHash<qint64, StarAction> stars;
+
+        int count() const { return marks.size() + stars.size(); }
+        void clear() { marks.clear(); stars.clear(); }
+    };
+
+    AbstractConfiguration *getConfiguration() const;
+    AbstractStorage *getStorage() const;
+    void actionAdded(int oldCount);
+    void sendActions(const Actions &actions);
+    void enqueueActions(const Actions &actions);
+
+    Actions remote;
+    Actions local;
+    QTimer timer;
+
+private:
+    Q_DECLARE_PUBLIC(ArticleActionCoalescer)
+    ArticleActionCoalescer *q_ptr;
+    AbstractConfiguration *configuration = nullptr;
+    AbstractStorage *storage = nullptr;
+};
+
+}
+
+#endif // FUOTENARTICLEACTIONCOALESCER_P_H
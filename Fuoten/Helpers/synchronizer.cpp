@@ -4,6 +4,7 @@
  */
 
 #include "synchronizer_p.h"
+#include "../logging_p.h"
 #include "../article.h"
 #include "../API/component.h"
 #include <QPair>
@@ -45,7 +46,7 @@ void Synchronizer::start()
     Q_D(Synchronizer);
 
     if (Q_UNLIKELY(d->inOperation)) {
-        qWarning("Still in operation. Returning.");
+        qCWarning(FUOTEN_SYNC, "Still in operation. Returning.");
         return;
     }
 
@@ -63,7 +64,7 @@ void Synchronizer::start()
         setStorage(Component::defaultStorage());
     }
 
-    qDebug("%s", "Start synchronizing.");
+    qCDebug(FUOTEN_SYNC, "%s", "Start synchronizing.");
 
     setError(nullptr);
 
@@ -73,7 +74,7 @@ void Synchronizer::start()
         QueryArgs qa;
         qa.queuedOnly = true;
 
-        qDebug("%s", "Requesting queued articles from storage.");
+        qCDebug(FUOTEN_SYNC, "%s", "Requesting queued articles from storage.");
         const ArticleList qas = storage()->getArticles(qa);
         if (!qas.isEmpty()) {
             for (Article *a : qas) {
@@ -94,43 +95,43 @@ void Synchronizer::start()
             qDeleteAll(qas);
 
             if (!d->queuedUnreadArticles.empty()) {
-                qDebug("Found %i articles queued as unread.", d->queuedUnreadArticles.size());
+                qCDebug(FUOTEN_SYNC, "Found %i articles queued as unread.", d->queuedUnreadArticles.size());
                 d->totalActions++;
             }
 
             if (!d->queuedReadArticles.empty()) {
-                qDebug("Found %i articles queued as read.", d->queuedReadArticles.size());
+                qCDebug(FUOTEN_SYNC, "Found %i articles queued as read.", d->queuedReadArticles.size());
                 d->totalActions++;
             }
 
             if (!d->queuedStarredArticles.empty()) {
-                qDebug("Found %i articles queued as starred.", d->queuedStarredArticles.size());
+                qCDebug(FUOTEN_SYNC, "Found %i articles queued as starred.", d->queuedStarredArticles.size());
                 d->totalActions++;
             }
 
             if (!d->queuedUnstarredArticles.empty()) {
-                qDebug("Found %i articles queue as unstarred.", d->queuedUnstarredArticles.size());
+                qCDebug(FUOTEN_SYNC, "Found %i articles queue as unstarred.", d->queuedUnstarredArticles.size());
                 d->totalActions++;
             }
 
+            // the queue requests do not depend on each other, nor on the folder and feed requests,
+            // so they are all started at once, items will be requested after all of them finished
             if (!d->queuedUnreadArticles.isEmpty()) {
                 notifyAboutUnread();
-            } else if (!d->queuedReadArticles.isEmpty()) {
+            }
+            if (!d->queuedReadArticles.isEmpty()) {
                 notifyAboutRead();
-            } else if (!d->queuedStarredArticles.isEmpty()) {
+            }
+            if (!d->queuedStarredArticles.isEmpty()) {
                 notifyAboutStarred();
-            } else if (!d->queuedUnstarredArticles.isEmpty()) {
+            }
+            if (!d->queuedUnstarredArticles.isEmpty()) {
                 notifyAboutUnstarred();
-            } else {
-                requestFolders();
             }
-
-        } else {
-            requestFolders();
         }
-    } else {
-        requestFolders();
     }
+
+    requestFolders();
 }
 
 
@@ -154,7 +155,7 @@ void Synchronizer::setError(Error *nError)
             d->error = nError;
         }
 
-        qDebug("Changed error to %p.", d->error);
+        qCDebug(FUOTEN_SYNC, "Changed error to %p.", d->error);
         Q_EMIT errorChanged(d->error);
 
         if (old) {
@@ -187,15 +188,8 @@ void Synchronizer::notifyAboutUnread()
         d->unreadMultipleItems->setUseStorage(false);
         d->unreadMultipleItems->setNotificator(notificator());
         QObject::connect(d->unreadMultipleItems, &Component::failed, this, &Synchronizer::setError);
-        if (!d->queuedReadArticles.isEmpty()) {
-            QObject::connect(d->unreadMultipleItems, &MarkMultipleItems::succeeded, this, &Synchronizer::notifyAboutRead);
-        } else if (!d->queuedStarredArticles.isEmpty()) {
-            QObject::connect(d->unreadMultipleItems, &MarkMultipleItems::succeeded, this, &Synchronizer::notifyAboutStarred);
-        } else if (!d->queuedUnstarredArticles.isEmpty()) {
-            QObject::connect(d->unreadMultipleItems, &MarkMultipleItems::succeeded, this, &Synchronizer::notifyAboutUnstarred);
-        } else {
-            QObject::connect(d->unreadMultipleItems, &MarkMultipleItems::succeeded, this, &Synchronizer::requestFolders);
-        }
+        QObject::connect(d->unreadMultipleItems, &MarkMultipleItems::succeeded, this, [d] () {d->queueRequestFinished();});
+        ++d->pendingQueueRequests;
         d->unreadMultipleItems->execute();
     }
 }
@@ -216,13 +210,8 @@ void Synchronizer::notifyAboutRead()
         d->readMultipleItems->setUseStorage(false);
         d->readMultipleItems->setNotificator(notificator());
         QObject::connect(d->readMultipleItems, &Component::failed, this, &Synchronizer::setError);
-        if (!d->queuedStarredArticles.isEmpty()) {
-            QObject::connect(d->readMultipleItems, &MarkMultipleItems::succeeded, this, &Synchronizer::notifyAboutStarred);
-        } else if (!d->queuedUnstarredArticles.isEmpty()) {
-            QObject::connect(d->readMultipleItems, &MarkMultipleItems::succeeded, this, &Synchronizer::notifyAboutUnstarred);
-        } else {
-            QObject::connect(d->readMultipleItems, &MarkMultipleItems::succeeded, this, &Synchronizer::requestFolders);
-        }
+        QObject::connect(d->readMultipleItems, &MarkMultipleItems::succeeded, this, [d] () {d->queueRequestFinished();});
+        ++d->pendingQueueRequests;
         d->readMultipleItems->execute();
     }
 }
@@ -243,11 +232,8 @@ void Synchronizer::notifyAboutStarred()
         d->starMultipleItems->setUseStorage(false);
         d->starMultipleItems->setNotificator(notificator());
         QObject::connect(d->starMultipleItems, &Component::failed, this, &Synchronizer::setError);
-        if (!d->queuedUnstarredArticles.isEmpty()) {
-            QObject::connect(d->starMultipleItems, &StarMultipleItems::succeeded, this, &Synchronizer::notifyAboutUnstarred);
-        } else {
-            QObject::connect(d->starMultipleItems, &StarMultipleItems::succeeded, this, &Synchronizer::requestFolders);
-        }
+        QObject::connect(d->starMultipleItems, &StarMultipleItems::succeeded, this, [d] () {d->queueRequestFinished();});
+        ++d->pendingQueueRequests;
         d->starMultipleItems->execute();
     }
 }
@@ -268,7 +254,8 @@ void Synchronizer::notifyAboutUnstarred()
         d->unstarMultipleItems->setUseStorage(false);
         d->unstarMultipleItems->setNotificator(notificator());
         QObject::connect(d->unstarMultipleItems, &Component::failed, this, &Synchronizer::setError);
-        QObject::connect(d->unstarMultipleItems, &StarMultipleItems::succeeded, this, &Synchronizer::requestFolders);
+        QObject::connect(d->unstarMultipleItems, &StarMultipleItems::succeeded, this, [d] () {d->queueRequestFinished();});
+        ++d->pendingQueueRequests;
         d->unstarMultipleItems->execute();
     }
 }
@@ -305,30 +292,26 @@ void Synchronizer::requestFeeds()
         //% "Requesting feeds"
         setCurrentAction(qtTrId("libfuoten-sync-feeds"));
 
-#ifndef QT_NO_DEBUG_OUTPUT
-        if (d->configuration->getLastSync().isValid()) {
-            qDebug() << "We have a valid last sync time. Calling GetUpdatedItems after receiving feeds.";
-        } else {
-            qDebug() << "We have no valid last sync time. Calling GetItems after receiving feeds.";
+        if (FUOTEN_SYNC().isDebugEnabled()) {
+            if (d->configuration->getLastSync().isValid()) {
+                qCDebug(FUOTEN_SYNC) << "We have a valid last sync time. Calling GetUpdatedItems after receiving feeds.";
+            } else {
+                qCDebug(FUOTEN_SYNC) << "We have no valid last sync time. Calling GetItems after receiving feeds.";
+            }
         }
-#endif
         d->getFeeds = new GetFeeds(this);
         d->getFeeds->setConfiguration(d->configuration);
         d->getFeeds->setStorage(d->storage);
         d->getFeeds->setNotificator(notificator());
         QObject::connect(d->getFeeds, &Component::failed, this, &Synchronizer::setError);
+        auto feedsStored = [d] () {
+            d->feedsRequested = true;
+            d->requestItems();
+        };
         if (d->storage) {
-            if (d->configuration->getLastSync().isValid()) {
-                QObject::connect(d->storage, &AbstractStorage::requestedFeeds, this, &Synchronizer::requestUpdated);
-            } else {
-                QObject::connect(d->storage, &AbstractStorage::requestedFeeds, this, &Synchronizer::requestUnread);
-            }
+            QObject::connect(d->storage, &AbstractStorage::requestedFeeds, this, feedsStored);
         } else {
-            if (d->configuration->getLastSync().isValid()) {
-                QObject::connect(d->getFeeds, &Component::succeeded, this, &Synchronizer::requestUpdated);
-            } else {
-                QObject::connect(d->getFeeds, &Component::succeeded, this, &Synchronizer::requestUnread);
-            }
+            QObject::connect(d->getFeeds, &Component::succeeded, this, feedsStored);
         }
         d->getFeeds->execute();
     }
@@ -343,19 +326,45 @@ void Synchronizer::requestUnread()
         //% "Requesting unread articles"
         setCurrentAction(qtTrId("libfuoten-sync-req-articles"));
 
+        qint64 offset = 0;
+        if (d->initialSyncChunkSize > 0) {
+            if (d->storage) {
+                QObject::connect(d->storage, &AbstractStorage::requestedItems, this, [d] () {d->chunkStored();});
+            }
+            offset = d->configuration->getInitialSyncOffset(FuotenEnums::All);
+            if (offset < 0) {
+                qCDebug(FUOTEN_SYNC, "%s", "Unread articles have already been synchronized. Resuming with starred articles.");
+                d->itemRequestFinished();
+                requestStarred();
+                return;
+            }
+        }
+
         d->getUnread = new GetItems(this);
         d->getUnread->setConfiguration(d->configuration);
         d->getUnread->setStorage(d->storage);
         d->getUnread->setType(FuotenEnums::All);
         d->getUnread->setGetRead(false);
-        d->getUnread->setBatchSize(-1);
         d->getUnread->setRequestTimeout(150);
         d->getUnread->setNotificator(notificator());
+        d->getUnread->setStreamBatchSize(SynchronizerPrivate::itemsStreamBatchSize);
         QObject::connect(d->getUnread, &Component::failed, this, &Synchronizer::setError);
-        if (d->storage) {
-            QObject::connect(d->storage, &AbstractStorage::requestedItems, this, &Synchronizer::requestStarred);
+        if (d->initialSyncChunkSize > 0) {
+            qCDebug(FUOTEN_SYNC, "Requesting unread articles in chunks of %i, starting at offset %lli.", d->initialSyncChunkSize, offset);
+            d->getUnread->setBatchSize(d->initialSyncChunkSize);
+            d->getUnread->setOffset(offset);
+            QObject::connect(d->getUnread, &AbstractItemsComponent::itemsReceived, this, [d] (const QJsonArray &items) {d->chunkItemsReceived(items);});
+            QObject::connect(d->getUnread, &Component::succeeded, this, [d] () {d->chunkReceived(d->getUnread);});
         } else {
+            d->getUnread->setBatchSize(-1);
+            // the starred items are already downloaded while the unread items are still written to the storage
             QObject::connect(d->getUnread, &Component::succeeded, this, &Synchronizer::requestStarred);
+            if (d->storage) {
+                QObject::connect(d->storage, &AbstractStorage::requestedItems, this, [d] () {d->itemsStored();});
+                d->pendingStoredRequests.enqueue(FuotenEnums::All);
+            } else {
+                QObject::connect(d->getUnread, &Component::succeeded, this, [d] () {d->itemRequestFinished();});
+            }
         }
         d->getUnread->execute();
     }
@@ -370,18 +379,38 @@ void Synchronizer::requestStarred()
         //% "Requesting starred articles"
         setCurrentAction(qtTrId("libfuoten-sync-req-starred-articles"));
 
+        qint64 offset = 0;
+        if (d->initialSyncChunkSize > 0) {
+            offset = d->configuration->getInitialSyncOffset(FuotenEnums::Starred);
+            if (offset < 0) {
+                qCDebug(FUOTEN_SYNC, "%s", "Starred articles have already been synchronized.");
+                d->itemRequestFinished();
+                return;
+            }
+        }
+
         d->getStarred = new GetItems(this);
         d->getStarred->setConfiguration(d->configuration);
         d->getStarred->setStorage(d->storage);
         d->getStarred->setType(FuotenEnums::Starred);
         d->getStarred->setGetRead(true);
-        d->getStarred->setBatchSize(-1);
         d->getStarred->setNotificator(notificator());
+        d->getStarred->setStreamBatchSize(SynchronizerPrivate::itemsStreamBatchSize);
         QObject::connect(d->getStarred, &Component::failed, this, &Synchronizer::setError);
-        if (d->storage) {
-            QObject::connect(d->storage, &AbstractStorage::requestedItems, this, &Synchronizer::finished);
+        if (d->initialSyncChunkSize > 0) {
+            qCDebug(FUOTEN_SYNC, "Requesting starred articles in chunks of %i, starting at offset %lli.", d->initialSyncChunkSize, offset);
+            d->getStarred->setBatchSize(d->initialSyncChunkSize);
+            d->getStarred->setOffset(offset);
+            QObject::connect(d->getStarred, &AbstractItemsComponent::itemsReceived, this, [d] (const QJsonArray &items) {d->chunkItemsReceived(items);});
+            QObject::connect(d->getStarred, &Component::succeeded, this, [d] () {d->chunkReceived(d->getStarred);});
         } else {
-            QObject::connect(d->getStarred, &Component::succeeded, this, &Synchronizer::finished);
+            d->getStarred->setBatchSize(-1);
+            if (d->storage) {
+                // the storage completion is tracked by the connection made in requestUnread()
+                d->pendingStoredRequests.enqueue(FuotenEnums::Starred);
+            } else {
+                QObject::connect(d->getStarred, &Component::succeeded, this, [d] () {d->itemRequestFinished();});
+            }
         }
         d->getStarred->execute();
     }
@@ -403,11 +432,12 @@ void Synchronizer::requestUpdated()
         d->getUpdated->setType(FuotenEnums::All);
         d->getUpdated->setParentId(0);
         d->getUpdated->setNotificator(notificator());
+        d->getUpdated->setStreamBatchSize(SynchronizerPrivate::itemsStreamBatchSize);
         QObject::connect(d->getUpdated, &Component::failed, this, &Synchronizer::setError);
         if (d->storage) {
-            QObject::connect(d->storage, &AbstractStorage::requestedItems, this, &Synchronizer::finished);
+            QObject::connect(d->storage, &AbstractStorage::requestedItems, this, [d] () {d->itemRequestFinished();});
         } else {
-            QObject::connect(d->getUpdated, &Component::succeeded, this, &Synchronizer::finished);
+            QObject::connect(d->getUpdated, &Component::succeeded, this, [d] () {d->itemRequestFinished();});
         }
         d->getUpdated->execute();
     }
@@ -421,6 +451,10 @@ void Synchronizer::finished()
         d->storage->clearQueue();
     }
     setProgress(++d->performedActions/d->totalActions);
+    if ((d->initialSyncChunkSize > 0) && !d->configuration->getLastSync().isValid()) {
+        d->configuration->setInitialSyncOffset(FuotenEnums::All, 0);
+        d->configuration->setInitialSyncOffset(FuotenEnums::Starred, 0);
+    }
     d->configuration->setLastSync(QDateTime::currentDateTimeUtc());
     if (notificator()) {
         notificator()->notify(AbstractNotificator::SyncComplete, QtInfoMsg, d->startTime.secsTo(QDateTime::currentDateTime()));
@@ -429,7 +463,7 @@ void Synchronizer::finished()
     Q_EMIT succeeded();
     d->cleanup();
 
-    qDebug("%s", "Finished synchronizing");
+    qCDebug(FUOTEN_SYNC, "%s", "Finished synchronizing");
 }
 
 
@@ -447,14 +481,14 @@ AbstractConfiguration *Synchronizer::configuration() const
 void Synchronizer::setConfiguration(AbstractConfiguration *nAbstractConfiguration)
 {
     if (Q_UNLIKELY(inOperation())) {
-        qWarning("Can not change property %s, still in operation.", "configuration");
+        qCWarning(FUOTEN_SYNC, "Can not change property %s, still in operation.", "configuration");
         return;
     }
 
     Q_D(Synchronizer);
     if (nAbstractConfiguration != d->configuration) {
         d->configuration = nAbstractConfiguration;
-        qDebug("Changed configuration to %p.", d->configuration);
+        qCDebug(FUOTEN_SYNC, "Changed configuration to %p.", d->configuration);
         Q_EMIT configurationChanged(configuration());
     }
 }
@@ -474,14 +508,14 @@ AbstractStorage *Synchronizer::storage() const
 void Synchronizer::setStorage(AbstractStorage *nStorageHandler)
 {
     if (Q_UNLIKELY(inOperation())) {
-        qWarning("Can not change property %s, still in operation.", "storage");
+        qCWarning(FUOTEN_SYNC, "Can not change property %s, still in operation.", "storage");
         return;
     }
 
     Q_D(Synchronizer);
     if (nStorageHandler != d->storage) {
         d->storage = nStorageHandler;
-        qDebug("Changed storage to %p.", d->storage);
+        qCDebug(FUOTEN_SYNC, "Changed storage to %p.", d->storage);
         Q_EMIT storageChanged(storage());
     }
 }
@@ -501,7 +535,7 @@ void Synchronizer::setProgress(qreal nProgress)
     Q_D(Synchronizer);
     if (nProgress != d->progress) {
         d->progress = nProgress;
-        qDebug("Changed progress to %f.", d->progress);
+        qCDebug(FUOTEN_SYNC, "Changed progress to %f.", d->progress);
         Q_EMIT progressChanged(progress());
     }
 }
@@ -514,7 +548,7 @@ void Synchronizer::setCurrentAction(const QString &nCurrentAction)
     Q_D(Synchronizer);
     if (nCurrentAction != d->currentAction) {
         d->currentAction = nCurrentAction;
-        qDebug("Changed currentAction to %s.", qUtf8Printable(d->currentAction));
+        qCDebug(FUOTEN_SYNC, "Changed currentAction to %s.", qUtf8Printable(d->currentAction));
         Q_EMIT currentActionChanged(currentAction());
     }
 }
@@ -535,12 +569,30 @@ void Synchronizer::setNotificator(AbstractNotificator *notificator)
     Q_D(Synchronizer);
     if (notificator != d->notificator) {
         d->notificator = notificator;
-        qDebug("Changed notificator to %p.", d->notificator);
+        qCDebug(FUOTEN_SYNC, "Changed notificator to %p.", d->notificator);
         Q_EMIT notificatorChanged(d->notificator);
     }
 }
 
 
+int Synchronizer::initialSyncChunkSize() const { Q_D(const Synchronizer); return d->initialSyncChunkSize; }
+
+void Synchronizer::setInitialSyncChunkSize(int initialSyncChunkSize)
+{
+    if (Q_UNLIKELY(inOperation())) {
+        qCWarning(FUOTEN_SYNC, "Can not change property %s, still in operation.", "initialSyncChunkSize");
+        return;
+    }
+
+    Q_D(Synchronizer);
+    if (initialSyncChunkSize != d->initialSyncChunkSize) {
+        d->initialSyncChunkSize = initialSyncChunkSize;
+        qCDebug(FUOTEN_SYNC, "Changed initialSyncChunkSize to %i.", d->initialSyncChunkSize);
+        Q_EMIT initialSyncChunkSizeChanged(d->initialSyncChunkSize);
+    }
+}
+
+
 void Synchronizer::clearError()
 {
     setError(nullptr);
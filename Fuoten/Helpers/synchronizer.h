@@ -21,6 +21,11 @@ class AbstractNotificator;
 /*!
  * \brief Combines updating of folders, feeds and articles.
  *
+ * Requests that do not depend on each other are performed concurrently. The locally queued article
+ * actions are sent to the server while folders and feeds are requested. Articles are requested after
+ * the queue has been sent and the feeds have been stored. On the initial synchronization, the starred
+ * articles are already requested while the unread articles are still being written to the storage.
+ *
  * \par Mandatory properties
  * Synchronizer::configuration
  *
@@ -111,6 +116,28 @@ class FUOTEN_EXPORT Synchronizer : public QObject
      * \li void notificatorChanged(AbstractNotificator *notificator);
      */
     Q_PROPERTY(Fuoten::AbstractNotificator *notificator READ notificator WRITE setNotificator NOTIFY notificatorChanged)
+    /*!
+     * \brief Number of articles requested per chunk on the initial synchronization.
+     *
+     * If this is greater than \c 0, the unread and starred articles on the initial synchronization are requested
+     * in chunks of this size, using the offset parameter of GetItems. Every chunk is handed to the storage on its own.
+     * After a chunk has been stored, the offset for the next chunk is saved via AbstractConfiguration::setInitialSyncOffset(),
+     * so an interrupted initial synchronization can be resumed where it stopped the next time it is started.
+     *
+     * If this is \c 0 (the default), all articles are requested at once.
+     *
+     * This property can not be changed while the Synchronizer is in operation.
+     *
+     * \since 0.9.0
+     *
+     * \par Access functions:
+     * \li int initialSyncChunkSize() const
+     * \li void setInitialSyncChunkSize(int initialSyncChunkSize)
+     *
+     * \par Notifier signal:
+     * \li void initialSyncChunkSizeChanged(int initialSyncChunkSize)
+     */
+    Q_PROPERTY(int initialSyncChunkSize READ initialSyncChunkSize WRITE setInitialSyncChunkSize NOTIFY initialSyncChunkSizeChanged)
 public:
     /*!
      * \brief Constructs a new Synchronizer object with the given \a parent.
@@ -163,6 +190,13 @@ public:
      */
     AbstractNotificator *notificator() const;
 
+    /*!
+     * \brief Getter function for the \link Synchronizer::initialSyncChunkSize initialSyncChunkSize \endlink property.
+     * \since 0.9.0
+     * \sa setInitialSyncChunkSize(), initialSyncChunkSizeChanged()
+     */
+    int initialSyncChunkSize() const;
+
 
 
     /*!
@@ -183,6 +217,13 @@ public:
      */
     void setNotificator(AbstractNotificator *notificator);
 
+    /*!
+     * \brief Setter function for the \link Synchronizer::initialSyncChunkSize initialSyncChunkSize \endlink property.
+     * \since 0.9.0
+     * \sa initialSyncChunkSize(), initialSyncChunkSizeChanged()
+     */
+    void setInitialSyncChunkSize(int initialSyncChunkSize);
+
     /*!
      * \brief Invokes the synchronizing process.
      *
@@ -272,6 +313,13 @@ Q_SIGNALS:
      */
     void notificatorChanged(Fuoten::AbstractNotificator *notificator);
 
+    /*!
+     * \brief Notifier signal for the \link Synchronizer::initialSyncChunkSize initialSyncChunkSize \endlink property.
+     * \since 0.9.0
+     * \sa setInitialSyncChunkSize(), initialSyncChunkSize()
+     */
+    void initialSyncChunkSizeChanged(int initialSyncChunkSize);
+
 protected:
     const QScopedPointer<SynchronizerPrivate> d_ptr;
 
@@ -19,6 +19,11 @@
 #include "../error.h"
 #include <QTimer>
 #include <QDateTime>
+#include <QQueue>
+#include <QPair>
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QJsonObject>
 
 namespace Fuoten {
 
@@ -32,6 +37,9 @@ public:
 
     ~SynchronizerPrivate() {}
 
+    // number of items the item requests hand to the storage at once while the reply is received
+    static constexpr int itemsStreamBatchSize = 500;
+
 
     void cleanup()
     {
@@ -78,6 +86,14 @@ public:
         queuedReadArticles.clear();
         queuedStarredArticles.clear();
         queuedUnstarredArticles.clear();
+        pendingChunkOffsets.clear();
+        pendingStoredRequests.clear();
+        chunkOldestId = 0;
+        chunkItemCount = 0;
+        pendingQueueRequests = 0;
+        pendingItemRequests = 0;
+        feedsRequested = false;
+        itemsRequestStarted = false;
         inOperation = false;
         progress = 0.0;
         totalActions = 0.0;
@@ -97,7 +113,135 @@ public:
         }
     }
 
+    /*
+     * Called whenever one of the concurrently running queue requests has
+     * been finished successfully.
+     */
+    void queueRequestFinished()
+    {
+        --pendingQueueRequests;
+        requestItems();
+    }
+
+    /*
+     * Requesting items has to wait until the local queue has been sent to
+     * the server and until the feeds have been stored, because the server
+     * will otherwise return outdated states and the items table references
+     * the feeds table.
+     */
+    void requestItems()
+    {
+        if ((pendingQueueRequests > 0) || !feedsRequested || itemsRequestStarted) {
+            return;
+        }
+
+        itemsRequestStarted = true;
+
+        Q_Q(Synchronizer);
+        if (configuration->getLastSync().isValid()) {
+            pendingItemRequests = 1;
+            q->requestUpdated();
+        } else {
+            pendingItemRequests = 2;
+            q->requestUnread();
+        }
+    }
+
+    /*
+     * Called for every batch of items of the currently requested chunk of
+     * the chunked initial synchronization. The items might be streamed,
+     * so the chunk is never available as a whole.
+     */
+    void chunkItemsReceived(const QJsonArray &items)
+    {
+        chunkItemCount += items.size();
+        for (const QJsonValue &item : items) {
+            const qint64 id = AbstractStorage::getIdFromJson(item.toObject().value(QStringLiteral("id")));
+            if ((chunkOldestId == 0) || (id < chunkOldestId)) {
+                chunkOldestId = id;
+            }
+        }
+    }
+
+    /*
+     * Called whenever a chunk of the chunked initial synchronization has
+     * been received. Requests the next chunk while the storage is still
+     * writing the current one.
+     */
+    void chunkReceived(GetItems *getItems)
+    {
+        const qint64 oldestId = chunkOldestId;
+        const int itemCount = chunkItemCount;
+        chunkOldestId = 0;
+        chunkItemCount = 0;
+
+        const bool lastChunk = ((itemCount < getItems->batchSize()) || (oldestId <= 0));
+        const FuotenEnums::Type type = getItems->type();
+
+        pendingChunkOffsets.enqueue(qMakePair(type, lastChunk ? static_cast<qint64>(-1) : oldestId));
+
+        if (!storage) {
+            chunkStored();
+        }
+
+        if (!lastChunk) {
+            getItems->setOffset(oldestId);
+            // the component is still finishing the current reply, so execute it again from the event loop
+            QTimer::singleShot(0, getItems, &GetItems::execute);
+        } else if (type == FuotenEnums::All) {
+            Q_Q(Synchronizer);
+            q->requestStarred();
+        }
+    }
+
+    /*
+     * Called whenever a chunk of the chunked initial synchronization has
+     * been written to the storage. Only now it is safe to save the offset.
+     */
+    void chunkStored()
+    {
+        if (Q_UNLIKELY(pendingChunkOffsets.isEmpty())) {
+            return;
+        }
+
+        const QPair<FuotenEnums::Type, qint64> chunk = pendingChunkOffsets.dequeue();
+        configuration->setInitialSyncOffset(chunk.first, chunk.second);
+
+        if (chunk.second < 0) {
+            itemRequestFinished();
+        }
+    }
+
+    /*
+     * Called whenever the storage has processed the items of a request of
+     * the not chunked initial synchronization. The storage processes the
+     * requests in the order they have been started.
+     */
+    void itemsStored()
+    {
+        if (Q_UNLIKELY(pendingStoredRequests.isEmpty())) {
+            return;
+        }
+
+        pendingStoredRequests.dequeue();
+        itemRequestFinished();
+    }
+
+    /*
+     * Called whenever the items of one of the item requests have been
+     * processed completely.
+     */
+    void itemRequestFinished()
+    {
+        if (--pendingItemRequests == 0) {
+            Q_Q(Synchronizer);
+            q->finished();
+        }
+    }
+
 
+    QQueue<QPair<FuotenEnums::Type, qint64>> pendingChunkOffsets;
+    QQueue<FuotenEnums::Type> pendingStoredRequests;
     QList<QPair<qint64, QString> > queuedStarredArticles;
     QList<QPair<qint64, QString> > queuedUnstarredArticles;
     IdList queuedUnreadArticles;
@@ -119,9 +263,16 @@ public:
     AbstractNotificator *notificator = nullptr;
     QString currentAction;
     QDateTime startTime;
+    qint64 chunkOldestId = 0;
     qreal progress = 0.0;
     qreal totalActions = 0.0;
     qreal performedActions = 0.0;
+    int initialSyncChunkSize = 0;
+    int chunkItemCount = 0;
+    int pendingQueueRequests = 0;
+    int pendingItemRequests = 0;
+    bool feedsRequested = false;
+    bool itemsRequestStarted = false;
     bool inOperation = false;
 };
 
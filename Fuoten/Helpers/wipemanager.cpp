@@ -4,6 +4,7 @@
  */
 
 #include "wipemanager_p.h"
+#include "../logging_p.h"
 #include "abstractnotificator.h"
 #include "../API/getwipestatus.h"
 #include "../API/postwipesuccess.h"
@@ -117,7 +118,7 @@ WipeManagerPrivate::~WipeManagerPrivate()
 void WipeManagerPrivate::setInOperation(bool _inOperation)
 {
     if (inOperation != _inOperation) {
-        qDebug("Changed inOperation from %s to %s.", inOperation ? "true" : "false", _inOperation ? "true" : "false");
+        qCDebug(FUOTEN_SYNC, "Changed inOperation from %s to %s.", inOperation ? "true" : "false", _inOperation ? "true" : "false");
         inOperation = _inOperation;
         Q_Q(WipeManager);
         Q_EMIT q->inOperationChanged(inOperation);
@@ -126,7 +127,7 @@ void WipeManagerPrivate::setInOperation(bool _inOperation)
 
 void WipeManagerPrivate::doWipe()
 {
-    qDebug("%s", "Start executing remote wipe request");
+    qCDebug(FUOTEN_SYNC, "%s", "Start executing remote wipe request");
     setInOperation(true);
 
     Q_Q(WipeManager);
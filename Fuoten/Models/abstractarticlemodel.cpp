@@ -4,9 +4,12 @@
  */
 
 #include "abstractarticlemodel_p.h"
+#include "../logging_p.h"
 #include "../Storage/abstractstorage.h"
 #include "../API/component.h"
 #include <QMetaEnum>
+#include <algorithm>
+#include <functional>
 
 using namespace Fuoten;
 
@@ -18,48 +21,420 @@ AbstractArticleModelPrivate::AbstractArticleModelPrivate() : BaseModelPrivate()
 
 
 AbstractArticleModelPrivate::~AbstractArticleModelPrivate() {
-    while (!articles.isEmpty()) {
-        Article *a = articles.takeFirst();
-        if (!a->inOperation()) {
+    for (Article *a : articles) {
+        if (a && !a->inOperation()) {
             delete a;
         }
     }
 }
 
 
-int AbstractArticleModelPrivate::rowByID(qint64 id) {
-    if (articles.isEmpty()) {
-        return -1;
+int AbstractArticleModelPrivate::rowByID(qint64 id) const
+{
+    if (indexDirty) {
+        buildIndex();
     }
 
-    int idx = -1;
+    return rowsById.value(id, -1);
+}
+
 
-    for (int i = 0; i < articles.count(); ++i) {
-        if (articles.at(i)->id() == id) {
-            idx = i;
-            break;
+int AbstractArticleModelPrivate::rowByGuidHash(qint64 feedId, const QString &guidHash) const
+{
+    if (indexDirty) {
+        buildIndex();
+    }
+
+    return rowsByGuidHash.value(qMakePair(feedId, guidHash), -1);
+}
+
+
+void AbstractArticleModelPrivate::buildIndex() const
+{
+    rowsById.clear();
+    rowsByGuidHash.clear();
+    rowsById.reserve(records.size());
+    rowsByGuidHash.reserve(records.size());
+
+    for (int i = 0; i < records.size(); ++i) {
+        const ArticleRecord &r = records.at(i);
+        if (r.isValid()) {
+            rowsById.insert(r.id, i);
+            rowsByGuidHash.insert(qMakePair(r.feedId, r.guidHash), i);
         }
     }
 
-    return idx;
+    indexDirty = false;
+}
+
+
+void AbstractArticleModelPrivate::indexRows(int first, int last)
+{
+    // added or loaded rows do not move other rows, so the index can be extended
+    if (indexDirty) {
+        return;
+    }
+
+    for (int i = first; i <= last; ++i) {
+        const ArticleRecord &r = records.at(i);
+        if (r.isValid()) {
+            rowsById.insert(r.id, i);
+            rowsByGuidHash.insert(qMakePair(r.feedId, r.guidHash), i);
+        }
+    }
+}
+
+
+void AbstractArticleModelPrivate::unindexRow(int row)
+{
+    if (indexDirty) {
+        return;
+    }
+
+    const ArticleRecord &r = records.at(row);
+    if (r.isValid()) {
+        rowsById.remove(r.id);
+        rowsByGuidHash.remove(qMakePair(r.feedId, r.guidHash));
+    }
 }
 
 
-int AbstractArticleModelPrivate::rowByGuidHash(const QString &guidHash) {
-    if (articles.isEmpty()) {
-        return -1;
+void AbstractArticleModelPrivate::invalidateIndex()
+{
+    indexDirty = true;
+}
+
+
+void AbstractArticleModelPrivate::removeRows(const IdList &ids, AbstractArticleModel *q)
+{
+    // resolve all rows first and remove them from the bottom, so that the
+    // rows that have still to be removed do not move
+    QList<int> rows;
+    rows.reserve(ids.size());
+    for (qint64 id : ids) {
+        const int row = rowByID(id);
+        if (row > -1) {
+            rows.append(row);
+        }
+    }
+
+    if (rows.isEmpty()) {
+        return;
     }
 
-    int idx = -1;
+    std::sort(rows.begin(), rows.end(), std::greater<int>());
 
-    for (int i = 0; i < articles.count(); ++i) {
-        if (articles.at(i)->guidHash() == guidHash) {
-            idx = i;
-            break;
+    for (int row : rows) {
+        q->beginRemoveRows(QModelIndex(), row, row);
+        records.remove(row);
+        Article *a = articles.takeAt(row);
+        q->endRemoveRows();
+        if (a) {
+            a->deleteLater();
         }
     }
 
-    return idx;
+    invalidateIndex();
+}
+
+
+QueryArgs AbstractArticleModelPrivate::queryArgs() const
+{
+    QueryArgs qa;
+    qa.sortingRole = sortingRole;
+    qa.sortOrder = sortOrder;
+    qa.parentId = parentId;
+    qa.parentIdType = parentIdType;
+    qa.bodyLimit = bodyLimit;
+
+    if ((parentId < 0) && (parentIdType == FuotenEnums::Starred)) {
+        qa.starredOnly = true;
+    }
+
+    return qa;
+}
+
+
+QueryArgs AbstractArticleModelPrivate::pageQueryArgs(int page) const
+{
+    QueryArgs qa = queryArgs();
+
+    // filtering has to be done by the storage, a filter model would have to touch every row
+    qa.unreadOnly = unreadOnly;
+    if (starredOnly) {
+        qa.starredOnly = true;
+    }
+
+    qa.limit = loadedPageSize;
+
+    if ((page > 0) && (page < pageCursors.size())) {
+        qa.cursorId = pageCursors.at(page).id;
+#if (QT_VERSION >= QT_VERSION_CHECK(5, 8, 0))
+        qa.cursorPubDate = QDateTime::fromSecsSinceEpoch(pageCursors.at(page).pubDate, Qt::UTC);
+#else
+        qa.cursorPubDate = QDateTime::fromTime_t(static_cast<uint>(pageCursors.at(page).pubDate));
+#endif
+    }
+
+    return qa;
+}
+
+
+/*!
+ * \internal
+ * Returns \c true if the article of \a r belongs into the model according to its parent.
+ */
+bool AbstractArticleModelPrivate::matches(const ArticleRecord &r) const
+{
+    if (parentId < 0) {
+        return (parentIdType != FuotenEnums::Starred) || r.starred;
+    }
+
+    switch (parentIdType) {
+    case FuotenEnums::Feed:
+        return r.feedId == parentId;
+    case FuotenEnums::Folder:
+        return r.folderId == parentId;
+    default:
+        return true;
+    }
+}
+
+
+/*!
+ * \internal
+ * Limits the body of \a r to the body limit of the model.
+ */
+void AbstractArticleModelPrivate::limitBody(ArticleRecord &r) const
+{
+    if (bodyLimit < 0) {
+        r.body.clear();
+    } else if (bodyLimit > 0) {
+        r.body.truncate(bodyLimit);
+    }
+}
+
+
+bool AbstractArticleModelPrivate::ensureLoaded(int row)
+{
+    if ((row < 0) || (row >= records.size())) {
+        return false;
+    }
+
+    // evicted pages are loaded in the background, the row will be updated when they arrive
+    if (!records.at(row).isValid() && (loadedPageSize > 0)) {
+        requestPage(row / loadedPageSize);
+    }
+
+    return records.at(row).isValid();
+}
+
+
+Article *AbstractArticleModelPrivate::articleAt(int row)
+{
+    if (!ensureLoaded(row)) {
+        return nullptr;
+    }
+
+    Article *a = articles.at(row);
+
+    if (!a) {
+        a = new Article(records.at(row));
+        articles[row] = a;
+    }
+
+    return a;
+}
+
+
+void AbstractArticleModelPrivate::appendRecords(const ArticleRecordList &rs)
+{
+    const int first = records.size();
+
+    records.append(rs);
+    articles.reserve(records.size());
+    for (int i = 0; i < rs.size(); ++i) {
+        articles.append(nullptr);
+    }
+
+    indexRows(first, records.size() - 1);
+}
+
+
+void AbstractArticleModelPrivate::requestPage(int page)
+{
+    if (!storage || pageRequests.contains(page)) {
+        return;
+    }
+
+    qCDebug(FUOTEN_MODELS, "Requesting page %i with up to %i articles for the model.", page, loadedPageSize);
+
+    pageRequests.insert(page, storage->getArticleRecordsAsync(pageQueryArgs(page)));
+}
+
+
+/*!
+ * \internal
+ * Returns the page requested by \a requestId and removes the request, or \c -1 if it
+ * is not a page request of this model.
+ */
+int AbstractArticleModelPrivate::takePageRequest(int requestId)
+{
+    for (auto it = pageRequests.begin(); it != pageRequests.end(); ++it) {
+        if (it.value().id() == requestId) {
+            const int page = it.key();
+            pageRequests.erase(it);
+            return page;
+        }
+    }
+
+    return -1;
+}
+
+
+/*!
+ * \internal
+ * Fills the evicted rows of \a page with \a rs. The page is queried again with the current
+ * filters, so articles might have been added, removed or might not match anymore. Returns
+ * \c false without changing anything if \a rs does not cover the same articles as before.
+ */
+bool AbstractArticleModelPrivate::fillPage(int page, const ArticleRecordList &rs)
+{
+    const int first = page * loadedPageSize;
+    const int expected = qMin(loadedPageSize, records.size() - first);
+
+    if ((page >= pageKeys.size()) || (expected <= 0) || (rs.size() != expected)
+            || (rs.first().id != pageKeys.at(page).firstId) || (rs.last().id != pageKeys.at(page).lastId)) {
+        return false;
+    }
+
+    for (int i = 0; i < rs.size(); ++i) {
+        const int row = first + i;
+        if (!records.at(row).isValid()) {
+            records[row] = rs.at(i);
+            indexRows(row, row);
+        }
+    }
+
+    if (!loadedPages.contains(page)) {
+        loadedPages.append(page);
+    }
+
+    return true;
+}
+
+
+void AbstractArticleModelPrivate::cancelPageRequests()
+{
+    for (auto it = pageRequests.begin(); it != pageRequests.end(); ++it) {
+        it.value().cancel();
+    }
+    pageRequests.clear();
+}
+
+
+void AbstractArticleModelPrivate::evictPages(int currentPage)
+{
+    while (loadedPages.size() > qMax(maxCachedPages, 1)) {
+
+        int farthestIdx = 0;
+        for (int i = 1; i < loadedPages.size(); ++i) {
+            if (qAbs(loadedPages.at(i) - currentPage) > qAbs(loadedPages.at(farthestIdx) - currentPage)) {
+                farthestIdx = i;
+            }
+        }
+
+        const int page = loadedPages.takeAt(farthestIdx);
+
+        qCDebug(FUOTEN_MODELS, "Evicting page %i from the model.", page);
+
+        const int first = page * loadedPageSize;
+        const int last = qMin(first + loadedPageSize, records.size());
+        for (int row = first; row < last; ++row) {
+            Article *a = articles.at(row);
+            // articles that are still performing an API request are kept, deleting them would abort it
+            if (a && a->inOperation()) {
+                continue;
+            }
+            unindexRow(row);
+            records[row] = ArticleRecord();
+            if (a) {
+                articles[row] = nullptr;
+                a->deleteLater();
+            }
+        }
+    }
+}
+
+
+void AbstractArticleModelPrivate::appendPageCursor(const ArticleRecordList &page)
+{
+    if (page.size() < loadedPageSize) {
+        allPagesFetched = true;
+    } else {
+        PageCursor c;
+        c.id = page.last().id;
+        c.pubDate = page.last().pubDate;
+        pageCursors.append(c);
+    }
+}
+
+
+void AbstractArticleModelPrivate::setPageKeys(int page, const ArticleRecordList &rs)
+{
+    if (rs.isEmpty()) {
+        return;
+    }
+
+    if (pageKeys.size() <= page) {
+        pageKeys.resize(page + 1);
+    }
+
+    pageKeys[page].firstId = rs.first().id;
+    pageKeys[page].lastId = rs.last().id;
+}
+
+
+void AbstractArticleModelPrivate::setUnread(int row, bool unread)
+{
+    records[row].unread = unread;
+    Article *a = articles.at(row);
+    if (a) {
+        a->setUnread(unread);
+    }
+}
+
+
+void AbstractArticleModelPrivate::setStarred(int row, bool starred)
+{
+    records[row].starred = starred;
+    Article *a = articles.at(row);
+    if (a) {
+        a->setStarred(starred);
+    }
+}
+
+
+void AbstractArticleModelPrivate::setQueue(int row, FuotenEnums::QueueActions queue)
+{
+    records[row].queue = queue;
+    Article *a = articles.at(row);
+    if (a) {
+        a->setQueue(queue);
+    }
+}
+
+
+void AbstractArticleModelPrivate::setReadInQueue(int row)
+{
+    FuotenEnums::QueueActions qa = records.at(row).queue;
+    if (qa.testFlag(FuotenEnums::MarkAsUnread)) {
+        qa ^= FuotenEnums::MarkAsUnread;
+    } else {
+        qa |= FuotenEnums::MarkAsRead;
+    }
+    setQueue(row, qa);
+    setUnread(row, false);
 }
 
 
@@ -67,6 +442,8 @@ AbstractArticleModel::AbstractArticleModel(QObject *parent) :
     BaseModel(* new AbstractArticleModelPrivate, parent)
 {
     setStorage(Component::defaultStorage());
+    connect(this, &BaseModel::parentIdChanged, this, &AbstractArticleModel::cancelPendingLoad);
+    connect(this, &AbstractArticleModel::parentIdTypeChanged, this, &AbstractArticleModel::cancelPendingLoad);
 }
 
 
@@ -74,6 +451,8 @@ AbstractArticleModel::AbstractArticleModel(AbstractArticleModelPrivate &dd, QObj
     BaseModel(dd, parent)
 {
     setStorage(Component::defaultStorage());
+    connect(this, &BaseModel::parentIdChanged, this, &AbstractArticleModel::cancelPendingLoad);
+    connect(this, &AbstractArticleModel::parentIdTypeChanged, this, &AbstractArticleModel::cancelPendingLoad);
 }
 
 
@@ -90,7 +469,7 @@ void AbstractArticleModel::setParentIdType(FuotenEnums::Type nParentIdType)
     Q_D(AbstractArticleModel);
     if (nParentIdType != d->parentIdType) {
         d->parentIdType = nParentIdType;
-        qDebug("Changed parentIdType to %s.", FuotenEnums::staticMetaObject.enumerator(FuotenEnums::staticMetaObject.indexOfEnumerator("Type")).valueToKey(d->parentIdType));
+        qCDebug(FUOTEN_MODELS, "Changed parentIdType to %s.", FuotenEnums::staticMetaObject.enumerator(FuotenEnums::staticMetaObject.indexOfEnumerator("Type")).valueToKey(d->parentIdType));
         Q_EMIT parentIdTypeChanged(parentIdType());
     }
 }
@@ -103,7 +482,7 @@ void AbstractArticleModel::setStarredOnly(bool nStarredOnly)
     Q_D(AbstractArticleModel);
     if (nStarredOnly != d->starredOnly) {
         d->starredOnly = nStarredOnly;
-        qDebug("Changed starredOnly to %s.", d->starredOnly ? "true" : "false");
+        qCDebug(FUOTEN_MODELS, "Changed starredOnly to %s.", d->starredOnly ? "true" : "false");
         Q_EMIT starredOnlyChanged(starredOnly());
     }
 }
@@ -116,12 +495,38 @@ void AbstractArticleModel::setBodyLimit(int nBodyLimit)
     Q_D(AbstractArticleModel);
     if (nBodyLimit != d->bodyLimit) {
         d->bodyLimit = nBodyLimit;
-        qDebug("Changed bodyLimit to %i.", d->bodyLimit);
+        qCDebug(FUOTEN_MODELS, "Changed bodyLimit to %i.", d->bodyLimit);
         Q_EMIT bodyLimitChanged(bodyLimit());
     }
 }
 
 
+int AbstractArticleModel::pageSize() const { Q_D(const AbstractArticleModel); return d->pageSize; }
+
+void AbstractArticleModel::setPageSize(int nPageSize)
+{
+    Q_D(AbstractArticleModel);
+    if (nPageSize != d->pageSize) {
+        d->pageSize = nPageSize;
+        qCDebug(FUOTEN_MODELS, "Changed pageSize to %i.", d->pageSize);
+        Q_EMIT pageSizeChanged(pageSize());
+    }
+}
+
+
+int AbstractArticleModel::maxCachedPages() const { Q_D(const AbstractArticleModel); return d->maxCachedPages; }
+
+void AbstractArticleModel::setMaxCachedPages(int nMaxCachedPages)
+{
+    Q_D(AbstractArticleModel);
+    if (nMaxCachedPages != d->maxCachedPages) {
+        d->maxCachedPages = nMaxCachedPages;
+        qCDebug(FUOTEN_MODELS, "Changed maxCachedPages to %i.", d->maxCachedPages);
+        Q_EMIT maxCachedPagesChanged(maxCachedPages());
+    }
+}
+
+
 void AbstractArticleModel::handleStorageChanged(AbstractStorage *old)
 {
     if (old) {
@@ -131,7 +536,8 @@ void AbstractArticleModel::handleStorageChanged(AbstractStorage *old)
     AbstractStorage *s = storage();
 
     if (s) {
-        connect(s, &AbstractStorage::gotArticlesAsync, this, &AbstractArticleModel::gotArticlesAsync);
+        connect(s, &AbstractStorage::gotArticleRecordsAsync, this, &AbstractArticleModel::gotArticleRecordsAsync);
+        connect(s, &AbstractStorage::articlesChanged, this, &AbstractArticleModel::articlesChanged);
         connect(s, &AbstractStorage::requestedItems, this, &AbstractArticleModel::itemsRequested);
         connect(s, &AbstractStorage::markedReadFolder, this, &AbstractArticleModel::folderMarkedRead);
         connect(s, &AbstractStorage::markedReadFolderInQueue, this, &AbstractArticleModel::folderMarkedReadInQueue);
@@ -160,43 +566,186 @@ void AbstractArticleModel::load()
 
     setInOperation(true);
 
-    QueryArgs qa;
-    qa.sortingRole = sortingRole();
-    qa.sortOrder = sortOrder();
-    qa.parentId = parentId();
-    qa.parentIdType = parentIdType();
-    qa.bodyLimit = bodyLimit();
+    Q_D(AbstractArticleModel);
 
-    if ((parentId() < 0) && (parentIdType() == FuotenEnums::Starred)) {
-        qa.starredOnly = true;
+    // keyset pagination is only possible on unique and stable sort keys
+    const bool windowed = (d->pageSize > 0) && ((d->sortingRole == FuotenEnums::ID) || (d->sortingRole == FuotenEnums::Time));
+    if (Q_UNLIKELY((d->pageSize > 0) && !windowed)) {
+        qCWarning(FUOTEN_MODELS, "Windowed mode is not available for sorting role %i, loading all articles at once.", static_cast<int>(d->sortingRole));
     }
 
-    storage()->getArticlesAsync(qa);
+    if (windowed) {
+
+        d->loadedPageSize = d->pageSize;
+        d->pageCursors.append(AbstractArticleModelPrivate::PageCursor());
+
+        const ArticleRecordList rs = storage()->getArticleRecords(d->pageQueryArgs(0));
+
+        if (!rs.isEmpty()) {
+            beginInsertRows(QModelIndex(), 0, rs.size() - 1);
+            d->appendRecords(rs);
+            d->loadedPages.append(0);
+            d->setPageKeys(0, rs);
+            endInsertRows();
+        }
+
+        d->appendPageCursor(rs);
+
+        setLoaded(true);
+
+        setInOperation(false);
+
+        return;
+    }
+
+    d->pendingLoad = storage()->getArticleRecordsAsync(d->queryArgs());
+}
+
+
+bool AbstractArticleModel::isWindowed() const
+{
+    Q_D(const AbstractArticleModel);
+    return d->loadedPageSize > 0;
+}
+
+
+bool AbstractArticleModel::canFetchMore(const QModelIndex &parent) const
+{
+    if (parent.isValid()) {
+        return false;
+    }
+
+    Q_D(const AbstractArticleModel);
+
+    return (d->loadedPageSize > 0) && loaded() && !inOperation() && !d->allPagesFetched;
+}
+
+
+void AbstractArticleModel::fetchMore(const QModelIndex &parent)
+{
+    if (!canFetchMore(parent) || !storage()) {
+        return;
+    }
+
+    Q_D(AbstractArticleModel);
+
+    const int page = d->pageCursors.size() - 1;
+
+    const ArticleRecordList rs = storage()->getArticleRecords(d->pageQueryArgs(page));
+
+    if (!rs.isEmpty()) {
+
+        const int first = d->records.size();
+
+        beginInsertRows(QModelIndex(), first, first + rs.size() - 1);
+        d->appendRecords(rs);
+        d->loadedPages.append(page);
+        d->setPageKeys(page, rs);
+        endInsertRows();
+    }
+
+    d->appendPageCursor(rs);
+
+    d->evictPages(page);
+}
+
+
+Article *AbstractArticleModel::articleAt(int row) const
+{
+    Q_D(const AbstractArticleModel);
+    // loading evicted pages does not change the model from the view's point of view
+    return const_cast<AbstractArticleModelPrivate*>(d)->articleAt(row);
+}
+
+
+ArticleRecord AbstractArticleModel::recordAt(int row) const
+{
+    Q_D(const AbstractArticleModel);
+    if (const_cast<AbstractArticleModelPrivate*>(d)->ensureLoaded(row)) {
+        return d->records.at(row);
+    }
+    return ArticleRecord();
 }
 
 
 void AbstractArticleModel::gotArticlesAsync(const ArticleList &articles)
 {
+    Q_D(AbstractArticleModel);
+
+    // windowed models load their pages synchronously, the articles have been requested by another model
+    if (d->loadedPageSize > 0) {
+        return;
+    }
+
     if (Q_LIKELY(!articles.isEmpty())) {
 
-        qDebug("Start inserting %u articles into the model.", articles.size());
+        qCDebug(FUOTEN_MODELS, "Start inserting %u articles into the model.", articles.size());
 
-        Q_D(AbstractArticleModel);
+        const int first = rowCount();
 
-        beginInsertRows(QModelIndex(), rowCount(), rowCount() + articles.count() -1);
+        beginInsertRows(QModelIndex(), first, first + articles.count() -1);
 
+        d->records.reserve(first + articles.size());
         for (Article *a : articles) {
+            d->records.append(a->toRecord());
             if (a->thread() != this->thread()) {
-                d->articles.append(new Article(a));
+                d->articles.append(nullptr);
                 delete a;
             } else {
                 d->articles.append(a);
             }
         }
 
+        d->indexRows(first, d->records.size() - 1);
+
         endInsertRows();
 
-        qDebug("Finished inserting %u articles into the model.", articles.size());
+        qCDebug(FUOTEN_MODELS, "Finished inserting %u articles into the model.", articles.size());
+    }
+
+    setLoaded(true);
+
+    setInOperation(false);
+}
+
+
+void AbstractArticleModel::gotArticleRecordsAsync(int requestId, const ArticleRecordList &records)
+{
+    Q_D(AbstractArticleModel);
+
+    const int page = d->takePageRequest(requestId);
+    if (page > -1) {
+        if (d->fillPage(page, records)) {
+            const int first = page * d->loadedPageSize;
+            Q_EMIT dataChanged(index(first, 0), index(first + records.size() - 1, 0));
+            d->evictPages(page);
+        } else {
+            qCDebug(FUOTEN_MODELS, "Articles of page %i have changed since it has been evicted, reloading the model.", page);
+            reload();
+        }
+        return;
+    }
+
+    // the records might have been requested by another model or by a superseded load
+    if (!d->pendingLoad.isValid() || (requestId != d->pendingLoad.id())) {
+        return;
+    }
+
+    d->pendingLoad = StorageRequest();
+
+    if (Q_LIKELY(!records.isEmpty())) {
+
+        qCDebug(FUOTEN_MODELS, "Start inserting %u articles into the model.", records.size());
+
+        const int first = rowCount();
+
+        beginInsertRows(QModelIndex(), first, first + records.size() - 1);
+
+        d->appendRecords(records);
+
+        endInsertRows();
+
+        qCDebug(FUOTEN_MODELS, "Finished inserting %u articles into the model.", records.size());
     }
 
     setLoaded(true);
@@ -211,18 +760,11 @@ QModelIndex AbstractArticleModel::findByID(qint64 id) const
 
     Q_D(const AbstractArticleModel);
 
-    if (Q_UNLIKELY(d->articles.isEmpty())) {
+    if (Q_UNLIKELY(d->records.isEmpty())) {
         return idx;
     }
 
-    int idxInt = -1;
-
-    for (int i = 0; i < d->articles.count(); ++i) {
-        if (d->articles.at(i)->id() == id) {
-            idxInt = i;
-            break;
-        }
-    }
+    const int idxInt = d->rowByID(id);
 
     if (idxInt > -1) {
         idx = index(idxInt, 0);
@@ -238,14 +780,14 @@ QHash<qint64, QModelIndex> AbstractArticleModel::findByIDs(const IdList &ids) co
 
     Q_D(const AbstractArticleModel);
 
-    if (Q_UNLIKELY(d->articles.isEmpty())) {
+    if (Q_UNLIKELY(d->records.isEmpty())) {
         return idxs;
     }
 
-    for (int i = 0; i < d->articles.count(); ++i) {
-        Article *a = d->articles.at(i);
-        if (ids.contains(a->id())) {
-            idxs.insert(a->id(), index(i, 0));
+    for (qint64 id : ids) {
+        const int row = d->rowByID(id);
+        if (row > -1) {
+            idxs.insert(id, index(row, 0));
         }
     }
 
@@ -257,23 +799,41 @@ QHash<qint64, QModelIndex> AbstractArticleModel::findByIDs(const IdList &ids) co
 QList<Article*> AbstractArticleModel::articles() const
 {
     Q_D(const AbstractArticleModel);
+
+    AbstractArticleModelPrivate *dp = const_cast<AbstractArticleModelPrivate*>(d);
+    for (int i = 0; i < dp->records.size(); ++i) {
+        if (!dp->articles.at(i) && dp->records.at(i).isValid()) {
+            dp->articles[i] = new Article(dp->records.at(i));
+        }
+    }
+
     return d->articles;
 }
 
 
 void AbstractArticleModel::clear()
 {
+    cancelPendingLoad();
+
     Q_D(AbstractArticleModel);
 
-    if (Q_LIKELY(!d->articles.isEmpty())) {
+    if (Q_LIKELY(!d->records.isEmpty())) {
 
         beginRemoveRows(QModelIndex(), 0, rowCount() - 1);
 
         qDeleteAll(d->articles);
         d->articles.clear();
+        d->records.clear();
+        d->invalidateIndex();
 
         endRemoveRows();
     }
+
+    d->pageCursors.clear();
+    d->pageKeys.clear();
+    d->loadedPages.clear();
+    d->loadedPageSize = 0;
+    d->allPagesFetched = false;
 }
 
 
@@ -281,12 +841,24 @@ void AbstractArticleModel::itemsRequested(const IdList &updatedItems, const IdLi
 {
     Q_ASSERT_X(storage(), "update articles", "no storage available");
 
+    Q_D(AbstractArticleModel);
+
+    // already done by articlesChanged()
+    if (d->changesApplied) {
+        d->changesApplied = false;
+        return;
+    }
+
     if (rowCount() == 0) {
         reload();
         return;
     }
 
-    Q_D(AbstractArticleModel);
+    // new and removed articles would move the page boundaries
+    if ((d->loadedPageSize > 0) && (!newItems.isEmpty() || !deletedItems.isEmpty())) {
+        reload();
+        return;
+    }
 
     if (!updatedItems.isEmpty()) {
 
@@ -303,16 +875,18 @@ void AbstractArticleModel::itemsRequested(const IdList &updatedItems, const IdLi
             if ((parentId() < 0) && (parentIdType() == FuotenEnums::Starred)) {
                 qa.starredOnly = true;
             }
-            const QList<Article*> upits = storage()->getArticles(qa);
+            const ArticleRecordList upits = storage()->getArticleRecords(qa);
 
-            if (!upits.isEmpty()) {
-                for (Article *a : upits) {
+            for (const ArticleRecord &r : upits) {
 
-                    QModelIndex idx = idxs.value(a->id());
-                    d->articles.at(idx.row())->copy(a);
-                    Q_EMIT dataChanged(idx, idx, QVector<int>(1, Qt::DisplayRole));
+                QModelIndex idx = idxs.value(r.id);
+                d->records[idx.row()] = r;
+                Article *a = d->articles.at(idx.row());
+                if (a) {
+                    Article updated(r);
+                    a->copy(&updated);
                 }
-                qDeleteAll(upits);
+                Q_EMIT dataChanged(idx, idx, QVector<int>(1, Qt::DisplayRole));
             }
         }
     }
@@ -328,34 +902,88 @@ void AbstractArticleModel::itemsRequested(const IdList &updatedItems, const IdLi
         if ((parentId() < 0) && (parentIdType() == FuotenEnums::Starred)) {
             qa.starredOnly = true;
         }
-        const QList<Article*> newits = storage()->getArticles(qa);
+        const ArticleRecordList newits = storage()->getArticleRecords(qa);
 
         if (!newits.isEmpty()) {
 
-            beginInsertRows(QModelIndex(), rowCount(), rowCount() + newits.count() -1);
+            const int first = rowCount();
+
+            beginInsertRows(QModelIndex(), first, first + newits.count() -1);
 
-            d->articles.append(newits);
+            d->appendRecords(newits);
 
             endInsertRows();
         }
     }
 
     if (!deletedItems.isEmpty()) {
+        d->removeRows(deletedItems, this);
+    }
+}
+
+
+void AbstractArticleModel::articlesChanged(const ArticleChangeSet &changes)
+{
+    Q_D(AbstractArticleModel);
 
-        for (qint64 id : deletedItems) {
+    d->changesApplied = false;
 
-            int row = d->rowByID(id);
+    if (rowCount() == 0) {
+        return;
+    }
 
-            if (row > -1) {
+    // new and removed articles would move the page boundaries
+    if ((d->loadedPageSize > 0) && (!changes.added.isEmpty() || !changes.removed.isEmpty())) {
+        return;
+    }
 
-                beginRemoveRows(QModelIndex(), row, row);
+    // the records only contain excerpts of the bodies
+    if ((d->bodyLimit == 0) || (d->bodyLimit > changes.bodyLimit)) {
+        return;
+    }
 
-                delete d->articles.takeAt(row);
+    for (ArticleRecord r : changes.updated) {
 
-                endRemoveRows();
-            }
+        const int row = d->rowByID(r.id);
+        if ((row < 0) || !d->matches(r)) {
+            continue;
+        }
+
+        d->limitBody(r);
+        d->records[row] = r;
+        Article *a = d->articles.at(row);
+        if (a) {
+            Article updated(r);
+            a->copy(&updated);
+        }
+        const QModelIndex idx = index(row, 0);
+        Q_EMIT dataChanged(idx, idx, QVector<int>(1, Qt::DisplayRole));
+    }
+
+    ArticleRecordList added;
+    for (ArticleRecord r : changes.added) {
+        if (d->matches(r) && (d->rowByID(r.id) < 0)) {
+            d->limitBody(r);
+            added.append(r);
         }
     }
+
+    if (!added.isEmpty()) {
+
+        const int first = rowCount();
+
+        beginInsertRows(QModelIndex(), first, first + added.count() - 1);
+
+        d->appendRecords(added);
+
+        endInsertRows();
+    }
+
+    if (!changes.removed.isEmpty()) {
+        d->removeRows(changes.removed, this);
+    }
+
+    d->changesApplied = true;
 }
 
 
@@ -367,20 +995,13 @@ void AbstractArticleModel::folderMarkedRead(qint64 folderId, qint64 newestItemId
 
     Q_D(AbstractArticleModel);
 
-    const ArticleList as = d->articles;
-
-    if (as.isEmpty()) {
-        return;
-    }
+    for (int row = 0; row < d->records.size(); ++row) {
 
-    for (Article *a : as) {
+        const ArticleRecord &r = d->records.at(row);
 
-        if (a->unread() && (a->folderId() == folderId) && (a->id() <= newestItemId)) {
-            QModelIndex idx = findByID(a->id());
-            if (idx.isValid()) {
-                a->setUnread(false);
-                Q_EMIT dataChanged(idx, idx, QVector<int>(1, Qt::DisplayRole));
-            }
+        if (r.isValid() && r.unread && (r.folderId == folderId) && (r.id <= newestItemId)) {
+            d->setUnread(row, false);
+            Q_EMIT dataChanged(index(row, 0), index(row, 0), QVector<int>(1, Qt::DisplayRole));
         }
     }
 }
@@ -394,27 +1015,13 @@ void AbstractArticleModel::folderMarkedReadInQueue(qint64 folderId, qint64 newes
 
     Q_D(AbstractArticleModel);
 
-    const ArticleList as = d->articles;
+    for (int row = 0; row < d->records.size(); ++row) {
 
-    if (as.isEmpty()) {
-        return;
-    }
+        const ArticleRecord &r = d->records.at(row);
 
-    for (Article *a : as) {
-
-        if (a->unread() && (a->folderId() == folderId) && (a->id() <= newestItemId)) {
-            QModelIndex idx = findByID(a->id());
-            if (idx.isValid()) {
-                FuotenEnums::QueueActions qa = a->queue();
-                if (qa.testFlag(FuotenEnums::MarkAsUnread)) {
-                    qa ^= FuotenEnums::MarkAsUnread;
-                } else {
-                    qa |= FuotenEnums::MarkAsRead;
-                }
-                a->setQueue(qa);
-                a->setUnread(false);
-                Q_EMIT dataChanged(idx, idx, QVector<int>(1, Qt::DisplayRole));
-            }
+        if (r.isValid() && r.unread && (r.folderId == folderId) && (r.id <= newestItemId)) {
+            d->setReadInQueue(row);
+            Q_EMIT dataChanged(index(row, 0), index(row, 0), QVector<int>(1, Qt::DisplayRole));
         }
     }
 }
@@ -432,22 +1039,14 @@ void AbstractArticleModel::feedMarkedRead(qint64 feedId, qint64 newestItemId)
 
     Q_D(AbstractArticleModel);
 
-    const ArticleList as = d->articles;
-
-    if (as.isEmpty()) {
-        return;
-    }
+    for (int row = 0; row < d->records.size(); ++row) {
 
-    for (Article *a : as) {
+        const ArticleRecord &r = d->records.at(row);
 
-        if (a->unread() && (a->feedId() == feedId) && (a->id() <= newestItemId)) {
-            QModelIndex idx = findByID(a->id());
-            if (idx.isValid()) {
-                a->setUnread(false);
-                Q_EMIT dataChanged(idx, idx, QVector<int>(1, Qt::DisplayRole));
-            }
+        if (r.isValid() && r.unread && (r.feedId == feedId) && (r.id <= newestItemId)) {
+            d->setUnread(row, false);
+            Q_EMIT dataChanged(index(row, 0), index(row, 0), QVector<int>(1, Qt::DisplayRole));
         }
-
     }
 }
 
@@ -464,29 +1063,13 @@ void AbstractArticleModel::feedMarkedReadInQueue(qint64 feedId, qint64 newestIte
 
     Q_D(AbstractArticleModel);
 
-    const ArticleList as = d->articles;
+    for (int row = 0; row < d->records.size(); ++row) {
 
-    if (as.isEmpty()) {
-        return;
-    }
-
-    for (Article *a : as) {
-
-        if (a->unread() && (a->feedId() == feedId) && (a->id() <= newestItemId)) {
+        const ArticleRecord &r = d->records.at(row);
 
-            QModelIndex idx = findByID(a->id());
-            if (idx.isValid()) {
-
-                FuotenEnums::QueueActions qa = a->queue();
-                if (qa.testFlag(FuotenEnums::MarkAsUnread)) {
-                    qa ^= FuotenEnums::MarkAsUnread;
-                } else {
-                    qa |= FuotenEnums::MarkAsRead;
-                }
-                a->setQueue(qa);
-                a->setUnread(false);
-                Q_EMIT dataChanged(idx, idx, QVector<int>(1, Qt::DisplayRole));
-            }
+        if (r.isValid() && r.unread && (r.feedId == feedId) && (r.id <= newestItemId)) {
+            d->setReadInQueue(row);
+            Q_EMIT dataChanged(index(row, 0), index(row, 0), QVector<int>(1, Qt::DisplayRole));
         }
     }
 }
@@ -500,30 +1083,22 @@ void AbstractArticleModel::folderDeleted(qint64 folderId)
         return;
     }
 
+    Q_D(AbstractArticleModel);
+
+    if (d->loadedPageSize > 0) {
+        reload();
+        return;
+    }
+
     IdList idsToDelete;
-    const ArticleList as = articles();
-    for (Article *a : as) {
-        if (a->folderId() == folderId) {
-            idsToDelete.append(a->id());
+    for (const ArticleRecord &r : d->records) {
+        if (r.folderId == folderId) {
+            idsToDelete.append(r.id);
         }
     }
 
     if (!idsToDelete.isEmpty()) {
-
-        Q_D(AbstractArticleModel);
-
-        for (int i = 0; i < idsToDelete.count(); ++i) {
-            int row = d->rowByID(idsToDelete.at(i));
-            if (row > -1) {
-                beginRemoveRows(QModelIndex(), row, row);
-
-                Article *a = d->articles.takeAt(row);
-
-                endRemoveRows();
-
-                a->deleteLater();
-            }
-        }
+        d->removeRows(idsToDelete, this);
     }
 }
 
@@ -536,30 +1111,22 @@ void AbstractArticleModel::feedDeleted(qint64 feedId)
         return;
     }
 
+    Q_D(AbstractArticleModel);
+
+    if (d->loadedPageSize > 0) {
+        reload();
+        return;
+    }
+
     IdList idsToDelete;
-    const ArticleList as = articles();
-    for (Article *a : as) {
-        if (a->feedId() == feedId) {
-            idsToDelete.append(a->id());
+    for (const ArticleRecord &r : d->records) {
+        if (r.feedId == feedId) {
+            idsToDelete.append(r.id);
         }
     }
 
     if (!idsToDelete.isEmpty()) {
-
-        Q_D(AbstractArticleModel);
-
-        for (int i = 0; i < idsToDelete.count(); ++i) {
-            int row = d->rowByID(idsToDelete.at(i));
-            if (row > -1) {
-                beginRemoveRows(QModelIndex(), row, row);
-
-                Article *a = d->articles.takeAt(row);
-
-                endRemoveRows();
-
-                a->deleteLater();
-            }
-        }
+        d->removeRows(idsToDelete, this);
     }
 }
 
@@ -575,7 +1142,7 @@ void AbstractArticleModel::itemMarked(qint64 itemId, bool unread)
     if (idx.isValid()) {
         Q_D(AbstractArticleModel);
 
-        d->articles.at(idx.row())->setUnread(unread);
+        d->setUnread(idx.row(), unread);
 
         Q_EMIT dataChanged(idx, idx, QVector<int>(1, Qt::DisplayRole));
     }
@@ -598,8 +1165,9 @@ void AbstractArticleModel::itemsMarked(const IdList &itemIds, bool unread)
 
         QHash<qint64, QModelIndex>::const_iterator i = idxs.constBegin();
         while (i != idxs.constEnd()) {
-            d->articles.at(i.value().row())->setUnread(unread);
-            Q_EMIT dataChanged(i.value(), i.value(), QVector<int>(Qt::DisplayRole));
+            d->setUnread(i.value().row(), unread);
+            Q_EMIT dataChanged(i.value(), i.value(), QVector<int>(1, Qt::DisplayRole));
+            ++i;
         }
     }
 }
@@ -617,14 +1185,11 @@ void AbstractArticleModel::itemStarred(qint64 feedId, const QString &guidHash, b
 
     Q_D(AbstractArticleModel);
 
-    int row = d->rowByGuidHash(guidHash);
+    int row = d->rowByGuidHash(feedId, guidHash);
 
     if (row > -1) {
-        Article *a = d->articles.at(row);
-        if (a->feedId() == feedId) {
-            a->setStarred(starred);
-            Q_EMIT dataChanged(index(row, 0), index(row, 0), QVector<int>(1, Qt::DisplayRole));
-        }
+        d->setStarred(row, starred);
+        Q_EMIT dataChanged(index(row, 0), index(row, 0), QVector<int>(1, Qt::DisplayRole));
     }
 }
 
@@ -649,10 +1214,12 @@ void AbstractArticleModel::allItemsMarkedRead(qint64 newestItemId)
         return;
     }
 
-    const ArticleList as = articles();
-    for (Article *a : as) {
-        if (a->unread() && (a->id() <= newestItemId)) {
-            a->setUnread(false);
+    Q_D(AbstractArticleModel);
+
+    for (int row = 0; row < d->records.size(); ++row) {
+        const ArticleRecord &r = d->records.at(row);
+        if (r.isValid() && r.unread && (r.id <= newestItemId)) {
+            d->setUnread(row, false);
         }
     }
 
@@ -666,18 +1233,12 @@ void AbstractArticleModel::allItemsMarkedReadInQueue()
         return;
     }
 
-    const ArticleList as = articles();
+    Q_D(AbstractArticleModel);
 
-    for (Article *a : as) {
-        if (a->unread()) {
-            FuotenEnums::QueueActions qa = a->queue();
-            if (qa.testFlag(FuotenEnums::MarkAsUnread)) {
-                qa ^= FuotenEnums::MarkAsUnread;
-            } else {
-                qa |= FuotenEnums::MarkAsRead;
-            }
-            a->setQueue(qa);
-            a->setUnread(false);
+    for (int row = 0; row < d->records.size(); ++row) {
+        const ArticleRecord &r = d->records.at(row);
+        if (r.isValid() && r.unread) {
+            d->setReadInQueue(row);
         }
     }
 
@@ -688,18 +1249,35 @@ void AbstractArticleModel::allItemsMarkedReadInQueue()
 void AbstractArticleModel::queueCleared()
 {
     if (rowCount() <= 0) {
-
+        return;
     }
 
-    const ArticleList as = articles();
+    Q_D(AbstractArticleModel);
 
-    for (Article *a : as) {
+    for (int row = 0; row < d->records.size(); ++row) {
+        if (!d->records.at(row).isValid()) {
+            continue;
+        }
 #if (QT_VERSION >= QT_VERSION_CHECK(5, 15, 0))
-        a->setQueue(FuotenEnums::QueueActions());
+        d->setQueue(row, FuotenEnums::QueueActions());
 #else
-        a->setQueue(FuotenEnums::QueueActions(0));
+        d->setQueue(row, FuotenEnums::QueueActions(0));
 #endif
     }
 }
 
+void AbstractArticleModel::cancelPendingLoad()
+{
+    Q_D(AbstractArticleModel);
+
+    d->cancelPageRequests();
+
+    if (d->pendingLoad.isValid()) {
+        qCDebug(FUOTEN_MODELS, "Canceling article request %i.", d->pendingLoad.id());
+        d->pendingLoad.cancel();
+        d->pendingLoad = StorageRequest();
+        setInOperation(false);
+    }
+}
+
 #include "moc_abstractarticlemodel.cpp"
@@ -10,6 +10,8 @@
 #include "basemodel.h"
 #include "../fuoten.h"
 #include "../fuoten_global.h"
+#include "../articlerecord.h"
+#include "../articlechangeset.h"
 #include "fuoten_export.h"
 
 namespace Fuoten {
@@ -58,6 +60,41 @@ class FUOTEN_EXPORT AbstractArticleModel : public BaseModel
      * <TABLE><TR><TD>void</TD><TD>bodyLimitChanged(int bodyLimit)</TD></TR></TABLE>
      */
     Q_PROPERTY(int bodyLimit READ bodyLimit WRITE setBodyLimit NOTIFY bodyLimitChanged)
+    /*!
+     * \brief Number of articles per page in windowed mode.
+     *
+     * If greater than \c 0, load() will only load the first page of articles. Further pages will be loaded
+     * by fetchMore() using keyset pagination on the publication date or the ID, depending on the sortingRole.
+     * Windowed mode is only available for FuotenEnums::Time and FuotenEnums::ID, on any other sorting role
+     * all articles will be loaded at once. Articles of pages that are far away
+     * from the currently accessed rows will be destroyed and loaded again in the background on access, see maxCachedPages.
+     * If the articles of a reloaded page have changed in the meantime, the model will be reloaded.
+     * The BaseModel::unreadOnly and starredOnly properties will be used to filter the articles in the storage
+     * query, so there is no need for a filter model that would have to access every row.
+     *
+     * Changes take effect on the next load or reload. Default: \c 0 (load all articles at once)
+     *
+     * \since 0.9.0
+     *
+     * \par Access functions:
+     * <TABLE><TR><TD>int</TD><TD>pageSize() const</TD></TR><TR><TD>void</TD><TD>setPageSize(int nPageSize)</TD></TR></TABLE>
+     * \par Notifier signal:
+     * <TABLE><TR><TD>void</TD><TD>pageSizeChanged(int pageSize)</TD></TR></TABLE>
+     */
+    Q_PROPERTY(int pageSize READ pageSize WRITE setPageSize NOTIFY pageSizeChanged)
+    /*!
+     * \brief Maximum number of pages whose Article objects are kept in memory in windowed mode.
+     *
+     * Only used if pageSize is greater than \c 0. Default: \c 5
+     *
+     * \since 0.9.0
+     *
+     * \par Access functions:
+     * <TABLE><TR><TD>int</TD><TD>maxCachedPages() const</TD></TR><TR><TD>void</TD><TD>setMaxCachedPages(int nMaxCachedPages)</TD></TR></TABLE>
+     * \par Notifier signal:
+     * <TABLE><TR><TD>void</TD><TD>maxCachedPagesChanged(int maxCachedPages)</TD></TR></TABLE>
+     */
+    Q_PROPERTY(int maxCachedPages READ maxCachedPages WRITE setMaxCachedPages NOTIFY maxCachedPagesChanged)
 public:
     /*!
      * \brief Constructs a new empty abstract Article model with the given \a parent.
@@ -84,6 +121,16 @@ public:
      * \sa AbstractArticleModel::setBodyLimit(), AbstractArticleModel::bodyLimitChanged()
      */
     int bodyLimit() const;
+    /*!
+     * \brief Getter function for the \link AbstractArticleModel::pageSize pageSize \endlink property.
+     * \sa AbstractArticleModel::setPageSize(), AbstractArticleModel::pageSizeChanged()
+     */
+    int pageSize() const;
+    /*!
+     * \brief Getter function for the \link AbstractArticleModel::maxCachedPages maxCachedPages \endlink property.
+     * \sa AbstractArticleModel::setMaxCachedPages(), AbstractArticleModel::maxCachedPagesChanged()
+     */
+    int maxCachedPages() const;
 
 
 
@@ -106,6 +153,18 @@ public:
      * \sa AbstractArticleModel::bodyLimit(), AbstractArticleModel::bodyLimitChanged()
      */
     void setBodyLimit(int nBodyLimit);
+    /*!
+     * \brief Setter function for the \link AbstractArticleModel::pageSize pageSize \endlink property.
+     * Emits the pageSizeChanged() signal if \a nPageSize is not equal to the stored value.
+     * \sa AbstractArticleModel::pageSize(), AbstractArticleModel::pageSizeChanged()
+     */
+    void setPageSize(int nPageSize);
+    /*!
+     * \brief Setter function for the \link AbstractArticleModel::maxCachedPages maxCachedPages \endlink property.
+     * Emits the maxCachedPagesChanged() signal if \a nMaxCachedPages is not equal to the stored value.
+     * \sa AbstractArticleModel::maxCachedPages(), AbstractArticleModel::maxCachedPagesChanged()
+     */
+    void setMaxCachedPages(int nMaxCachedPages);
 
 
 
@@ -126,6 +185,40 @@ public:
      */
     QHash<qint64, QModelIndex> findByIDs(const IdList &ids) const override;
 
+    /*!
+     * \brief Returns \c true if the model is in windowed mode and there are more articles available in the storage.
+     * \since 0.9.0
+     */
+    bool canFetchMore(const QModelIndex &parent) const override;
+
+    /*!
+     * \brief Loads the next page of articles if the model is in windowed mode.
+     * \since 0.9.0
+     */
+    void fetchMore(const QModelIndex &parent) override;
+
+    /*!
+     * \brief Returns \c true if the articles have been loaded in windowed mode.
+     *
+     * The articles are sorted and filtered by the storage in windowed mode, proxy models should
+     * not access every row to sort or filter them, because that would load all evicted pages again.
+     *
+     * \sa pageSize
+     * \since 0.9.0
+     */
+    bool isWindowed() const;
+
+    /*!
+     * \brief Returns the ArticleRecord at \a row.
+     *
+     * In contrast to articleAt() this will not create an Article object. In windowed mode, this will request
+     * the page of \a row in the background if it is not loaded and return an invalid record until it arrives.
+     * Returns an invalid record if \a row is not valid.
+     *
+     * \since 0.9.0
+     */
+    ArticleRecord recordAt(int row) const;
+
 public Q_SLOTS:
     /*!
      * \brief Populates the model with data from the local storage.
@@ -152,10 +245,30 @@ Q_SIGNALS:
      * \sa AbstractArticleModel::bodyLimit(), AbstractArticleModel::setBodyLimit()
      */
     void bodyLimitChanged(int bodyLimit);
+    /*!
+     * \brief This is emitted if the value of the \link AbstractArticleModel::pageSize pageSize \endlink property changes.
+     * \sa AbstractArticleModel::pageSize(), AbstractArticleModel::setPageSize()
+     */
+    void pageSizeChanged(int pageSize);
+    /*!
+     * \brief This is emitted if the value of the \link AbstractArticleModel::maxCachedPages maxCachedPages \endlink property changes.
+     * \sa AbstractArticleModel::maxCachedPages(), AbstractArticleModel::setMaxCachedPages()
+     */
+    void maxCachedPagesChanged(int maxCachedPages);
 
 protected Q_SLOTS:
     void gotArticlesAsync(const Fuoten::ArticleList &articles);
 
+    /*!
+     * \brief Takes and processes the article records that have been requested by load() or for evicted pages.
+     *
+     * Records of other requests than the last one started by load() or the pending page requests will be ignored. handleStorageChanged()
+     * will connect the AbstractStorage::gotArticleRecordsAsync() signal to this slot.
+     *
+     * \since 0.9.0
+     */
+    void gotArticleRecordsAsync(int requestId, const Fuoten::ArticleRecordList &records);
+
     /*!
      * \brief Takes and processes data after items/articles have been requested.
      *
@@ -167,6 +280,18 @@ protected Q_SLOTS:
      */
     void itemsRequested(const Fuoten::IdList &updatedItems, const Fuoten::IdList &newItems, const Fuoten::IdList &deletedItems);
 
+    /*!
+     * \brief Updates the rows from the records in \a changes after items/articles have been requested.
+     *
+     * If the changes can be applied to the model, the following call of itemsRequested() will be ignored.
+     * Otherwise, like if the model is empty or needs longer bodies than contained in \a changes, itemsRequested()
+     * will query the changed articles from the storage. handleStorageChanged() will connect the
+     * AbstractStorage::articlesChanged() signal to this slot.
+     *
+     * \since 0.9.0
+     */
+    void articlesChanged(const Fuoten::ArticleChangeSet &changes);
+
     /*!
      * \brief Takes and processses data after a folder has been marked as read.
      *
@@ -302,15 +427,32 @@ protected:
 
     /*!
      * \brief Returns the list of Article objects in the model.
+     *
+     * The model only creates Article objects for rows that have been accessed, so this will create
+     * the objects for all other rows. Prefer articleAt() or recordAt() to access single rows. In windowed
+     * mode, the list will contain a \c nullptr for every row whose page is currently not loaded.
      */
     QList<Article*> articles() const;
 
+    /*!
+     * \brief Returns the Article object at \a row.
+     *
+     * In windowed mode, this will request the page of \a row in the background if it is not loaded and
+     * return a \c nullptr until it arrives. Loading a page might destroy the Article objects of pages far
+     * away from it. Returns a \c nullptr if \a row is not valid.
+     *
+     * \since 0.9.0
+     */
+    Article *articleAt(int row) const;
+
     /*!
      * \brief Clears the model and destroy all Article objects.
      */
     void clear() override;
 
 private:
+    void cancelPendingLoad();
+
     Q_DECLARE_PRIVATE(AbstractArticleModel)
     Q_DISABLE_COPY(AbstractArticleModel)
 };
@@ -9,6 +9,10 @@
 #include "abstractarticlemodel.h"
 #include "basemodel_p.h"
 #include "../article.h"
+#include "../Storage/abstractstorage.h"
+#include <QVector>
+#include <QHash>
+#include <QPair>
 
 namespace Fuoten {
 
@@ -18,13 +22,63 @@ public:
     AbstractArticleModelPrivate();
     ~AbstractArticleModelPrivate() override;
 
-    int rowByID(qint64 id);
-    int rowByGuidHash(const QString &guidHash);
+    int rowByID(qint64 id) const;
+    int rowByGuidHash(qint64 feedId, const QString &guidHash) const;
+    void buildIndex() const;
+    void indexRows(int first, int last);
+    void unindexRow(int row);
+    void invalidateIndex();
+    void removeRows(const IdList &ids, AbstractArticleModel *q);
 
+    QueryArgs queryArgs() const;
+    QueryArgs pageQueryArgs(int page) const;
+    bool ensureLoaded(int row);
+    Article *articleAt(int row);
+    void appendRecords(const ArticleRecordList &rs);
+    void requestPage(int page);
+    int takePageRequest(int requestId);
+    bool fillPage(int page, const ArticleRecordList &rs);
+    void cancelPageRequests();
+    void evictPages(int currentPage);
+    void appendPageCursor(const ArticleRecordList &page);
+    void setPageKeys(int page, const ArticleRecordList &rs);
+    void setUnread(int row, bool unread);
+    void setStarred(int row, bool starred);
+    void setQueue(int row, FuotenEnums::QueueActions queue);
+    void setReadInQueue(int row);
+    bool matches(const ArticleRecord &r) const;
+    void limitBody(ArticleRecord &r) const;
+
+    struct PageCursor {
+        qint64 id = -1;
+        qint64 pubDate = 0;
+    };
+
+    // IDs of the first and the last article of a page to verify a reloaded page
+    struct PageKeys {
+        qint64 firstId = -1;
+        qint64 lastId = -1;
+    };
+
+    // records hold the data of every row, Article objects are only created on access
+    ArticleRecordList records;
     QList<Article*> articles;
+    QVector<PageCursor> pageCursors;
+    QVector<PageKeys> pageKeys;
+    StorageRequest pendingLoad;
+    QHash<int, StorageRequest> pageRequests;
+    QList<int> loadedPages;
+    mutable QHash<qint64, int> rowsById;
+    mutable QHash<QPair<qint64, QString>, int> rowsByGuidHash;
+    mutable bool indexDirty = true;
     int bodyLimit = -1;
+    int pageSize = 0;
+    int loadedPageSize = 0;
+    int maxCachedPages = 5;
     FuotenEnums::Type parentIdType = FuotenEnums::All;
     bool starredOnly = false;
+    bool allPagesFetched = false;
+    bool changesApplied = false;
 
 private:
     Q_DISABLE_COPY(AbstractArticleModelPrivate)
@@ -4,10 +4,14 @@
  */
 
 #include "abstractfeedmodel_p.h"
+#include "../logging_p.h"
 #include "../Storage/abstractstorage.h"
 #include "../article.h"
 #include "../API/component.h"
 
+#include <algorithm>
+#include <functional>
+
 using namespace Fuoten;
 
 AbstractFeedModelPrivate::AbstractFeedModelPrivate() :
@@ -28,21 +32,64 @@ AbstractFeedModelPrivate::~AbstractFeedModelPrivate() {
 }
 
 
-int AbstractFeedModelPrivate::rowByID(qint64 id) {
-    if (feeds.isEmpty()) {
-        return -1;
+int AbstractFeedModelPrivate::rowByID(qint64 id) const
+{
+    if (indexDirty) {
+        rowsById.clear();
+        rowsById.reserve(feeds.size());
+        for (int i = 0; i < feeds.size(); ++i) {
+            rowsById.insert(feeds.at(i)->id(), i);
+        }
+        indexDirty = false;
     }
 
-    int idx = -1;
+    return rowsById.value(id, -1);
+}
 
-    for (int i = 0; i < feeds.count(); ++i) {
-        if (feeds.at(i)->id() == id) {
-            idx = i;
-            break;
+
+void AbstractFeedModelPrivate::indexRows(int first)
+{
+    // appended rows do not move other rows, so the index can be extended
+    if (!indexDirty) {
+        for (int i = first; i < feeds.size(); ++i) {
+            rowsById.insert(feeds.at(i)->id(), i);
         }
     }
+}
 
-    return idx;
+
+void AbstractFeedModelPrivate::invalidateIndex()
+{
+    indexDirty = true;
+}
+
+
+void AbstractFeedModelPrivate::removeRows(const IdList &ids, AbstractFeedModel *q)
+{
+    // resolve all rows first and remove them from the bottom, so that the
+    // rows that have still to be removed do not move
+    QList<int> rows;
+    rows.reserve(ids.size());
+    for (qint64 id : ids) {
+        const int row = rowByID(id);
+        if (row > -1) {
+            rows.append(row);
+        }
+    }
+
+    if (rows.isEmpty()) {
+        return;
+    }
+
+    std::sort(rows.begin(), rows.end(), std::greater<int>());
+
+    for (int row : rows) {
+        q->beginRemoveRows(QModelIndex(), row, row);
+        delete feeds.takeAt(row);
+        q->endRemoveRows();
+    }
+
+    invalidateIndex();
 }
 
 
@@ -117,17 +164,18 @@ void AbstractFeedModel::load()
 
     if (!fs.isEmpty()) {
 
-        qDebug("Start inserting %u feeds into the model.", fs.size());
+        qCDebug(FUOTEN_MODELS, "Start inserting %u feeds into the model.", fs.size());
 
         Q_D(AbstractFeedModel);
 
         beginInsertRows(QModelIndex(), 0, fs.size() - 1);
 
         d->feeds = fs;
+        d->invalidateIndex();
 
         endInsertRows();
 
-        qDebug("Finished inserting %u feeds into the model.", fs.size());
+        qCDebug(FUOTEN_MODELS, "Finished inserting %u feeds into the model.", fs.size());
     }
 
     setLoaded(true);
@@ -144,14 +192,7 @@ QModelIndex AbstractFeedModel::findByID(qint64 id) const
         return modidx;
     }
 
-    int idx = -1;
-
-    for (int i = 0; i < d->feeds.count(); ++i) {
-        if (d->feeds.at(i)->id() == id) {
-            idx = i;
-            break;
-        }
-    }
+    const int idx = d->rowByID(id);
 
     if (idx > -1) {
         modidx = index(idx, 0);
@@ -171,9 +212,10 @@ QHash<qint64, QModelIndex> AbstractFeedModel::findByIDs(const IdList &ids) const
         return idxs;
     }
 
-    for (int i = 0; i < d->feeds.count(); ++i) {
-        if (ids.contains(d->feeds.at(i)->id())) {
-            idxs.insert(d->feeds.at(i)->id(), index(i, 0));
+    for (qint64 id : ids) {
+        const int row = d->rowByID(id);
+        if (row > -1) {
+            idxs.insert(id, index(row, 0));
         }
     }
 
@@ -192,7 +234,7 @@ void AbstractFeedModel::feedsRequested(const IdList &updatedFeeds, const IdList
 {
     Q_ASSERT_X(storage(), "load feeds", "no storage available");
 
-    qDebug("%s", "Feeds requested. Updating feeds model.");
+    qCDebug(FUOTEN_MODELS, "%s", "Feeds requested. Updating feeds model.");
 
     Q_D(AbstractFeedModel);
 
@@ -233,17 +275,7 @@ void AbstractFeedModel::feedsRequested(const IdList &updatedFeeds, const IdList
 
                 // remove moved feeds from the model
                 if (!movedIds.isEmpty()) {
-                    for (qint64 mid : movedIds) {
-                        int row = d->rowByID(mid);
-                        if (row > -1) {
-
-                            beginRemoveRows(QModelIndex(), row, row);
-
-                            delete d->feeds.takeAt(row);
-
-                            endRemoveRows();
-                        }
-                    }
+                    d->removeRows(movedIds, this);
                 }
             }
         }
@@ -260,9 +292,12 @@ void AbstractFeedModel::feedsRequested(const IdList &updatedFeeds, const IdList
 
         if (!nfs.isEmpty()) {
 
-            beginInsertRows(QModelIndex(), rowCount(), rowCount() + nfs.count() - 1);
+            const int first = rowCount();
+
+            beginInsertRows(QModelIndex(), first, first + nfs.count() - 1);
 
             d->feeds.append(nfs);
+            d->indexRows(first);
 
             endInsertRows();
         }
@@ -270,19 +305,7 @@ void AbstractFeedModel::feedsRequested(const IdList &updatedFeeds, const IdList
 
 
     if (!deletedFeeds.isEmpty()) {
-
-        for (qint64 id : deletedFeeds) {
-
-            int row = d->rowByID(id);
-            if (row > -1) {
-
-                beginRemoveRows(QModelIndex(), row, row);
-
-                delete d->feeds.takeAt(row);
-
-                endRemoveRows();
-            }
-        }
+        d->removeRows(deletedFeeds, this);
     }
 }
 
@@ -302,6 +325,7 @@ void AbstractFeedModel::feedCreated(qint64 id, qint64 folderId)
             beginInsertRows(QModelIndex(), rowCount(), rowCount());
 
             d->feeds.append(f);
+            d->indexRows(d->feeds.size() - 1);
 
             endInsertRows();
         }
@@ -320,6 +344,7 @@ void AbstractFeedModel::feedDeleted(qint64 id)
         beginRemoveRows(QModelIndex(), row, row);
 
         Feed *f = d->feeds.takeAt(row);
+        d->invalidateIndex();
 
         endRemoveRows();
 
@@ -368,7 +393,7 @@ void AbstractFeedModel::feedMoved(qint64 id, qint64 targetFolderId)
     Feed *f = storage()->getFeed(id);
 
     if (!f) {
-        qWarning("Can not find feed in local storage.");
+        qCWarning(FUOTEN_MODELS, "Can not find feed in local storage.");
         return;
     }
 
@@ -390,6 +415,7 @@ void AbstractFeedModel::feedMoved(qint64 id, qint64 targetFolderId)
         beginRemoveRows(QModelIndex(), idx.row(), idx.row());
 
         Feed *movedFeed = d->feeds.takeAt(idx.row());
+        d->invalidateIndex();
 
         endRemoveRows();
 
@@ -402,6 +428,7 @@ void AbstractFeedModel::feedMoved(qint64 id, qint64 targetFolderId)
         beginInsertRows(QModelIndex(), rowCount(), rowCount());
 
         d->feeds.append(f);
+        d->indexRows(d->feeds.size() - 1);
 
         endInsertRows();
 
@@ -463,6 +490,7 @@ void AbstractFeedModel::folderDeleted(qint64 folderId)
 
         qDeleteAll(d->feeds);
         d->feeds.clear();
+        d->invalidateIndex();
 
         endRemoveRows();
 
@@ -480,23 +508,7 @@ void AbstractFeedModel::folderDeleted(qint64 folderId)
         }
 
         if (!rmFeedIds.isEmpty()) {
-
-            for (int i = 0; i < rmFeedIds.count(); ++i) {
-
-                int row = d->rowByID(rmFeedIds.at(i));
-
-                if (row > -1) {
-
-                    beginRemoveRows(QModelIndex(), row, row);
-
-                    delete d->feeds.takeAt(row);
-
-                    endRemoveRows();
-
-                }
-
-            }
-
+            d->removeRows(rmFeedIds, this);
         }
 
     }
@@ -513,6 +525,7 @@ void AbstractFeedModel::clear()
 
         qDeleteAll(d->feeds);
         d->feeds.clear();
+        d->invalidateIndex();
 
         endRemoveRows();
     }
@@ -193,6 +193,7 @@ protected:
 private:
     Q_DISABLE_COPY(AbstractFeedModel)
     Q_DECLARE_PRIVATE(AbstractFeedModel)
+    friend class AbstractFeedModelPrivate;
 };
 
 }
@@ -9,6 +9,7 @@
 #include "abstractfeedmodel.h"
 #include "basemodel_p.h"
 #include "../feed.h"
+#include <QHash>
 
 namespace Fuoten {
 
@@ -18,9 +19,14 @@ public:
     AbstractFeedModelPrivate();
     ~AbstractFeedModelPrivate() override;
 
-    int rowByID(qint64 id);
+    int rowByID(qint64 id) const;
+    void indexRows(int first);
+    void invalidateIndex();
+    void removeRows(const IdList &ids, AbstractFeedModel *q);
 
     QList<Feed*> feeds;
+    mutable QHash<qint64, int> rowsById;
+    mutable bool indexDirty = true;
 
 private:
     Q_DISABLE_COPY(AbstractFeedModelPrivate)
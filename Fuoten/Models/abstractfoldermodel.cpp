@@ -4,11 +4,15 @@
  */
 
 #include "abstractfoldermodel_p.h"
+#include "../logging_p.h"
 #include "../Storage/abstractstorage.h"
 #include "../fuoten.h"
 #include "../article.h"
 #include "../API/component.h"
 
+#include <algorithm>
+#include <functional>
+
 using namespace Fuoten;
 
 AbstractFolderModelPrivate::AbstractFolderModelPrivate() :
@@ -31,21 +35,63 @@ AbstractFolderModelPrivate::~AbstractFolderModelPrivate() {
 }
 
 
-int AbstractFolderModelPrivate::rowByID(qint64 id) {
-    if (folders.isEmpty()) {
-        return -1;
+int AbstractFolderModelPrivate::rowByID(qint64 id) const
+{
+    if (indexDirty) {
+        rowsById.clear();
+        rowsById.reserve(folders.size());
+        for (int i = 0; i < folders.size(); ++i) {
+            rowsById.insert(folders.at(i)->id(), i);
+        }
+        indexDirty = false;
+    }
+
+    return rowsById.value(id, -1);
+}
+
+
+void AbstractFolderModelPrivate::indexRows(int first)
+{
+    if (!indexDirty) {
+        for (int i = first; i < folders.size(); ++i) {
+            rowsById.insert(folders.at(i)->id(), i);
+        }
     }
+}
+
 
-    int idx = -1;
+void AbstractFolderModelPrivate::invalidateIndex()
+{
+    indexDirty = true;
+}
 
-    for (int i = 0; i < folders.count(); ++i) {
-        if (folders.at(i)->id() == id) {
-            idx = i;
-            break;
+
+void AbstractFolderModelPrivate::removeRows(const IdList &ids, AbstractFolderModel *q)
+{
+    // resolve all rows first and remove them from the bottom, so that the
+    // rows that have still to be removed do not move
+    QList<int> rows;
+    rows.reserve(ids.size());
+    for (qint64 id : ids) {
+        const int row = rowByID(id);
+        if (row > -1) {
+            rows.append(row);
         }
     }
 
-    return idx;
+    if (rows.isEmpty()) {
+        return;
+    }
+
+    std::sort(rows.begin(), rows.end(), std::greater<int>());
+
+    for (int row : rows) {
+        q->beginRemoveRows(QModelIndex(), row, row);
+        delete folders.takeAt(row);
+        q->endRemoveRows();
+    }
+
+    invalidateIndex();
 }
 
 
@@ -115,17 +161,18 @@ void AbstractFolderModel::load()
     const QList<Folder*> fs = storage()->getFolders(FuotenEnums::Name, Qt::AscendingOrder);
     if (!fs.isEmpty()) {
 
-        qDebug("Start inserting %u folders into the model.", fs.size());
+        qCDebug(FUOTEN_MODELS, "Start inserting %u folders into the model.", fs.size());
 
         Q_D(AbstractFolderModel);
 
         beginInsertRows(QModelIndex(), 0, fs.count() - 1);
 
         d->folders = fs;
+        d->invalidateIndex();
 
         endInsertRows();
 
-        qDebug("Finished inserting %u folders into the model.", fs.size());
+        qCDebug(FUOTEN_MODELS, "Finished inserting %u folders into the model.", fs.size());
     }
 
     setLoaded(true);
@@ -151,14 +198,7 @@ QModelIndex AbstractFolderModel::findByID(qint64 id) const
         return modIdx;
     }
 
-    int idx = -1;
-
-    for (int i = 0; i < d->folders.count(); ++i) {
-        if (d->folders.at(i)->id() == id) {
-            idx = i;
-            break;
-        }
-    }
+    const int idx = d->rowByID(id);
 
     if (idx > -1) {
         modIdx = index(idx, 0);
@@ -195,6 +235,7 @@ void AbstractFolderModel::folderCreated(qint64 id, const QString &name)
     beginInsertRows(QModelIndex(), rowCount(), rowCount());
 
     d->folders.append(new Folder(id, name, 0, 0, 0));
+    d->indexRows(d->folders.size() - 1);
 
     endInsertRows();
 }
@@ -230,9 +271,12 @@ void AbstractFolderModel::foldersRequested(const QList<QPair<qint64, QString> >
 
             if (!fs.isEmpty()) {
 
-                beginInsertRows(QModelIndex(), rowCount(), rowCount() + fs.count() - 1);
+                const int first = rowCount();
+
+                beginInsertRows(QModelIndex(), first, first + fs.count() - 1);
 
                 d->folders.append(fs);
+                d->indexRows(first);
 
                 endInsertRows();
             }
@@ -240,22 +284,7 @@ void AbstractFolderModel::foldersRequested(const QList<QPair<qint64, QString> >
     }
 
     if (!deletedFolders.isEmpty()) {
-
-        for (qint64 id : deletedFolders) {
-
-            int idx = d->rowByID(id);
-
-            if (idx > -1) {
-
-                beginRemoveRows(QModelIndex(), idx, idx);
-
-                delete d->folders.takeAt(idx);
-
-                endRemoveRows();
-
-            }
-
-        }
+        d->removeRows(deletedFolders, this);
     }
 }
 
@@ -269,13 +298,14 @@ void AbstractFolderModel::folderDeleted(qint64 id)
     int idx = d->rowByID(id);
 
     if (idx < 0) {
-        qWarning("Can not find folder ID in the model. Can not remove folder from model.");
+        qCWarning(FUOTEN_MODELS, "Can not find folder ID in the model. Can not remove folder from model.");
         return;
     }
 
     beginRemoveRows(QModelIndex(), idx, idx);
 
     Folder *f = d->folders.takeAt(idx);
+    d->invalidateIndex();
 
     endRemoveRows();
 
@@ -302,7 +332,7 @@ void AbstractFolderModel::feedsRequested(const IdList &updatedFeeds, const IdLis
 {
     Q_ASSERT_X(storage(), "feeds requested", "no storage available");
 
-    qDebug("%s", "Feeds requested. Updateing folder model.");
+    qCDebug(FUOTEN_MODELS, "%s", "Feeds requested. Updateing folder model.");
 
     if (!updatedFeeds.isEmpty() || !newFeeds.isEmpty() || !deletedFeeds.isEmpty()) {
 
@@ -407,6 +437,7 @@ void AbstractFolderModel::clear()
 
         qDeleteAll(d->folders);
         d->folders.clear();
+        d->invalidateIndex();
 
         endRemoveRows();
     }
@@ -151,6 +151,7 @@ protected Q_SLOTS:
 private:
     Q_DISABLE_COPY(AbstractFolderModel)
     Q_DECLARE_PRIVATE(AbstractFolderModel)
+    friend class AbstractFolderModelPrivate;
 };
 
 }
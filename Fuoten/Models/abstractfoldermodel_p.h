@@ -9,6 +9,7 @@
 #include "abstractfoldermodel.h"
 #include "basemodel_p.h"
 #include "../folder.h"
+#include <QHash>
 
 namespace Fuoten {
 class AbstractFolderModelPrivate : public BaseModelPrivate
@@ -17,9 +18,14 @@ public:
     AbstractFolderModelPrivate();
     ~AbstractFolderModelPrivate() override;
 
-    int rowByID(qint64 id);
+    int rowByID(qint64 id) const;
+    void indexRows(int first);
+    void invalidateIndex();
+    void removeRows(const IdList &ids, AbstractFolderModel *q);
 
     QList<Folder*> folders;
+    mutable QHash<qint64, int> rowsById;
+    mutable bool indexDirty = true;
 
 private:
     Q_DISABLE_COPY(AbstractFolderModelPrivate)
@@ -62,39 +62,55 @@ ArticleListFilterModel::~ArticleListFilterModel()
 
 bool ArticleListFilterModel::filterAcceptsRow(int source_row, const QModelIndex &source_parent) const
 {
-    if (search().isEmpty() && !hideRead()) {
+    Q_UNUSED(source_parent)
+
+    Q_D(const ArticleListFilterModel);
+
+    // in windowed mode the storage filters the articles, reading the records of evicted rows would load them again
+    if ((search().isEmpty() && !hideRead()) || d->alm->isWindowed()) {
         return true;
-    } else if (search().isEmpty() && hideRead()) {
-        return (sourceModel()->data(sourceModel()->index(source_row, 0, source_parent)).value<Article*>()->unread());
+    }
+
+    // the records can be checked without creating an Article object for every row
+    const ArticleRecord r = d->alm->recordAt(source_row);
+
+    if (search().isEmpty() && hideRead()) {
+        return r.unread;
     } else if (!search().isEmpty() && !hideRead()) {
-        return find(sourceModel()->data(sourceModel()->index(source_row, 0, source_parent)).value<Article*>()->title());
+        return find(r.title);
     } else {
-        Article *a = sourceModel()->data(sourceModel()->index(source_row, 0, source_parent)).value<Article*>();
-        return (find(a->title()) && a->unread());
+        return (find(r.title) && r.unread);
     }
 }
 
 
 bool ArticleListFilterModel::lessThan(const QModelIndex &left, const QModelIndex &right) const
 {
-    Article *l;
-    Article *r;
+    Q_D(const ArticleListFilterModel);
+
+    // in windowed mode the storage sorts the articles, keep the order of the source model
+    if (d->alm->isWindowed()) {
+        return left.row() < right.row();
+    }
+
+    ArticleRecord l;
+    ArticleRecord r;
 
     if (sortOrder() == Qt::AscendingOrder) {
-        l = sourceModel()->data(left).value<Article*>();
-        r = sourceModel()->data(right).value<Article*>();
+        l = d->alm->recordAt(left.row());
+        r = d->alm->recordAt(right.row());
     } else {
-        r = sourceModel()->data(left).value<Article*>();
-        l = sourceModel()->data(right).value<Article*>();
+        r = d->alm->recordAt(left.row());
+        l = d->alm->recordAt(right.row());
     }
 
-    if (l->pubDate() < r->pubDate()) {
+    if (l.pubDate < r.pubDate) {
         return true;
-    } else if (l->pubDate() > r->pubDate()) {
+    } else if (l.pubDate > r.pubDate) {
         return false;
     }
 
-    return l->id() < r->id();
+    return l.id < r.id;
 }
 
 
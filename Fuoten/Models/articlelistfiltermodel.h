@@ -20,6 +20,8 @@ class ArticleListFilterModelPrivate;
  * \brief Proxy filter model for ArticleListModel.
  *
  * This proxy model filters and sorts the data of a ArticleListModel that is internally created.
+ * If the underlying model is in windowed mode, the rows are passed through unchanged, because
+ * the storage already sorts and filters them.
  *
  * \headerfile "" <Fuoten/Models/ArticleListFilterModel>
  */
@@ -83,7 +83,7 @@ int ArticleListModel::rowCount(const QModelIndex &parent) const
 {
     Q_UNUSED(parent)
     Q_D(const ArticleListModel);
-    return d->articles.count();
+    return d->records.count();
 }
 
 
@@ -93,10 +93,9 @@ QVariant ArticleListModel::data(const QModelIndex &index, int role) const
         return QVariant();
     }
 
-    Q_D(const ArticleListModel);
-
     if (role == Qt::DisplayRole) {
-        return QVariant::fromValue<Article*>(d->articles.at(index.row()));
+        Article *a = articleAt(index.row());
+        return a ? QVariant::fromValue<Article*>(a) : QVariant();
     } else {
         return QVariant();
     }
@@ -4,6 +4,7 @@
  */
 
 #include "basefiltermodel_p.h"
+#include "../logging_p.h"
 #include "Storage/abstractstorage.h"
 #include <QMetaEnum>
 
@@ -47,7 +48,7 @@ void BaseFilterModel::setSortingRole(FuotenEnums::SortingRole nSortingRole)
     Q_D(BaseFilterModel);
     if (nSortingRole != d->sortingRole) {
         d->sortingRole = nSortingRole;
-        qDebug("Changed sortingRole to %s.", FuotenEnums::staticMetaObject.enumerator(FuotenEnums::staticMetaObject.indexOfEnumerator("Type")).valueToKey(d->sortingRole));
+        qCDebug(FUOTEN_MODELS, "Changed sortingRole to %s.", FuotenEnums::staticMetaObject.enumerator(FuotenEnums::staticMetaObject.indexOfEnumerator("Type")).valueToKey(d->sortingRole));
         Q_EMIT sortingRoleChanged(sortingRole());
         invalidate();
     }
@@ -61,7 +62,7 @@ void BaseFilterModel::setSortOrder(Qt::SortOrder nSortOrder)
     Q_D(BaseFilterModel);
     if (nSortOrder != d->sortOrder) {
         d->sortOrder = nSortOrder;
-        qDebug("Changed sortOrder to %i.", d->sortOrder);
+        qCDebug(FUOTEN_MODELS, "Changed sortOrder to %i.", d->sortOrder);
         Q_EMIT sortOrderChanged(sortOrder());
         invalidate();
     }
@@ -75,7 +76,7 @@ void BaseFilterModel::setSearch(const QString &nSearch)
     Q_D(BaseFilterModel);
     if (nSearch != d->search.pattern()) {
         d->search.setPattern(nSearch);
-        qDebug("Changed search to %s.", qUtf8Printable(d->search.pattern()));
+        qCDebug(FUOTEN_MODELS, "Changed search to %s.", qUtf8Printable(d->search.pattern()));
         Q_EMIT searchChanged(search());
         invalidateFilter();
     }
@@ -96,7 +97,7 @@ void BaseFilterModel::setHideRead(bool nHideRead)
     Q_D(BaseFilterModel);
     if (nHideRead != d->hideRead) {
         d->hideRead = nHideRead;
-        qDebug("Changed hideRead to %s.", d->hideRead ? "true" : "false");
+        qCDebug(FUOTEN_MODELS, "Changed hideRead to %s.", d->hideRead ? "true" : "false");
         Q_EMIT hideReadChanged(hideRead());
         invalidateFilter();
     }
@@ -4,6 +4,7 @@
  */
 
 #include "basemodel_p.h"
+#include "../logging_p.h"
 #include "Storage/abstractstorage.h"
 #include <QMetaEnum>
 
@@ -44,7 +45,7 @@ void BaseModel::setInOperation(bool nInOperation)
     Q_D(BaseModel);
     if (nInOperation != d->inOperation) {
         d->inOperation = nInOperation;
-        qDebug("Changed inOperation to %s.", d->inOperation ? "true" : "false");
+        qCDebug(FUOTEN_MODELS, "Changed inOperation to %s.", d->inOperation ? "true" : "false");
         Q_EMIT inOperationChanged(inOperation());
     }
 }
@@ -58,7 +59,7 @@ void BaseModel::setStorage(AbstractStorage *nStorage)
     if (nStorage != d->storage) {
         AbstractStorage *old = d->storage;
         d->storage = nStorage;
-        qDebug("Changed storage to %p.", d->storage);
+        qCDebug(FUOTEN_MODELS, "Changed storage to %p.", d->storage);
         Q_EMIT storageChanged(storage());
 
         handleStorageChanged(old);
@@ -98,7 +99,7 @@ void BaseModel::setLoaded(bool loaded)
     Q_D(BaseModel);
     if (d->loaded != loaded) {
         d->loaded = loaded;
-        qDebug("Changed loaded to %s.", d->loaded ? "true" : "false");
+        qCDebug(FUOTEN_MODELS, "Changed loaded to %s.", d->loaded ? "true" : "false");
         Q_EMIT loadedChanged(d->loaded);
     }
 }
@@ -111,7 +112,7 @@ void BaseModel::setParentId(qint64 nParentId)
     Q_D(BaseModel);
     if (nParentId != d->parentId) {
         d->parentId = nParentId;
-        qDebug("Changed parentId to %lli.", d->parentId);
+        qCDebug(FUOTEN_MODELS, "Changed parentId to %lli.", d->parentId);
         Q_EMIT parentIdChanged(parentId());
         Q_EMIT doubleParentIdChanged(doubleParentId());
     }
@@ -133,7 +134,7 @@ void BaseModel::setSortingRole(FuotenEnums::SortingRole nSortingRole)
     Q_D(BaseModel);
     if (nSortingRole != d->sortingRole) {
         d->sortingRole = nSortingRole;
-        qDebug("Changed sortinRole to %s.", FuotenEnums::staticMetaObject.enumerator(FuotenEnums::staticMetaObject.indexOfEnumerator("SortingRole")).valueToKey(d->sortingRole));
+        qCDebug(FUOTEN_MODELS, "Changed sortinRole to %s.", FuotenEnums::staticMetaObject.enumerator(FuotenEnums::staticMetaObject.indexOfEnumerator("SortingRole")).valueToKey(d->sortingRole));
         Q_EMIT sortingRoleChanged(sortingRole());
     }
 }
@@ -146,7 +147,7 @@ void BaseModel::setSortOrder(Qt::SortOrder nSortOrder)
     Q_D(BaseModel);
     if (nSortOrder != d->sortOrder) {
         d->sortOrder = nSortOrder;
-        qDebug("Changed sortOrder to %i.", d->sortOrder);
+        qCDebug(FUOTEN_MODELS, "Changed sortOrder to %i.", d->sortOrder);
         Q_EMIT sortOrderChanged(sortOrder());
     }
 }
@@ -159,7 +160,7 @@ void BaseModel::setUnreadOnly(bool nUnreadOnly)
     Q_D(BaseModel);
     if (nUnreadOnly != d->unreadOnly) {
         d->unreadOnly = nUnreadOnly;
-        qDebug("Changed unreadOnly to %s.", d->unreadOnly ? "true" : "false");
+        qCDebug(FUOTEN_MODELS, "Changed unreadOnly to %s.", d->unreadOnly ? "true" : "false");
         Q_EMIT unreadOnlyChanged(unreadOnly());
     }
 }
@@ -172,7 +173,7 @@ void BaseModel::setLimit(int nLimit)
     Q_D(BaseModel);
     if (nLimit != d->limit) {
         d->limit = nLimit;
-        qDebug("Changed limit to %i.", d->limit);
+        qCDebug(FUOTEN_MODELS, "Changed limit to %i.", d->limit);
         Q_EMIT limitChanged(limit());
     }
 }
@@ -4,6 +4,7 @@
  */
 
 #include "feedlistfiltermodel_p.h"
+#include "../logging_p.h"
 #include "../Storage/abstractstorage.h"
 #include "../feed.h"
 #include <QLocale>
@@ -234,7 +235,7 @@ void FeedListFilterModel::setRespectPinned(bool nRespectPinned)
     Q_D(FeedListFilterModel);
     if (nRespectPinned != d->respectPinned) {
         d->respectPinned = nRespectPinned;
-        qDebug("Changed respectPinned to %s.", d->respectPinned ? "true" : "false");
+        qCDebug(FUOTEN_MODELS, "Changed respectPinned to %s.", d->respectPinned ? "true" : "false");
         Q_EMIT respectPinnedChanged(respectPinned());
         invalidate();
     }
@@ -247,7 +248,7 @@ void FeedListFilterModel::setSortByFolder(bool nSortByFolder)
     Q_D(FeedListFilterModel);
     if (nSortByFolder != d->sortByFolder) {
         d->sortByFolder = nSortByFolder;
-        qDebug("Changed sortByFolder to %s.", d->sortByFolder ? "true" : "false");
+        qCDebug(FUOTEN_MODELS, "Changed sortByFolder to %s.", d->sortByFolder ? "true" : "false");
         Q_EMIT sortByFolderChanged(sortByFolder());
         invalidate();
     }
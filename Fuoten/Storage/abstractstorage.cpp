@@ -4,18 +4,25 @@
  */
 
 #include "abstractstorage_p.h"
+#include "../logging_p.h"
 #include "../article.h"
 #include "../Helpers/abstractconfiguration.h"
 #include "../API/component.h"
 #include <QRegularExpression>
 #include <QJsonValue>
+#include <QJsonObject>
+#include <QJsonDocument>
+#include <QTimer>
+#include <QMap>
 #include <cmath>
 
 using namespace Fuoten;
 
 AbstractStoragePrivate::AbstractStoragePrivate()
 {
-
+    // needed for queued connections from storage worker threads
+    qRegisterMetaType<Fuoten::ArticleRecordList>("Fuoten::ArticleRecordList");
+    qRegisterMetaType<Fuoten::ArticleChangeSet>("Fuoten::ArticleChangeSet");
 }
 
 AbstractStoragePrivate::~AbstractStoragePrivate()
@@ -46,7 +53,7 @@ void AbstractStorage::setReady(bool nReady)
     Q_D(AbstractStorage);
     if (nReady != d->ready) {
         d->ready = nReady;
-        qDebug("Changed ready to %s.", d->ready ? "true" : "false");
+        qCDebug(FUOTEN_STORAGE, "Changed ready to %s.", d->ready ? "true" : "false");
         Q_EMIT readyChanged(ready());
     }
 }
@@ -71,12 +78,12 @@ void AbstractStorage::setError(Error *nError)
                 d->error = nError;
             } else {
                 d->error = new Error(nError->type(), nError->severity(), nError->text(), nError->data(), this);
-                qWarning("Failed to move Error object to this thread. Creating deep copy.");
+                qCWarning(FUOTEN_STORAGE, "Failed to move Error object to this thread. Creating deep copy.");
             }
         } else {
             d->error = new Error(nError->type(), nError->severity(), nError->text(), nError->data(), this);
         }
-        qDebug("Changed error to %p.", d->error);
+        qCDebug(FUOTEN_STORAGE, "Changed error to %p.", d->error);
         Q_EMIT errorChanged(error());
 
         if (old && old->parent() == this) {
@@ -93,7 +100,7 @@ void AbstractStorage::setTotalUnread(int nTotalUnread)
     Q_D(AbstractStorage);
     if (nTotalUnread != d->totalUnread) {
         d->totalUnread = nTotalUnread;
-        qDebug("Changed totalUnread to %i.", d->totalUnread);
+        qCDebug(FUOTEN_STORAGE, "Changed totalUnread to %i.", d->totalUnread);
         Q_EMIT totalUnreadChanged(totalUnread());
     }
 }
@@ -106,7 +113,7 @@ void AbstractStorage::setStarred(int nStarred)
     Q_D(AbstractStorage);
     if (nStarred != d->starred) {
         d->starred = nStarred;
-        qDebug("Changed starred to %i.", d->starred);
+        qCDebug(FUOTEN_STORAGE, "Changed starred to %i.", d->starred);
         Q_EMIT starredChanged(starred());
     }
 }
@@ -133,6 +140,115 @@ void AbstractStorage::getArticlesAsync(const QueryArgs &args)
 }
 
 
+ArticleRecordList AbstractStorage::getArticleRecords(const QueryArgs &args)
+{
+    const ArticleList articles = getArticles(args);
+
+    ArticleRecordList records;
+    records.reserve(articles.size());
+    for (const Article *a : articles) {
+        records.append(a->toRecord());
+    }
+    qDeleteAll(articles);
+
+    return records;
+}
+
+
+StorageRequest AbstractStorage::getArticleRecordsAsync(const QueryArgs &args)
+{
+    const StorageRequest request = StorageRequest::create();
+    const auto records = getArticleRecords(args);
+
+    // the caller has to know the request before the result arrives
+    QTimer::singleShot(0, this, [this, request, records] () {
+        if (!request.isCanceled()) {
+            Q_EMIT gotArticleRecordsAsync(request.id(), records);
+        }
+    });
+
+    return request;
+}
+
+
+int AbstractStorage::countArticles(const QueryArgs &args)
+{
+    const ArticleCountList counts = countArticlesGrouped(args, FuotenEnums::NoGrouping);
+    return counts.isEmpty() ? 0 : counts.first().total;
+}
+
+
+ArticleCountList AbstractStorage::countArticlesGrouped(const QueryArgs &args, FuotenEnums::ArticleGrouping grouping)
+{
+    QueryArgs countArgs = args;
+    countArgs.limit = 0;
+    countArgs.bodyLimit = -1;
+    countArgs.cursorId = -1;
+    countArgs.searchSnippetTokens = 0;
+
+    const ArticleRecordList records = getArticleRecords(countArgs);
+
+    QMap<qint64, ArticleCount> groups;
+    for (const ArticleRecord &r : records) {
+        qint64 group = 0;
+        switch (grouping) {
+        case FuotenEnums::GroupByFeed:
+            group = r.feedId;
+            break;
+        case FuotenEnums::GroupByFolder:
+            group = r.folderId;
+            break;
+        case FuotenEnums::GroupByUnread:
+            group = r.unread ? 1 : 0;
+            break;
+        case FuotenEnums::GroupByStarred:
+            group = r.starred ? 1 : 0;
+            break;
+        case FuotenEnums::GroupByDay:
+            group = r.pubDate - (r.pubDate % 86400);
+            break;
+        default:
+            break;
+        }
+
+        ArticleCount &c = groups[group];
+        c.group = group;
+        c.total++;
+        if (r.unread) {
+            c.unread++;
+        }
+        if (r.starred) {
+            c.starred++;
+        }
+    }
+
+    ArticleCountList counts;
+    counts.reserve(groups.size());
+    for (const ArticleCount &c : groups) {
+        counts.append(c);
+    }
+
+    return counts;
+}
+
+
+void AbstractStorage::itemsBatchRequested(const QJsonArray &items, bool lastBatch)
+{
+    Q_D(AbstractStorage);
+
+    for (const QJsonValue &i : items) {
+        d->pendingItems.append(i);
+    }
+
+    if (lastBatch) {
+        QJsonObject o;
+        o.insert(QStringLiteral("items"), d->pendingItems);
+        d->pendingItems = QJsonArray();
+        itemsRequested(QJsonDocument(o));
+    }
+}
+
+
 bool AbstractStorage::enqueueItem(FuotenEnums::QueueAction action, Article *article)
 {
     Q_UNUSED(action)
@@ -141,6 +257,28 @@ bool AbstractStorage::enqueueItem(FuotenEnums::QueueAction action, Article *arti
 }
 
 
+bool AbstractStorage::enqueueItems(FuotenEnums::QueueAction action, const IdList &itemIds)
+{
+    Q_UNUSED(action)
+    Q_UNUSED(itemIds)
+    return false;
+}
+
+
+bool AbstractStorage::enqueueItems(const QMap<FuotenEnums::QueueAction, IdList> &actions)
+{
+    bool ok = true;
+
+    for (auto it = actions.cbegin(), end = actions.cend(); it != end; ++it) {
+        if (!it.value().isEmpty() && !enqueueItems(it.key(), it.value())) {
+            ok = false;
+        }
+    }
+
+    return ok;
+}
+
+
 bool AbstractStorage::enqueueMarkFeedRead(qint64 feedId, qint64 newestItemId)
 {
     Q_UNUSED(feedId)
@@ -170,7 +308,7 @@ void AbstractStorage::setInOperation(bool nInOperation)
     Q_D(AbstractStorage);
     if (nInOperation != d->inOperation) {
         d->inOperation = nInOperation;
-        qDebug("Changed inOperation to %s.", d->inOperation ? "true" : "false");
+        qCDebug(FUOTEN_STORAGE, "Changed inOperation to %s.", d->inOperation ? "true" : "false");
         Q_EMIT inOperationChanged(inOperation());
     }
 }
@@ -191,7 +329,7 @@ void AbstractStorage::setConfiguration(AbstractConfiguration *nConfiguration)
     Q_D(AbstractStorage);
     if (nConfiguration != d->configuration) {
         d->configuration = nConfiguration;
-        qDebug("Changed configuration to %p.", d->configuration);
+        qCDebug(FUOTEN_STORAGE, "Changed configuration to %p.", d->configuration);
         Q_EMIT configurationChanged(configuration());
     }
 }
@@ -212,7 +350,7 @@ void AbstractStorage::setNotificator(AbstractNotificator *notificator)
     Q_D(AbstractStorage);
     if (notificator != d->notificator) {
         d->notificator = notificator;
-        qDebug("Changed notificator to %p.", d->notificator);
+        qCDebug(FUOTEN_STORAGE, "Changed notificator to %p.", d->notificator);
         Q_EMIT notificatorChanged(d->notificator);
     }
 }
@@ -256,7 +394,7 @@ qint64 AbstractStorage::getIdFromJson(const QJsonValue &value)
     } else if (value.type() == QJsonValue::Null) {
         return 0;
     } else {
-        qCritical("Can not convert JSON value to integer ID that is not of type String, Double or Null. Detected type: %i", value.type());
+        qCCritical(FUOTEN_STORAGE, "Can not convert JSON value to integer ID that is not of type String, Double or Null. Detected type: %i", value.type());
         Q_ASSERT_X(false, "get id from json", "not supported json type to convert id to qint64");
         return 0;
     }
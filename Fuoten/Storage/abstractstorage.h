@@ -7,8 +7,15 @@
 #define FUOTENABSTRACTSTORAGE_H
 
 #include <QObject>
+#include <QJsonArray>
+#include <QDateTime>
+#include <QMap>
 #include "../fuoten.h"
 #include "../fuoten_global.h"
+#include "../articlerecord.h"
+#include "../articlecount.h"
+#include "../articlechangeset.h"
+#include "storagerequest.h"
 #include "../Helpers/abstractnotificator.h"
 #include "fuoten_export.h"
 
@@ -32,6 +39,10 @@ struct FUOTEN_EXPORT QueryArgs {
     int limit = 0;                                          /**< Limits the result to the specified number of objects. Defaults to \c 0 to return all objects. */
     int bodyLimit = -1;                                     /**< Only valid for article queries. Limits the size of the body text in number of characters. Values lower than \c 0 will return no body text, \c 0 will return the full body text, any other positive value will return a body stripped from HTML tags and limited to the amount of characters. */
     bool queuedOnly = false;                                /**< Only valid for article queries. Will only return items/articles that are queued. */
+    qint64 cursorId = -1;                                   /**< Only valid for article queries sorted by FuotenEnums::Time or FuotenEnums::ID. If greater than \c -1, only articles are returned that follow the article with this ID in the sort order. Used together with limit for keyset pagination. Defaults to \c -1. \since 0.9.0 */
+    QDateTime cursorPubDate;                                /**< Only valid together with cursorId on article queries sorted by FuotenEnums::Time. Publication date of the article identified by cursorId. \since 0.9.0 */
+    QString search;                                         /**< Only valid for article queries. If not empty, only articles whose title or body contain all words of this search term are returned. The last word also matches as prefix. Use FuotenEnums::Relevance as sortingRole to get the best matches first on Qt::DescendingOrder. \since 0.9.0 */
+    int searchSnippetTokens = 0;                            /**< Only valid together with search. If greater than \c 0, ArticleRecord::snippet will contain an excerpt of the matching text with about this number of words, where the matches are enclosed in \c \<b\> tags. Defaults to \c 0. \since 0.9.0 */
 };
 
 class Folder;
@@ -247,6 +258,52 @@ public:
      */
     virtual void getArticlesAsync(const QueryArgs &args);
 
+    /*!
+     * \brief Returns a list of ArticleRecord values from the local storage.
+     *
+     * See QueryArgs for a list of possible query arguments. In contrast to getArticles() this does not
+     * create an Article object for every result. The default implementation converts the result of getArticles().
+     * Reimplement it to query the records directly.
+     *
+     * \since 0.9.0
+     */
+    virtual ArticleRecordList getArticleRecords(const QueryArgs &args);
+
+    /*!
+     * \brief Invokes a query for ArticleRecord values from the local storage, limited by \a args.
+     *
+     * Returns a handle for the request that can be used to cancel it. This should emit the gotArticleRecordsAsync()
+     * signal containing the ID of the returned request and the list of records, but not if the request has been
+     * canceled. The signal must not be emitted before this function returned. The default implementation is not
+     * really asynchronous, it simply calls getArticleRecords() and emits gotArticleRecordsAsync() with the return
+     * value of that function on the next event loop iteration.
+     *
+     * \since 0.9.0
+     */
+    virtual StorageRequest getArticleRecordsAsync(const QueryArgs &args);
+
+    /*!
+     * \brief Returns the number of articles in the local storage that match \a args.
+     *
+     * QueryArgs::limit, the cursor and the sorting of \a args are ignored. The default implementation
+     * counts the result of getArticleRecords(), reimplement it to count the articles directly.
+     *
+     * \since 0.9.0
+     */
+    virtual int countArticles(const QueryArgs &args);
+
+    /*!
+     * \brief Returns the number of articles in the local storage that match \a args, grouped by \a grouping.
+     *
+     * Every group contains the total, unread and starred count of its articles. Groups without articles
+     * are not part of the list, the list is sorted ascending by ArticleCount::group. QueryArgs::limit,
+     * the cursor and the sorting of \a args are ignored. The default implementation counts the result of
+     * getArticleRecords(), reimplement it to count the articles directly.
+     *
+     * \since 0.9.0
+     */
+    virtual ArticleCountList countArticlesGrouped(const QueryArgs &args, FuotenEnums::ArticleGrouping grouping);
+
 
 
     /*!
@@ -287,6 +344,40 @@ public:
      */
     virtual bool enqueueItem(FuotenEnums::QueueAction action, Article *article);
 
+    /*!
+     * \brief Enqueues an \a action for all articles identified by \a itemIds.
+     *
+     * Bulk version of enqueueItem() that should perform the action for the whole set of articles at once,
+     * for example inside a single transaction. After the articles have been enqueued, emit the markedItems()
+     * or the starredItems() signal.
+     *
+     * The default implementation does nothing and returns \c false.
+     *
+     * \since 0.9.0
+     *
+     * \param action    the action that should be enqueued
+     * \param itemIds   IDs of the articles that should be enqueued
+     * \return \c true if the enqueue was successful, otherwise \c false
+     */
+    virtual bool enqueueItems(FuotenEnums::QueueAction action, const IdList &itemIds);
+
+    /*!
+     * \brief Enqueues several \a actions at once.
+     *
+     * Overload of enqueueItems() that gets the IDs of the articles mapped by the action that should
+     * be enqueued for them. Reimplement this to write all actions in a single transaction. It is used
+     * by ArticleActionCoalescer to flush the collected actions.
+     *
+     * The default implementation calls enqueueItems(FuotenEnums::QueueAction, const IdList&) for
+     * every non-empty list and returns \c false if one of the calls failed.
+     *
+     * \since 0.9.0
+     *
+     * \param actions   IDs of the articles mapped by the action that should be enqueued
+     * \return \c true if the enqueue was successful, otherwise \c false
+     */
+    virtual bool enqueueItems(const QMap<FuotenEnums::QueueAction, IdList> &actions);
+
     /*!
      * \brief Adds all articles older than \a newestItemId in the feed identified by \a feedId as read to the local queue.
      *
@@ -564,6 +655,27 @@ public Q_SLOTS:
      */
     virtual void itemsRequested(const QJsonDocument &json) = 0;
 
+    /*!
+     * \brief Receives a batch of items from a streamed GetItems or GetUpdatedItems request.
+     *
+     * If streaming is enabled on GetItems or GetUpdatedItems, the \c "items" array of the reply
+     * is not delivered as a whole to itemsRequested(). Instead it will be split into batches of
+     * item objects that are delivered in the order they have been received. The last call of a
+     * request will have \a lastBatch set to \c true, it might contain an empty \a items array.
+     *
+     * Reimplement this in a derived class to store the batches as soon as they arrive. Emit
+     * requestedItems() only once after the last batch has been processed.
+     *
+     * The default implementation collects all batches and calls itemsRequested() with the
+     * combined data after the last batch has been received.
+     *
+     * \since 0.9.0
+     *
+     * \param items      array of JSON item objects as described in itemsRequested()
+     * \param lastBatch  \c true if this is the last batch of the current request
+     */
+    virtual void itemsBatchRequested(const QJsonArray &items, bool lastBatch);
+
     /*!
      * \brief Receives the reply data for the MarkItems request.
      *
@@ -823,6 +935,19 @@ Q_SIGNALS:
      */
     void requestedItems(const Fuoten::IdList &updatedItems, const Fuoten::IdList &newItems, const Fuoten::IdList &deletedItems);
 
+    /*!
+     * \brief Emit this right before requestedItems() if the records of the changed articles are available.
+     *
+     * Models will update their rows from \a changes and ignore the following requestedItems() signal, so
+     * \a changes has to contain all articles that are part of the requestedItems() signal. Do not emit
+     * this signal if the records are not available, models will query the changed articles on their own then.
+     *
+     * \since 0.9.0
+     *
+     * \param changes  records of the new and updated articles and IDs of the removed articles
+     */
+    void articlesChanged(const Fuoten::ArticleChangeSet &changes);
+
     /*!
      * \brief Emit this after items/articles have been marked as read or unread.
      *
@@ -892,6 +1017,16 @@ Q_SIGNALS:
      */
     void gotArticlesAsync(const Fuoten::ArticleList &articles);
 
+    /*!
+     * \brief Emit this after getArticleRecordsAsync() has been called and articles have been queried.
+     *
+     * \since 0.9.0
+     *
+     * \param requestId   StorageRequest::id() of the request returned by getArticleRecordsAsync()
+     * \param records     list of ArticleRecord values
+     */
+    void gotArticleRecordsAsync(int requestId, const Fuoten::ArticleRecordList &records);
+
     /*!
      * \brief This is emitted if the value of the \link AbstractStorage::inOperation inOperation \endlink property changes.
      * \sa AbstractStorage::inOperation(), AbstractStorage::setInOperation()
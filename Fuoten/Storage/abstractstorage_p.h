@@ -8,6 +8,7 @@
 
 #include "abstractstorage.h"
 #include "../error.h"
+#include <QJsonArray>
 
 namespace Fuoten {
 
@@ -22,6 +23,7 @@ public:
     AbstractConfiguration *configuration = nullptr;
     AbstractNotificator *notificator = nullptr;
     Error *error = nullptr;
+    QJsonArray pendingItems;
     int totalUnread = 0;
     int starred = 0;
     bool ready = false;
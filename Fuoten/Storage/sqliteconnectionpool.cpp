@@ -0,0 +1,152 @@
+/*
+ * SPDX-FileCopyrightText: (C) 2016-2022 Matthias Fehring <https://www.huessenbergnetz.de>
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#include "sqliteconnectionpool_p.h"
+#include "../logging_p.h"
+#include "sqlitestatementcache_p.h"
+#include <QSqlQuery>
+#include <QSqlError>
+#include <QStringList>
+#include <QThread>
+#include <QThreadStorage>
+#include <QSemaphore>
+#include <QHash>
+
+using namespace Fuoten;
+
+namespace {
+
+/*
+ * Connection names and statement caches of a single thread. Destroyed by QThreadStorage when
+ * the thread finishes, what closes and removes the connections of that thread.
+ */
+struct ThreadConnections
+{
+    ~ThreadConnections()
+    {
+        // prepared statements have to be finalized before their connection can be closed
+        qDeleteAll(caches);
+        caches.clear();
+
+        for (const QString &name : names) {
+            {
+                QSqlDatabase db = QSqlDatabase::database(name, false);
+                db.close();
+            }
+            QSqlDatabase::removeDatabase(name);
+        }
+    }
+
+    QStringList names;
+    QHash<QString, SQLiteStatementCache*> caches;
+};
+
+Q_GLOBAL_STATIC(QThreadStorage<ThreadConnections*>, threadConnections)
+Q_GLOBAL_STATIC_WITH_ARGS(QSemaphore, readerSlots, (SQLiteConnectionPool::maxReaders()))
+
+}
+
+constexpr int SQLiteConnectionPool::busyTimeout;
+
+
+QSqlDatabase SQLiteConnectionPool::database(const QString &dbpath, Mode mode)
+{
+    const QString name = connectionName(dbpath, mode);
+
+    if (QSqlDatabase::contains(name)) {
+        return QSqlDatabase::database(name);
+    }
+
+    QSqlDatabase db = QSqlDatabase::addDatabase(QStringLiteral("QSQLITE"), name);
+    db.setDatabaseName(dbpath);
+    if (mode == ReadOnly) {
+        db.setConnectOptions(QStringLiteral("QSQLITE_BUSY_TIMEOUT=%1;QSQLITE_OPEN_READONLY").arg(busyTimeout));
+    } else {
+        db.setConnectOptions(QStringLiteral("QSQLITE_BUSY_TIMEOUT=%1").arg(busyTimeout));
+    }
+
+    if (!threadConnections()->hasLocalData()) {
+        threadConnections()->setLocalData(new ThreadConnections);
+    }
+    threadConnections()->localData()->names.append(name);
+
+    if (Q_UNLIKELY(!db.open())) {
+        qCWarning(FUOTEN_STORAGE, "Failed to open SQLite database %s: %s", qUtf8Printable(dbpath), qUtf8Printable(db.lastError().text()));
+        return db;
+    }
+
+    qCDebug(FUOTEN_STORAGE, "Opened %s SQLite connection %s.", mode == ReadOnly ? "read-only" : "read-write", qUtf8Printable(name));
+
+    QSqlQuery q(db);
+
+    bool qresult = q.exec(QStringLiteral("PRAGMA foreign_keys = ON"));
+    Q_ASSERT_X(qresult, "open database connection", "failed to enable foreign keys support");
+
+    if (mode == ReadWrite) {
+        // in WAL mode this is still safe against corruption, only the last commits might be lost on power failure
+        qresult = q.exec(QStringLiteral("PRAGMA synchronous = NORMAL"));
+        Q_ASSERT_X(qresult, "open database connection", "failed to set synchronous mode");
+    }
+
+    return db;
+}
+
+
+SQLiteStatementCache *SQLiteConnectionPool::statements(const QString &dbpath, Mode mode)
+{
+    const QSqlDatabase db = database(dbpath, mode);
+    const QString name = connectionName(dbpath, mode);
+
+    ThreadConnections *tc = threadConnections()->localData();
+    SQLiteStatementCache *cache = tc->caches.value(name);
+    if (!cache) {
+        cache = new SQLiteStatementCache(db);
+        tc->caches.insert(name, cache);
+    }
+
+    return cache;
+}
+
+
+int SQLiteConnectionPool::maxReaders()
+{
+    return qMax(2, QThread::idealThreadCount());
+}
+
+
+QString SQLiteConnectionPool::connectionName(const QString &dbpath, Mode mode)
+{
+    return QStringLiteral("fuotendb_%1_%2_%3").arg(mode == ReadOnly ? QStringLiteral("ro") : QStringLiteral("rw"),
+                                                   QString::number(qHash(dbpath)),
+                                                   QString::number(reinterpret_cast<quintptr>(QThread::currentThreadId())));
+}
+
+
+SQLiteReader::SQLiteReader(const QString &dbpath)
+{
+    readerSlots()->acquire();
+    m_db = SQLiteConnectionPool::database(dbpath, SQLiteConnectionPool::ReadOnly);
+    m_statements = SQLiteConnectionPool::statements(dbpath, SQLiteConnectionPool::ReadOnly);
+}
+
+
+SQLiteReader::~SQLiteReader()
+{
+    m_statements = nullptr;
+    m_db = QSqlDatabase();
+    readerSlots()->release();
+}
+
+
+QSqlDatabase SQLiteReader::database() const
+{
+    return m_db;
+}
+
+
+SQLiteStatementCache *SQLiteReader::statements() const
+{
+    return m_statements;
+}
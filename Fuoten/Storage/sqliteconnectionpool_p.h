@@ -0,0 +1,101 @@
+/*
+ * SPDX-FileCopyrightText: (C) 2016-2022 Matthias Fehring <https://www.huessenbergnetz.de>
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#ifndef FUOTENSQLITECONNECTIONPOOL_P_H
+#define FUOTENSQLITECONNECTIONPOOL_P_H
+
+#include <QSqlDatabase>
+#include <QString>
+
+namespace Fuoten {
+
+class SQLiteStatementCache;
+
+/*!
+ * \internal
+ * \brief Hands out SQLite connections that are bound to the calling thread.
+ *
+ * QtSql connections must only be used from the thread that created them. The pool creates
+ * one read-write and one read-only connection per thread and database file on first use and
+ * removes them when the thread finishes.
+ *
+ * The database uses the WAL journal mode, so readers see the last committed state while a writer
+ * is in a transaction and the writer does not have to wait for readers. SQLite itself only allows
+ * one writer at a time, connections of concurrent writers wait up to busyTimeout milliseconds
+ * for the write lock.
+ */
+class SQLiteConnectionPool
+{
+public:
+    enum Mode : quint8 {
+        ReadWrite,
+        ReadOnly
+    };
+
+    /*!
+     * \brief Timeout in milliseconds a connection waits for a lock held by another connection.
+     */
+    static constexpr int busyTimeout = 10000;
+
+    /*!
+     * \brief Returns the connection to \a dbpath for the current thread in the given \a mode.
+     *
+     * The connection is already open and has foreign key support enabled. If the connection
+     * could not be opened, the returned database will not be open and lastError() will contain
+     * the reason. Do not keep copies of the returned object after the thread has finished.
+     */
+    static QSqlDatabase database(const QString &dbpath, Mode mode = ReadWrite);
+
+    /*!
+     * \brief Returns the statement cache of the connection to \a dbpath for the current thread in the given \a mode.
+     *
+     * The cache will be created together with the connection if necessary and gets destroyed before
+     * the connection is removed. Do not use the returned pointer after the thread has finished.
+     */
+    static SQLiteStatementCache *statements(const QString &dbpath, Mode mode = ReadWrite);
+
+    /*!
+     * \brief Returns the maximum number of threads that can hold a read-only connection at the same time.
+     */
+    static int maxReaders();
+
+private:
+    static QString connectionName(const QString &dbpath, Mode mode);
+};
+
+
+/*!
+ * \internal
+ * \brief Holds a read-only connection of the current thread for its lifetime.
+ *
+ * At most SQLiteConnectionPool::maxReaders() readers can exist at the same time, the
+ * constructor blocks until a slot is free.
+ */
+class SQLiteReader
+{
+public:
+    explicit SQLiteReader(const QString &dbpath);
+    ~SQLiteReader();
+
+    /*!
+     * \brief Returns the read-only connection of the current thread.
+     */
+    QSqlDatabase database() const;
+
+    /*!
+     * \brief Returns the statement cache of the read-only connection of the current thread.
+     */
+    SQLiteStatementCache *statements() const;
+
+private:
+    Q_DISABLE_COPY(SQLiteReader)
+
+    QSqlDatabase m_db;
+    SQLiteStatementCache *m_statements = nullptr;
+};
+
+}
+
+#endif // FUOTENSQLITECONNECTIONPOOL_P_H
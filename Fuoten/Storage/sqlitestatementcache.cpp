@@ -0,0 +1,139 @@
+/*
+ * SPDX-FileCopyrightText: (C) 2016-2022 Matthias Fehring <https://www.huessenbergnetz.de>
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#include "sqlitestatementcache_p.h"
+#include "../logging_p.h"
+#include <QSqlError>
+
+using namespace Fuoten;
+
+SQLiteStatementCache::SQLiteStatementCache(const QSqlDatabase &db) :
+    m_db(db)
+{
+
+}
+
+
+SQLiteStatementCache::~SQLiteStatementCache()
+{
+    clear();
+}
+
+
+void SQLiteStatementCache::setDatabase(const QSqlDatabase &db)
+{
+    clear();
+    m_db = db;
+}
+
+
+QSqlQuery *SQLiteStatementCache::query(const QString &sql, bool *ok)
+{
+    QSqlQuery *q = m_queries.value(sql, nullptr);
+
+    if (q) {
+        // reset the statement, a not finished SELECT would otherwise keep its read lock
+        q->finish();
+        setActive(q);
+        if (ok) {
+            *ok = true;
+        }
+        return q;
+    }
+
+    q = new QSqlQuery(m_db);
+    q->setForwardOnly(true);
+
+    if (Q_LIKELY(q->prepare(sql))) {
+        m_queries.insert(sql, q);
+        setActive(q);
+        if (ok) {
+            *ok = true;
+        }
+        return q;
+    }
+
+    qCWarning(FUOTEN_STORAGE, "Failed to prepare SQL statement \"%s\": %s", qUtf8Printable(sql), qUtf8Printable(q->lastError().text()));
+
+    setActive(nullptr);
+    delete m_uncached;
+    m_uncached = q;
+
+    if (ok) {
+        *ok = false;
+    }
+
+    return q;
+}
+
+
+QSqlQuery *SQLiteStatementCache::exec(const QString &sql, bool *ok)
+{
+    bool prepared = false;
+    QSqlQuery *q = query(sql, &prepared);
+    const bool executed = prepared && q->exec();
+    if (ok) {
+        *ok = executed;
+    }
+    return q;
+}
+
+
+QSqlQuery *SQLiteStatementCache::prepareUncached(const QString &sql, bool *ok)
+{
+    setActive(nullptr);
+    delete m_uncached;
+    m_uncached = new QSqlQuery(m_db);
+    m_uncached->setForwardOnly(true);
+    m_active = m_uncached;
+
+    const bool prepared = m_uncached->prepare(sql);
+    if (ok) {
+        *ok = prepared;
+    }
+
+    return m_uncached;
+}
+
+
+QSqlQuery *SQLiteStatementCache::execUncached(const QString &sql, bool *ok)
+{
+    bool prepared = false;
+    QSqlQuery *q = prepareUncached(sql, &prepared);
+    const bool executed = prepared && q->exec();
+    if (ok) {
+        *ok = executed;
+    }
+    return q;
+}
+
+
+void SQLiteStatementCache::clear()
+{
+    m_active = nullptr;
+    qDeleteAll(m_queries);
+    m_queries.clear();
+    delete m_uncached;
+    m_uncached = nullptr;
+}
+
+
+void SQLiteStatementCache::setActive(QSqlQuery *q)
+{
+    // callers have to finish statements whose results they do not read completely, a
+    // SELECT that is still in use by an outer loop would otherwise keep its read lock or
+    // hint at a nested use of the same connection
+    if (Q_UNLIKELY(m_active && (m_active != q) && m_active->isActive() && m_active->isSelect() && (m_active->at() != QSql::AfterLastRow))) {
+        qCCritical(FUOTEN_STORAGE, "The previous SQL statement \"%s\" has not been finished. Finishing it now.", qUtf8Printable(m_active->lastQuery()));
+        m_active->finish();
+    }
+    m_active = q;
+}
+
+
+int SQLiteStatementCache::count() const
+{
+    return m_queries.count();
+}
@@ -0,0 +1,98 @@
+/*
+ * SPDX-FileCopyrightText: (C) 2016-2022 Matthias Fehring <https://www.huessenbergnetz.de>
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#ifndef FUOTENSQLITESTATEMENTCACHE_P_H
+#define FUOTENSQLITESTATEMENTCACHE_P_H
+
+#include <QSqlDatabase>
+#include <QSqlQuery>
+#include <QHash>
+#include <QString>
+
+namespace Fuoten {
+
+/*!
+ * \internal
+ * \brief Caches prepared SQL statements of a single database connection.
+ *
+ * Statements are keyed by their SQL text, so SQLite only has to parse and plan
+ * a statement the first time it is requested. Only use this for SQL with a fixed
+ * text and bound values, never for statements that contain inlined values.
+ *
+ * A cache must only be used from the thread that owns the connection. Statements
+ * are not finished implicitly, callers have to call QSqlQuery::finish() on a SELECT
+ * whose result they do not read up to the end before they request the next statement.
+ * Otherwise the cache logs an error and finishes the previous statement itself.
+ */
+class SQLiteStatementCache
+{
+public:
+    explicit SQLiteStatementCache(const QSqlDatabase &db = QSqlDatabase());
+    ~SQLiteStatementCache();
+
+    /*!
+     * \brief Clears the cache and sets the connection to use to \a db.
+     */
+    void setDatabase(const QSqlDatabase &db);
+
+    /*!
+     * \brief Returns the prepared statement for \a sql.
+     *
+     * If the statement is already in the cache, it will be reset and returned, otherwise it
+     * will be prepared and added to the cache. \a ok will be set to \c false if the statement
+     * could not be prepared, the returned query will than contain the error. The returned
+     * pointer is owned by the cache and stays valid until the cache is cleared.
+     */
+    QSqlQuery *query(const QString &sql, bool *ok = nullptr);
+
+    /*!
+     * \brief Prepares and executes the cached statement for \a sql without bound values.
+     *
+     * \a ok will be set to \c false if either the preparation or the execution failed.
+     */
+    QSqlQuery *exec(const QString &sql, bool *ok = nullptr);
+
+    /*!
+     * \brief Prepares \a sql without adding it to the cache.
+     *
+     * Use this for statements whose SQL text changes with every call. The returned query is
+     * owned by the cache and stays valid until the next call of prepareUncached(), execUncached()
+     * or clear().
+     */
+    QSqlQuery *prepareUncached(const QString &sql, bool *ok = nullptr);
+
+    /*!
+     * \brief Prepares and executes \a sql without adding it to the cache.
+     * \sa prepareUncached()
+     */
+    QSqlQuery *execUncached(const QString &sql, bool *ok = nullptr);
+
+    /*!
+     * \brief Removes all statements from the cache.
+     *
+     * Has to be called before schema changes like dropping tables that are used by
+     * cached statements.
+     */
+    void clear();
+
+    /*!
+     * \brief Returns the number of cached statements.
+     */
+    int count() const;
+
+private:
+    Q_DISABLE_COPY(SQLiteStatementCache)
+
+    void setActive(QSqlQuery *q);
+
+    QSqlDatabase m_db;
+    QHash<QString, QSqlQuery*> m_queries;
+    QSqlQuery *m_uncached = nullptr;
+    QSqlQuery *m_active = nullptr;
+};
+
+}
+
+#endif // FUOTENSQLITESTATEMENTCACHE_P_H
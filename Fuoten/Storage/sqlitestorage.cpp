@@ -4,6 +4,7 @@
  */
 
 #include "sqlitestorage_p.h"
+#include "../logging_p.h"
 #include <QJsonDocument>
 #include <QJsonArray>
 #include <QJsonObject>
@@ -13,6 +14,8 @@
 #include <QDateTime>
 #include <QVariant>
 #include <QRegularExpression>
+#include <QTimer>
+#include <QSet>
 #include "../folder.h"
 #include "../feed.h"
 #include "../article.h"
@@ -24,14 +27,9 @@ using namespace Fuoten;
 
 
 SQLiteStorageManager::SQLiteStorageManager(const QString &dbpath, QObject *parent) :
-    QThread(parent), m_currentDbVersion(0)
+    QThread(parent), m_dbpath(dbpath), m_currentDbVersion(0)
 {
-    if (!QSqlDatabase::connectionNames().contains(QStringLiteral("fuotendb"))) {
-        m_db = QSqlDatabase::addDatabase(QStringLiteral("QSQLITE"), QStringLiteral("fuotendb"));
-        m_db.setDatabaseName(dbpath);
-    } else {
-        m_db = QSqlDatabase::database(QStringLiteral("fuotendb"));
-    }
+
 }
 
 
@@ -53,14 +51,17 @@ void SQLiteStorageManager::setFailed(const QSqlError &sqlError, const QString &t
 
 void SQLiteStorageManager::run()
 {
-    bool result = m_db.open();
+    QSqlDatabase db = SQLiteConnectionPool::database(m_dbpath);
+    bool result = db.isOpen();
     Q_ASSERT_X(result, "init database", "failed to open database");
 
-    qDebug("%s", "Start checking database scheme.");
+    qCDebug(FUOTEN_STORAGE, "%s", "Start checking database scheme.");
+
+    QSqlQuery q(db);
 
-    QSqlQuery q(m_db);
-    result = q.exec(QStringLiteral("PRAGMA foreign_keys = ON"));
-    Q_ASSERT_X(result, "init database", "failed to activate foreign keys");
+    // readers of other threads should not block the writer and vice versa
+    result = q.exec(QStringLiteral("PRAGMA journal_mode = WAL"));
+    Q_ASSERT_X(result, "init database", "failed to enable write-ahead logging");
 
     result = q.exec(QStringLiteral("CREATE TABLE IF NOT EXISTS system "
                                    "(id INTEGER PRIMARY KEY NOT NULL, "
@@ -133,7 +134,7 @@ void SQLiteStorageManager::run()
         Q_ASSERT_X(result, "init database", "failed to drop obsolete trigger");
     }
 
-    result = q.exec(QStringLiteral("CREATE VIEW IF NOT EXISTS total_unread AS SELECT COUNT(id) FROM items WHERE unread = 1"));
+    result = q.exec(QStringLiteral("CREATE VIEW IF NOT EXISTS total_unread AS SELECT IFNULL(SUM(unreadCount), 0) FROM feeds"));
     Q_ASSERT_X(result, "init database", "failed to create total_unread view");
 
     result = q.exec(QStringLiteral("CREATE VIEW IF NOT EXISTS total_starred AS SELECT COUNT(id) FROM items WHERE starred = 1"));
@@ -153,7 +154,7 @@ void SQLiteStorageManager::run()
     }
 
     if (m_currentDbVersion < 2) {
-        qDebug("%s", "Performing database schema upgrade to version 2.");
+        qCDebug(FUOTEN_STORAGE, "%s", "Performing database schema upgrade to version 2.");
 
         result = q.exec(QStringLiteral("ALTER TABLE items ADD COLUMN rtl INTEGER NOT NULL DEFAULT 0"));
         Q_ASSERT_X(result, "init databse", "failed to add column rtl to table items");
@@ -170,20 +171,219 @@ void SQLiteStorageManager::run()
         m_currentDbVersion = 2;
     }
 
+    if (m_currentDbVersion < 3) {
+        qCDebug(FUOTEN_STORAGE, "%s", "Performing database schema upgrade to version 3.");
+
+        // the unread counters of feeds and folders are maintained incrementally from now on,
+        // so bring them in a consistent state once and let the totals rely on them
+        result = q.exec(QStringLiteral("UPDATE feeds SET unreadCount = (SELECT COUNT(id) FROM items WHERE unread = 1 AND feedId = feeds.id)"));
+        Q_ASSERT_X(result, "init database", "failed to recalculate unread count of feeds");
+
+        result = q.exec(QStringLiteral("UPDATE folders SET unreadCount = IFNULL((SELECT SUM(unreadCount) FROM feeds WHERE folderId = folders.id), 0)"));
+        Q_ASSERT_X(result, "init database", "failed to recalculate unread count of folders");
+
+        result = q.exec(QStringLiteral("DROP VIEW IF EXISTS total_unread"));
+        Q_ASSERT_X(result, "init database", "failed to drop total_unread view");
+
+        result = q.exec(QStringLiteral("CREATE VIEW total_unread AS SELECT IFNULL(SUM(unreadCount), 0) FROM feeds"));
+        Q_ASSERT_X(result, "init database", "failed to create total_unread view");
+
+        result = q.exec(QStringLiteral("CREATE INDEX IF NOT EXISTS items_starred_index ON items (feedId) WHERE starred = 1"));
+        Q_ASSERT_X(result, "init database", "failed to create items_starred_index");
+
+        result = q.exec(QStringLiteral("UPDATE system SET value = '3' WHERE key = 'schema_version'"));
+        Q_ASSERT_X(result, "init database", "failed to update schema version in database");
+
+        m_currentDbVersion = 3;
+    }
+
+    if (m_currentDbVersion < 4) {
+        qCDebug(FUOTEN_STORAGE, "%s", "Performing database schema upgrade to version 4.");
+
+        // plain text excerpt of the body that is created once on ingestion, so that list queries
+        // do not have to strip the HTML of every returned body again
+        result = q.exec(QStringLiteral("ALTER TABLE items ADD COLUMN excerpt TEXT"));
+        Q_ASSERT_X(result, "init database", "failed to add column excerpt to table items");
+
+        result = db.transaction();
+        Q_ASSERT_X(result, "init database", "failed to start database transaction");
+
+        QSqlQuery uq(db);
+        result = uq.prepare(QStringLiteral("UPDATE items SET excerpt = ? WHERE id = ?"));
+        Q_ASSERT_X(result, "init database", "failed to prepare updating excerpt of items");
+
+        q.setForwardOnly(true);
+        result = q.exec(QStringLiteral("SELECT id, body FROM items"));
+        Q_ASSERT_X(result, "init database", "failed to query bodies of items");
+
+        while (q.next()) {
+            uq.addBindValue(SQLiteStoragePrivate::excerpt(q.value(1).toString()));
+            uq.addBindValue(q.value(0));
+            result = uq.exec();
+            Q_ASSERT_X(result, "init database", "failed to update excerpt of item");
+        }
+
+        result = q.exec(QStringLiteral("UPDATE system SET value = '4' WHERE key = 'schema_version'"));
+        Q_ASSERT_X(result, "init database", "failed to update schema version in database");
+
+        result = db.commit();
+        Q_ASSERT_X(result, "init database", "failed to commit database transaction");
+
+        m_currentDbVersion = 4;
+    }
+
+    if (m_currentDbVersion < 5) {
+        qCDebug(FUOTEN_STORAGE, "%s", "Performing database schema upgrade to version 5.");
+
+        // bodies are moved into their own table and get compressed, so that the items table
+        // stays small and scans over it do not have to page in the article contents
+        result = q.exec(QStringLiteral("CREATE TABLE IF NOT EXISTS item_bodies "
+                                       "(id INTEGER PRIMARY KEY NOT NULL, "
+                                       "body BLOB NOT NULL, "
+                                       "FOREIGN KEY(id) REFERENCES items(id) ON DELETE CASCADE)"
+                                       ));
+        Q_ASSERT_X(result, "init database", "failed to create item_bodies table");
+
+        result = db.transaction();
+        Q_ASSERT_X(result, "init database", "failed to start database transaction");
+
+        QSqlQuery iq(db);
+        result = iq.prepare(QStringLiteral("INSERT OR REPLACE INTO item_bodies (id, body) VALUES (?, ?)"));
+        Q_ASSERT_X(result, "init database", "failed to prepare insertion of item bodies");
+
+        q.setForwardOnly(true);
+        result = q.exec(QStringLiteral("SELECT id, body FROM items"));
+        Q_ASSERT_X(result, "init database", "failed to query bodies of items");
+
+        while (q.next()) {
+            iq.addBindValue(q.value(0));
+            iq.addBindValue(SQLiteStoragePrivate::compressBody(q.value(1).toString()));
+            result = iq.exec();
+            Q_ASSERT_X(result, "init database", "failed to insert item body");
+        }
+
+        // the old full text index used the body column of the items table as external content
+        for (const QString &trigger : {QStringLiteral("items_fts_insert"), QStringLiteral("items_fts_delete"), QStringLiteral("items_fts_update")}) {
+            result = q.exec(QStringLiteral("DROP TRIGGER IF EXISTS %1").arg(trigger));
+            Q_ASSERT_X(result, "init database", "failed to drop full text search trigger");
+        }
+
+        result = q.exec(QStringLiteral("DROP TABLE IF EXISTS items_fts"));
+        Q_ASSERT_X(result, "init database", "failed to drop full text search table");
+
+        // the column can not be dropped without recreating the table on older SQLite versions
+        result = q.exec(QStringLiteral("UPDATE items SET body = ''"));
+        Q_ASSERT_X(result, "init database", "failed to clear body column of items");
+
+        result = q.exec(QStringLiteral("UPDATE system SET value = '5' WHERE key = 'schema_version'"));
+        Q_ASSERT_X(result, "init database", "failed to update schema version in database");
+
+        result = db.commit();
+        Q_ASSERT_X(result, "init database", "failed to commit database transaction");
+
+        // give the space of the moved bodies back to the file system
+        if (Q_UNLIKELY(!q.exec(QStringLiteral("VACUUM")))) {
+            qCWarning(FUOTEN_STORAGE, "Failed to vacuum the database: %s", qUtf8Printable(q.lastError().text()));
+        }
+
+        m_currentDbVersion = 5;
+    }
+
+    if (m_currentDbVersion < 6) {
+        qCDebug(FUOTEN_STORAGE, "%s", "Performing database schema upgrade to version 6.");
+
+        // article lists are ordered by publication date, either over all items or the items of
+        // feeds and folders, the ID is part of the order for stable keyset pagination
+        result = q.exec(QStringLiteral("CREATE INDEX IF NOT EXISTS items_pubdate_index ON items (pubDate, id)"));
+        Q_ASSERT_X(result, "init database", "failed to create items_pubdate_index");
+
+        result = q.exec(QStringLiteral("CREATE INDEX IF NOT EXISTS items_feed_pubdate_index ON items (feedId, pubDate, id)"));
+        Q_ASSERT_X(result, "init database", "failed to create items_feed_pubdate_index");
+
+        // partial indexes only contain the small subsets of unread, starred and queued items
+        result = q.exec(QStringLiteral("CREATE INDEX IF NOT EXISTS items_unread_pubdate_index ON items (pubDate, id) WHERE unread = 1"));
+        Q_ASSERT_X(result, "init database", "failed to create items_unread_pubdate_index");
+
+        result = q.exec(QStringLiteral("CREATE INDEX IF NOT EXISTS items_unread_feed_index ON items (feedId, pubDate, id) WHERE unread = 1"));
+        Q_ASSERT_X(result, "init database", "failed to create items_unread_feed_index");
+
+        result = q.exec(QStringLiteral("CREATE INDEX IF NOT EXISTS items_starred_pubdate_index ON items (pubDate, id) WHERE starred = 1"));
+        Q_ASSERT_X(result, "init database", "failed to create items_starred_pubdate_index");
+
+        result = q.exec(QStringLiteral("CREATE INDEX IF NOT EXISTS items_queue_index ON items (id) WHERE queue > 0"));
+        Q_ASSERT_X(result, "init database", "failed to create items_queue_index");
+
+        result = q.exec(QStringLiteral("UPDATE system SET value = '6' WHERE key = 'schema_version'"));
+        Q_ASSERT_X(result, "init database", "failed to update schema version in database");
+
+        // gather statistics once, so that the query planner knows how selective the new indexes are
+        result = q.exec(QStringLiteral("ANALYZE"));
+        Q_ASSERT_X(result, "init database", "failed to analyze database");
+
+        m_currentDbVersion = 6;
+    }
+
+    // the full text index is not part of the versioned schema because it depends on
+    // the FTS5 module of the SQLite library, it will be created as soon as it is available
+    result = q.exec(QStringLiteral("SELECT name FROM sqlite_master WHERE type = 'table' AND name = 'items_fts'"));
+    Q_ASSERT_X(result, "init database", "failed to query full text search table");
+
+    if (!q.next()) {
+        // the bodies are stored compressed, so the index has to keep its own copy of the plain text
+        // and gets filled by the ItemsRequestedWorker instead of triggers
+        if (q.exec(QStringLiteral("CREATE VIRTUAL TABLE items_fts USING fts5(title, body)"))) {
+
+            qCDebug(FUOTEN_STORAGE, "%s", "Creating full text search index.");
+
+            result = q.exec(QStringLiteral("CREATE TRIGGER IF NOT EXISTS items_fts_delete AFTER DELETE ON items BEGIN "
+                                           "DELETE FROM items_fts WHERE rowid = old.id; "
+                                           "END"));
+            Q_ASSERT_X(result, "init database", "failed to create items_fts_delete trigger");
+
+            result = db.transaction();
+            Q_ASSERT_X(result, "init database", "failed to start database transaction");
+
+            QSqlQuery iq(db);
+            result = iq.prepare(QStringLiteral("INSERT INTO items_fts (rowid, title, body) VALUES (?, ?, ?)"));
+            Q_ASSERT_X(result, "init database", "failed to prepare insertion into full text search index");
+
+            q.setForwardOnly(true);
+            result = q.exec(QStringLiteral("SELECT it.id, it.title, b.body FROM items it LEFT JOIN item_bodies b ON b.id = it.id"));
+            Q_ASSERT_X(result, "init database", "failed to query items for full text search index");
+
+            while (q.next()) {
+                iq.addBindValue(q.value(0));
+                iq.addBindValue(q.value(1));
+                iq.addBindValue(SQLiteStoragePrivate::plainText(SQLiteStoragePrivate::uncompressBody(q.value(2).toByteArray())));
+                result = iq.exec();
+                Q_ASSERT_X(result, "init database", "failed to insert item into full text search index");
+            }
+
+            result = db.commit();
+            Q_ASSERT_X(result, "init database", "failed to build full text search index");
+
+        } else {
+            qCWarning(FUOTEN_STORAGE, "%s", "SQLite has no FTS5 support. Full text search will fall back to pattern matching on titles and excerpts.");
+        }
+    }
+
+    // updates the statistics of the query planner if they have become outdated, does nothing on SQLite
+    // versions that do not know this pragma
+    q.exec(QStringLiteral("PRAGMA optimize"));
+
     Q_EMIT succeeded();
 
-    qDebug("%s", "Finished checking database scheme.");
+    qCDebug(FUOTEN_STORAGE, "%s", "Finished checking database scheme.");
 }
 
 
-SQLiteStoragePrivate::SQLiteStoragePrivate(const QString &_dbpath) : AbstractStoragePrivate()
+constexpr int SQLiteStoragePrivate::excerptLength;
+constexpr int SQLiteStoragePrivate::maxChangeSetSize;
+
+
+SQLiteStoragePrivate::SQLiteStoragePrivate(const QString &_dbpath) : AbstractStoragePrivate(), dbpath(_dbpath)
 {
-    if (!QSqlDatabase::connectionNames().contains(QStringLiteral("fuotendb"))) {
-        db = QSqlDatabase::addDatabase(QStringLiteral("QSQLITE"), QStringLiteral("fuotendb"));
-        db.setDatabaseName(_dbpath);
-    } else {
-        db = QSqlDatabase::database(QStringLiteral("fuotendb"));
-    }
+    readerPool.setMaxThreadCount(SQLiteConnectionPool::maxReaders());
 }
 
 
@@ -193,7 +393,7 @@ SQLiteStoragePrivate::~SQLiteStoragePrivate()
 }
 
 
-QStringList SQLiteStoragePrivate::intListToStringList(const IdList &ints) const
+QStringList SQLiteStoragePrivate::intListToStringList(const IdList &ints)
 {
     QStringList sl;
 
@@ -210,7 +410,7 @@ QStringList SQLiteStoragePrivate::intListToStringList(const IdList &ints) const
 }
 
 
-QString SQLiteStoragePrivate::intListToString(const IdList &ints) const
+QString SQLiteStoragePrivate::intListToString(const IdList &ints)
 {
     if (ints.isEmpty()) {
         return QString();
@@ -228,6 +428,170 @@ QSqlQuery SQLiteStoragePrivate::getQuery() const
 }
 
 
+/*!
+ * \internal
+ * Fills the temporary bulk_ids table with \a ids. Joining against this table
+ * replaces huge IN (...) lists and is not limited by the maximum number of
+ * SQL variables. Has to be called inside a transaction.
+ */
+bool SQLiteStoragePrivate::fillBulkIds(const IdList &ids)
+{
+    bool qresult = false;
+    statements.exec(QStringLiteral("CREATE TEMP TABLE IF NOT EXISTS bulk_ids (id INTEGER PRIMARY KEY)"), &qresult);
+    if (Q_UNLIKELY(!qresult)) {
+        return false;
+    }
+
+    statements.exec(QStringLiteral("DELETE FROM temp.bulk_ids"), &qresult);
+    if (Q_UNLIKELY(!qresult)) {
+        return false;
+    }
+
+    for (const qint64 id : ids) {
+        QSqlQuery *q = statements.query(QStringLiteral("INSERT OR IGNORE INTO temp.bulk_ids (id) VALUES (?)"), &qresult);
+        if (Q_UNLIKELY(!qresult)) {
+            return false;
+        }
+        q->addBindValue(id);
+        if (Q_UNLIKELY(!q->exec())) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+/*!
+ * \internal
+ * Fills the temporary bulk_guids table with the feed ID and guid hash pairs in \a articles.
+ * Has to be called inside a transaction.
+ */
+bool SQLiteStoragePrivate::fillBulkGuidHashes(const QList<QPair<qint64, QString>> &articles)
+{
+    bool qresult = false;
+    statements.exec(QStringLiteral("CREATE TEMP TABLE IF NOT EXISTS bulk_guids (feedId INTEGER NOT NULL, guidHash TEXT NOT NULL, PRIMARY KEY (feedId, guidHash))"), &qresult);
+    if (Q_UNLIKELY(!qresult)) {
+        return false;
+    }
+
+    statements.exec(QStringLiteral("DELETE FROM temp.bulk_guids"), &qresult);
+    if (Q_UNLIKELY(!qresult)) {
+        return false;
+    }
+
+    for (const QPair<qint64,QString> &p : articles) {
+        QSqlQuery *q = statements.query(QStringLiteral("INSERT OR IGNORE INTO temp.bulk_guids (feedId, guidHash) VALUES (?, ?)"), &qresult);
+        if (Q_UNLIKELY(!qresult)) {
+            return false;
+        }
+        q->addBindValue(p.first);
+        q->addBindValue(p.second);
+        if (Q_UNLIKELY(!q->exec())) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+/*!
+ * \internal
+ * Updates the unread counters of all feeds and folders that contain items from the
+ * bulk_ids table whose unread state differs from \a unread. Has to be called before
+ * the items themselves are updated. Returns the change of the total unread count.
+ */
+int SQLiteStoragePrivate::applyBulkUnreadDeltas(bool unread)
+{
+    bool qresult = false;
+    QSqlQuery *q = statements.query(QStringLiteral("SELECT it.feedId, fe.folderId, COUNT(it.id) FROM temp.bulk_ids b JOIN items it ON it.id = b.id JOIN feeds fe ON fe.id = it.feedId WHERE it.unread = ? GROUP BY it.feedId, fe.folderId"), &qresult);
+    Q_ASSERT_X(qresult, "apply bulk unread deltas", "failed to prepare database query");
+    q->addBindValue(!unread);
+    qresult = q->exec();
+    Q_ASSERT_X(qresult, "apply bulk unread deltas", "failed to execute database query");
+
+    QHash<qint64, int> feedDeltas;
+    QHash<qint64, int> folderDeltas;
+    int total = 0;
+    while (q->next()) {
+        const int count = q->value(2).toInt();
+        const int delta = unread ? count : -count;
+        feedDeltas[q->value(0).value<qint64>()] += delta;
+        folderDeltas[q->value(1).value<qint64>()] += delta;
+        total += delta;
+    }
+
+    for (auto i = feedDeltas.constBegin(); i != feedDeltas.constEnd(); ++i) {
+        q = statements.query(QStringLiteral("UPDATE feeds SET unreadCount = unreadCount + ? WHERE id = ?"), &qresult);
+        Q_ASSERT(qresult);
+        q->addBindValue(i.value());
+        q->addBindValue(i.key());
+        qresult = q->exec();
+        Q_ASSERT(qresult);
+    }
+
+    for (auto i = folderDeltas.constBegin(); i != folderDeltas.constEnd(); ++i) {
+        q = statements.query(QStringLiteral("UPDATE folders SET unreadCount = unreadCount + ? WHERE id = ?"), &qresult);
+        Q_ASSERT(qresult);
+        q->addBindValue(i.value());
+        q->addBindValue(i.key());
+        qresult = q->exec();
+        Q_ASSERT(qresult);
+    }
+
+    return total;
+}
+
+
+/*!
+ * \internal
+ * Adds the changes of the unread counts in \a feedDeltas to the feeds and their folders
+ * instead of recounting the unread items of every feed and folder. Has to be called inside
+ * the transaction that changed the items.
+ */
+void SQLiteStoragePrivate::applyUnreadDeltas(SQLiteStatementCache &statements, const QHash<qint64, int> &feedDeltas)
+{
+    bool qresult = false;
+    QSqlQuery *q = nullptr;
+    QHash<qint64, int> folderUnreadDeltas;
+
+    for (auto i = feedDeltas.constBegin(); i != feedDeltas.constEnd(); ++i) {
+        if (i.value() == 0) {
+            continue;
+        }
+
+        q = statements.query(QStringLiteral("UPDATE feeds SET unreadCount = unreadCount + ? WHERE id = ?"), &qresult);
+        Q_ASSERT(qresult);
+        q->addBindValue(i.value());
+        q->addBindValue(i.key());
+        qresult = q->exec();
+        Q_ASSERT(qresult);
+
+        q = statements.query(QStringLiteral("SELECT folderId FROM feeds WHERE id = ?"), &qresult);
+        Q_ASSERT(qresult);
+        q->addBindValue(i.key());
+        qresult = q->exec();
+        Q_ASSERT(qresult);
+        if (q->next()) {
+            folderUnreadDeltas[q->value(0).toLongLong()] += i.value();
+        }
+        q->finish();
+    }
+
+    for (auto i = folderUnreadDeltas.constBegin(); i != folderUnreadDeltas.constEnd(); ++i) {
+        if (i.value() != 0) {
+            q = statements.query(QStringLiteral("UPDATE folders SET unreadCount = unreadCount + ? WHERE id = ?"), &qresult);
+            Q_ASSERT(qresult);
+            q->addBindValue(i.value());
+            q->addBindValue(i.key());
+            qresult = q->exec();
+            Q_ASSERT(qresult);
+        }
+    }
+}
+
+
 SQLiteStorage::SQLiteStorage(const QString &dbpath, QObject *parent) :
     AbstractStorage(* new SQLiteStoragePrivate(dbpath), parent)
 {
@@ -236,7 +600,9 @@ SQLiteStorage::SQLiteStorage(const QString &dbpath, QObject *parent) :
 
 SQLiteStorage::~SQLiteStorage()
 {
-
+    Q_D(SQLiteStorage);
+    // the article queries use the connections of the pool threads
+    d->readerPool.waitForDone();
 }
 
 
@@ -244,16 +610,16 @@ void SQLiteStorage::init()
 {
     Q_D(SQLiteStorage);
 
-    SQLiteStorageManager *sm = new SQLiteStorageManager(d->db.databaseName(), this);
+    SQLiteStorageManager *sm = new SQLiteStorageManager(d->dbpath, this);
     connect(sm, &SQLiteStorageManager::succeeded, this, [=] () {
-        bool result = d->db.open();
+        d->db = SQLiteConnectionPool::database(d->dbpath);
+        d->statements.setDatabase(d->db);
+
+        bool result = d->db.isOpen();
         Q_ASSERT_X(result, "init database", "failed to open database");
 
         QSqlQuery q(d->db);
 
-        result = q.exec(QStringLiteral("PRAGMA foreign_keys = ON"));
-        Q_ASSERT_X(result, "init databse", "failed to enable foreign keys support");
-
         result = (q.exec(QStringLiteral(SEL_TOTAL_UNREAD)) && q.next());
         Q_ASSERT_X(result, "init database", "failed to query unread items from database");
 
@@ -264,6 +630,11 @@ void SQLiteStorage::init()
 
         setStarred(q.value(0).toInt());
 
+        result = q.exec(QStringLiteral("SELECT name FROM sqlite_master WHERE type = 'table' AND name = 'items_fts'"));
+        Q_ASSERT_X(result, "init database", "failed to query full text search table");
+
+        d->fullTextSearch = q.next();
+
         setReady(true);
     });
     connect(sm, &SQLiteStorageManager::failed, this, &SQLiteStorage::setError);
@@ -360,7 +731,7 @@ void SQLiteStorage::foldersRequested(const QJsonDocument &json)
 
     const QJsonArray folders = json.object().value(QStringLiteral("folders")).toArray();
 
-    qDebug("Processing %i folders requested from the remote server.", folders.size());
+    qCDebug(FUOTEN_STORAGE, "Processing %i folders requested from the remote server.", folders.size());
 
     QHash<qint64, QString> reqFolders({{0, QString()}});
 
@@ -371,21 +742,21 @@ void SQLiteStorage::foldersRequested(const QJsonDocument &json)
         }
     }
 
-    QSqlQuery q(d->db);
-    q.setForwardOnly(true);
+    QSqlQuery *q = nullptr;
 
     // query the currently local available folders in the database
     QHash<qint64, QString> currentFolders;
 
-    bool qresult = q.exec(QStringLiteral("SELECT id, name FROM folders"));
+    bool qresult = false;
+    q = d->statements.exec(QStringLiteral("SELECT id, name FROM folders"), &qresult);
     Q_ASSERT_X(qresult, "folders requested", "failed query folders from database");
 
-    while (q.next()) {
-        currentFolders.insert(q.value(0).toLongLong(), q.value(1).toString());
+    while (q->next()) {
+        currentFolders.insert(q->value(0).toLongLong(), q->value(1).toString());
     }
 
     if (reqFolders.isEmpty() && currentFolders.isEmpty()) {
-        qDebug("%s", "Nothing to do. Returning.");
+        qCDebug(FUOTEN_STORAGE, "%s", "Nothing to do. Returning.");
         return;
     }
 
@@ -398,7 +769,7 @@ void SQLiteStorage::foldersRequested(const QJsonDocument &json)
 
     if (currentFolders.isEmpty()) {
 
-        qDebug("%s", "No local folders. Adding all requested folders as new.");
+        qCDebug(FUOTEN_STORAGE, "%s", "No local folders. Adding all requested folders as new.");
 
         auto i = reqFolders.constBegin();
         while (i != reqFolders.constEnd()) {
@@ -409,7 +780,7 @@ void SQLiteStorage::foldersRequested(const QJsonDocument &json)
 
     } else if (reqFolders.isEmpty()) {
 
-        qDebug("%s", "Requested folders list is empty. Adding all local folders to deleted.");
+        qCDebug(FUOTEN_STORAGE, "%s", "Requested folders list is empty. Adding all local folders to deleted.");
 
         for (auto i = currentFolders.constBegin(); i != currentFolders.constEnd(); ++i) {
             deletedIds.push_back(i.key());
@@ -418,7 +789,7 @@ void SQLiteStorage::foldersRequested(const QJsonDocument &json)
 
     } else {
 
-        qDebug("%s", "Checking for updated and deleted folders.");
+        qCDebug(FUOTEN_STORAGE, "%s", "Checking for updated and deleted folders.");
 
         for (auto i = currentFolders.constBegin(); i != currentFolders.constEnd(); ++i) {
             if (reqFolders.contains(i.key())) {
@@ -433,7 +804,7 @@ void SQLiteStorage::foldersRequested(const QJsonDocument &json)
             }
         }
 
-        qDebug("%s", "Checking for new folders.");
+        qCDebug(FUOTEN_STORAGE, "%s", "Checking for new folders.");
         for (auto i = reqFolders.constBegin(); i != reqFolders.constEnd(); ++i) {
             if (!currentFolders.contains(i.key())) {
                 newFolders.push_back(qMakePair(i.key(), i.value()));
@@ -445,39 +816,39 @@ void SQLiteStorage::foldersRequested(const QJsonDocument &json)
 
     if (!deletedIds.empty() || !newFolders.empty() || !updatedFolders.empty()) {
 
-        qDebug("%s", "Start updating the folders table.");
+        qCDebug(FUOTEN_STORAGE, "%s", "Start updating the folders table.");
 
         qresult = d->db.transaction();
         Q_ASSERT_X(qresult, "folders requested", "failed to start database transaction");
 
         if (!deletedIds.empty()) {
 
-#ifndef QT_NO_DEBUG_OUTPUT
-            QString printIdList;
-            for (const qint64 id : deletedIds) { // clazy:exclude=range-loop
-                printIdList.append(QString::number(id)).append(QLatin1Char(','));
+            if (FUOTEN_STORAGE().isDebugEnabled()) {
+                QString printIdList;
+                for (const qint64 id : deletedIds) { // clazy:exclude=range-loop
+                    printIdList.append(QString::number(id)).append(QLatin1Char(','));
+                }
+                printIdList.chop(1);
+                qCDebug(FUOTEN_STORAGE, "Deleting folders with IDs %s from local database.", qUtf8Printable(printIdList));
             }
-            printIdList.chop(1);
-            qDebug("Deleting folders with IDs %s from local database.", qUtf8Printable(printIdList));
-#endif
 
-            qresult = q.exec(QStringLiteral("DELETE FROM folders WHERE id IN (%1)").arg(d->intListToString(deletedIds)));
+            q = d->statements.execUncached(QStringLiteral("DELETE FROM folders WHERE id IN (%1)").arg(d->intListToString(deletedIds)), &qresult);
             Q_ASSERT_X(qresult, "folders requested", "failed to delete folders from database");
         }
 
         if (!updatedFolders.empty()) {
 
-            qresult = q.prepare(QStringLiteral("UPDATE folders SET name = :name WHERE id = :id"));
+            q = d->statements.query(QStringLiteral("UPDATE folders SET name = :name WHERE id = :id"), &qresult);
             Q_ASSERT_X(qresult, "folders requested", "failed to prepare updating folders in database");
 
             for (int i = 0; i < updatedFolders.size(); ++i) {
 
-                qDebug("Updating name of folder with ID %lli in local database to %s.", updatedFolders.at(i).first, qUtf8Printable(updatedFolders.at(i).second));
+                qCDebug(FUOTEN_STORAGE, "Updating name of folder with ID %lli in local database to %s.", updatedFolders.at(i).first, qUtf8Printable(updatedFolders.at(i).second));
 
-                q.bindValue(QStringLiteral(":name"), updatedFolders.at(i).second);
-                q.bindValue(QStringLiteral(":id"), updatedFolders.at(i).first);
+                q->bindValue(QStringLiteral(":name"), updatedFolders.at(i).second);
+                q->bindValue(QStringLiteral(":id"), updatedFolders.at(i).first);
 
-                qresult = q.exec();
+                qresult = q->exec();
                 Q_ASSERT_X(qresult, "folders requested", "failed to update folders in datbase");
             }
         }
@@ -485,17 +856,17 @@ void SQLiteStorage::foldersRequested(const QJsonDocument &json)
 
         if (!newFolders.empty()) {
 
-            qresult = q.prepare(QStringLiteral("INSERT INTO folders (id, name) VALUES (:id, :name)"));
+            q = d->statements.query(QStringLiteral("INSERT INTO folders (id, name) VALUES (:id, :name)"), &qresult);
             Q_ASSERT_X(qresult, "folders requested", "failed to prepare insertion of new folders in database");
 
             for (int i = 0; i < newFolders.size(); ++i) {
 
-                qDebug("Adding folder \"%s\" with ID %lli to the local database.", qUtf8Printable(newFolders.at(i).second), newFolders.at(i).first);
+                qCDebug(FUOTEN_STORAGE, "Adding folder \"%s\" with ID %lli to the local database.", qUtf8Printable(newFolders.at(i).second), newFolders.at(i).first);
 
-                q.bindValue(QStringLiteral(":id"), newFolders.at(i).first);
-                q.bindValue(QStringLiteral(":name"), newFolders.at(i).second);
+                q->bindValue(QStringLiteral(":id"), newFolders.at(i).first);
+                q->bindValue(QStringLiteral(":name"), newFolders.at(i).second);
 
-                qresult = q.exec();
+                qresult = q->exec();
                 Q_ASSERT_X(qresult, "folders requested", "failed to insert new folders into database");
             }
         }
@@ -504,13 +875,19 @@ void SQLiteStorage::foldersRequested(const QJsonDocument &json)
         qresult = d->db.commit();
         Q_ASSERT_X(qresult, "folders requested", "failed to perform database commit");
 
-        qresult = (q.exec(QStringLiteral(SEL_TOTAL_UNREAD)) && q.next());
+        q = d->statements.exec(QStringLiteral(SEL_TOTAL_UNREAD), &qresult);
+        qresult = (qresult && q->next());
         Q_ASSERT(qresult);
-        setTotalUnread(q.value(0).value<quint16>());
+        const int unreadCount = q->value(0).value<quint16>();
+        q->finish();
+        setTotalUnread(unreadCount);
 
-        qresult = (q.exec(QStringLiteral(SEL_TOTAL_STARRED)) && q.next());
+        q = d->statements.exec(QStringLiteral(SEL_TOTAL_STARRED), &qresult);
+        qresult = (qresult && q->next());
         Q_ASSERT(qresult);
-        setStarred(q.value(0).value<quint16>());
+        const int starredCount = q->value(0).value<quint16>();
+        q->finish();
+        setStarred(starredCount);
 
         if (notificator()) {
             QVariantList notifyData;
@@ -529,14 +906,14 @@ void SQLiteStorage::foldersRequested(const QJsonDocument &json)
 void SQLiteStorage::folderCreated(const QJsonDocument &json)
 {
     if (json.isEmpty() || json.isNull()) {
-        qWarning("Can not add folder to SQLite database. JSON data is not valid.");
+        qCWarning(FUOTEN_STORAGE, "Can not add folder to SQLite database. JSON data is not valid.");
         return;
     }
 
     const QJsonArray a = json.object().value(QStringLiteral("folders")).toArray();
 
     if (a.isEmpty()) {
-        qWarning("Can not add folder to SQLite database. JSON array is empty.");
+        qCWarning(FUOTEN_STORAGE, "Can not add folder to SQLite database. JSON array is empty.");
         return;
     }
 
@@ -544,33 +921,33 @@ void SQLiteStorage::folderCreated(const QJsonDocument &json)
     const QJsonObject o = a.first().toObject();
 
     if (o.isEmpty()) {
-        qWarning("Can not add folder to SQLite databse. JSON object is empty.");
+        qCWarning(FUOTEN_STORAGE, "Can not add folder to SQLite databse. JSON object is empty.");
         return;
     }
 
     const qint64 id = AbstractStorage::getIdFromJson(o.value(QStringLiteral("id")));
     if (id == 0) {
-        qWarning("Can not add folder to SQLite database. Invalid ID.");
+        qCWarning(FUOTEN_STORAGE, "Can not add folder to SQLite database. Invalid ID.");
         return;
     }
 
     const QString name = o.value(QStringLiteral("name")).toString();
     if (name.isEmpty()) {
-        qWarning("Can not add folder to SQLite database. Empty name.");
+        qCWarning(FUOTEN_STORAGE, "Can not add folder to SQLite database. Empty name.");
     }
 
     Q_D(SQLiteStorage);
 
-    QSqlQuery q(d->db);
+    QSqlQuery *q = nullptr;
     bool qresult = true;
 
-    qresult = q.prepare(QStringLiteral("INSERT INTO folders (id, name) VALUES (?, ?)"));
+    q = d->statements.query(QStringLiteral("INSERT INTO folders (id, name) VALUES (?, ?)"), &qresult);
     Q_ASSERT_X(qresult, "folder created", "failed to prepare insertion of new folder into database");
 
-    q.addBindValue(id);
-    q.addBindValue(name);
+    q->addBindValue(id);
+    q->addBindValue(name);
 
-    qresult = q.exec();
+    qresult = q->exec();
     Q_ASSERT_X(qresult, "folder created", "failed to insert new folder into database");
 
     if (notificator()) {
@@ -608,22 +985,24 @@ void SQLiteStorage::folderRenamed(qint64 id, const QString &newName)
 
     Q_D(SQLiteStorage);
 
-    QSqlQuery q(d->db);
-    bool qresult = q.prepare(QStringLiteral("SELECT name FROM folders WHERE id = ?"));
+    QSqlQuery *q = nullptr;
+    bool qresult = false;
+    q = d->statements.query(QStringLiteral("SELECT name FROM folders WHERE id = ?"), &qresult);
     Q_ASSERT(qresult);
-    q.addBindValue(id);
-    qresult = (q.exec() && q.next());
+    q->addBindValue(id);
+    qresult = (q->exec() && q->next());
     Q_ASSERT(qresult);
 
-    const QString oldName = q.value(0).toString();
+    const QString oldName = q->value(0).toString();
+    q->finish();
 
-    qresult = q.prepare(QStringLiteral("UPDATE folders SET name = ? WHERE id = ?"));
+    q = d->statements.query(QStringLiteral("UPDATE folders SET name = ? WHERE id = ?"), &qresult);
     Q_ASSERT_X(qresult, "folder renamed", "failed to prepare updating folder in database");
 
-    q.addBindValue(newName);
-    q.addBindValue(id);
+    q->addBindValue(newName);
+    q->addBindValue(id);
 
-    qresult = q.exec();
+    qresult = q->exec();
     Q_ASSERT_X(qresult, "folder renamed", "failed to update folder in database");
 
     if (notificator()) {
@@ -640,68 +1019,32 @@ QList<Folder*> SQLiteStorage::getFolders(FuotenEnums::SortingRole sortingRole, Q
     QList<Fuoten::Folder*> folders;
 
     if (!ready()) {
-        qWarning("SQLite database not ready. Can not query folders from database.");
+        qCWarning(FUOTEN_STORAGE, "SQLite database not ready. Can not query folders from database.");
         return folders;
     }
 
     Q_D(SQLiteStorage);
 
-    QString qs = QStringLiteral("SELECT id, name, feedCount, unreadCount FROM folders ORDER BY ");
-
-    if (!ids.isEmpty()) {
-        if (idType == FuotenEnums::Feed) {
-            qs = QStringLiteral("SELECT id, name, feedCount, unreadCount FROM folders WHERE id IN (SELECT folderId FROM feeds WHERE id IN (%1)) ORDER BY ").arg(d->intListToString(ids));
-        } else {
-            qs = QStringLiteral("SELECT id, name, feedCount, unreadCount FROM folders WHERE id IN (%1) ORDER BY ").arg(d->intListToString(ids));
-        }
-    }
-
-    switch(sortingRole) {
-    case FuotenEnums::Name:
-        qs.append(QStringLiteral("name"));
-        break;
-    case FuotenEnums::ID:
-        qs.append(QStringLiteral("id"));
-        break;
-    case FuotenEnums::UnreadCount:
-        qs.append(QStringLiteral("unreadCount"));
-        break;
-    case FuotenEnums::FeedCount:
-        qs.append(QStringLiteral("feedCount"));
-        break;
-    default:
-        qs.append(QStringLiteral("name"));
-        break;
-    }
-
-    if (sortOrder == Qt::AscendingOrder) {
-        qs.append(QStringLiteral(" ASC"));
-    } else {
-        qs.append(QStringLiteral(" DESC"));
-    }
-
-    if (limit > 0) {
-        qs.append(QLatin1String(" LIMIT ")).append(QString::number(limit));
-    }
-
-    QSqlQuery q(d->db);
-    q.setForwardOnly(true);
+    const SQLiteQuery query = SQLiteStoragePrivate::foldersQuery(sortingRole, sortOrder, ids, idType, limit);
 
-    bool qresult = q.exec(qs);
+    bool qresult = false;
+    QSqlQuery *q = SQLiteStoragePrivate::execQuery(d->statements, query, &qresult);
     Q_ASSERT_X(qresult, "get folders", "failed to execute datbase query");
 
-    while (q.next()) {
-        const qint64 id = q.value(0).toLongLong();
+    while (q->next()) {
+        const qint64 id = q->value(0).toLongLong();
         if (Q_LIKELY(id > 0)) {
             folders.append(new Folder(
                                id,
-                               q.value(1).toString(),
-                               q.value(2).toUInt(),
-                               q.value(3).toUInt()
+                               q->value(1).toString(),
+                               q->value(2).toUInt(),
+                               q->value(3).toUInt()
                                ));
         }
     }
 
+    q->finish();
+
     return folders;
 }
 
@@ -725,35 +1068,43 @@ void SQLiteStorage::folderDeleted(qint64 id)
 
     Q_D(SQLiteStorage);
 
-    QSqlQuery q(d->db);
+    QSqlQuery *q = nullptr;
 
-    bool qresult = q.prepare(QStringLiteral("SELECT name FROM folders WHERE id = ?"));
+    bool qresult = false;
+    q = d->statements.query(QStringLiteral("SELECT name FROM folders WHERE id = ?"), &qresult);
     Q_ASSERT_X(qresult, "folder deleted", "failed to prepare query to get name of deleted folder");
 
-    q.addBindValue(id);
+    q->addBindValue(id);
 
-    qresult = (q.exec() && q.next());
+    qresult = (q->exec() && q->next());
     Q_ASSERT_X(qresult, "folder deleted", "failed to query name of deleted folder");
 
-    const QString name = q.value(0).toString();
+    const QString name = q->value(0).toString();
+    q->finish();
 
-    qresult = q.prepare(QStringLiteral("DELETE FROM folders WHERE id = ?"));
+    q = d->statements.query(QStringLiteral("DELETE FROM folders WHERE id = ?"), &qresult);
     Q_ASSERT_X(qresult, "folder deleted", "failed to prepare qurey to delete folder from database");
 
-    q.addBindValue(id);
+    q->addBindValue(id);
 
-    qresult = q.exec();
+    qresult = q->exec();
     Q_ASSERT_X(qresult, "folder deleted", "failed to delete folder from database");
 
-    qresult = (q.exec(QStringLiteral(SEL_TOTAL_UNREAD)) && q.next());
+    q = d->statements.exec(QStringLiteral(SEL_TOTAL_UNREAD), &qresult);
+    qresult = (qresult && q->next());
     Q_ASSERT(qresult);
 
-    setTotalUnread(q.value(0).value<quint16>());
+    const int unreadCount = q->value(0).value<quint16>();
+    q->finish();
+    setTotalUnread(unreadCount);
 
-    qresult = (q.exec(QStringLiteral(SEL_TOTAL_STARRED)) && q.next());
+    q = d->statements.exec(QStringLiteral(SEL_TOTAL_STARRED), &qresult);
+    qresult = (qresult && q->next());
     Q_ASSERT(qresult);
 
-    setStarred(q.value(0).value<quint16>());
+    const int starredCount = q->value(0).value<quint16>();
+    q->finish();
+    setStarred(starredCount);
 
     if (notificator()) {
         notificator()->notify(AbstractNotificator::FolderDeleted, QtInfoMsg, name);
@@ -768,65 +1119,69 @@ void SQLiteStorage::folderMarkedRead(qint64 id, qint64 newestItem)
 {
     Q_D(SQLiteStorage);
 
-    QSqlQuery q(d->db);
-    q.setForwardOnly(true);
+    QSqlQuery *q = nullptr;
 
-    bool qresult = q.prepare(QStringLiteral("UPDATE items SET unread = 0, lastModified = ? WHERE feedId IN (SELECT id FROM feeds WHERE folderId = ?)"));
+    bool qresult = false;
+    q = d->statements.query(QStringLiteral("UPDATE items SET unread = 0, lastModified = ? WHERE feedId IN (SELECT id FROM feeds WHERE folderId = ?)"), &qresult);
     Q_ASSERT_X(qresult, "folder marked read", "failed to prepare database query");
 
 #if (QT_VERSION >= QT_VERSION_CHECK(5, 8, 0))
-    q.addBindValue(QDateTime::currentDateTimeUtc().toSecsSinceEpoch());
+    q->addBindValue(QDateTime::currentDateTimeUtc().toSecsSinceEpoch());
 #else
-    q.addBindValue(QDateTime::currentDateTimeUtc().toTime_t());
+    q->addBindValue(QDateTime::currentDateTimeUtc().toTime_t());
 #endif
-    q.addBindValue(id);
+    q->addBindValue(id);
 
-    qresult = q.exec();
+    qresult = q->exec();
     Q_ASSERT_X(qresult, "folder marked read", "failed to execute database query");
 
-    qresult = q.prepare(QStringLiteral("SELECT id FROM feeds WHERE folderId = ?"));
+    q = d->statements.query(QStringLiteral("SELECT id FROM feeds WHERE folderId = ?"), &qresult);
     Q_ASSERT_X(qresult, "folder marked read", "failed to prepare database query");
 
-    q.addBindValue(id);
+    q->addBindValue(id);
 
-    qresult = q.exec();
+    qresult = q->exec();
     Q_ASSERT(qresult);
 
     IdList feedIds;
-    while (q.next()) {
-        feedIds.push_back(q.value(0).value<qint64>());
+    while (q->next()) {
+        feedIds.push_back(q->value(0).value<qint64>());
     }
 
     if (!feedIds.empty()) {
-        qresult = q.prepare(QStringLiteral("UPDATE feeds SET unreadCount = (SELECT COUNT(id) FROM items WHERE unread = 1 AND feedId = :feedId) WHERE id = :feedId"));
+        q = d->statements.query(QStringLiteral("UPDATE feeds SET unreadCount = (SELECT COUNT(id) FROM items WHERE unread = 1 AND feedId = :feedId) WHERE id = :feedId"), &qresult);
         Q_ASSERT(qresult);
         for (int i = 0; i < feedIds.size(); ++i) {
-            q.bindValue(QStringLiteral(":feedId"), feedIds.at(i));
-            qresult = q.exec();
+            q->bindValue(QStringLiteral(":feedId"), feedIds.at(i));
+            qresult = q->exec();
             Q_ASSERT(qresult);
         }
     }
 
-    qresult = q.prepare(QStringLiteral("UPDATE folders SET unreadCount = (SELECT SUM(unreadCount) FROM feeds WHERE folderId = :folderId) WHERE id = :folderId"));
+    q = d->statements.query(QStringLiteral("UPDATE folders SET unreadCount = (SELECT SUM(unreadCount) FROM feeds WHERE folderId = :folderId) WHERE id = :folderId"), &qresult);
     Q_ASSERT(qresult);
-    q.bindValue(QStringLiteral(":folderId"), id);
-    qresult = q.exec();
+    q->bindValue(QStringLiteral(":folderId"), id);
+    qresult = q->exec();
     Q_ASSERT(qresult);
 
-    qresult = (q.exec(QStringLiteral(SEL_TOTAL_UNREAD)) && q.next());
+    q = d->statements.exec(QStringLiteral(SEL_TOTAL_UNREAD), &qresult);
+    qresult = (qresult && q->next());
     Q_ASSERT_X(qresult, "folder marked read", "failed to query total unread items count");
 
-    setTotalUnread(q.value(0).toInt());
+    const int unreadCount = q->value(0).toInt();
+    q->finish();
+    setTotalUnread(unreadCount);
 
     if (notificator()) {
-        qresult = q.prepare(QStringLiteral("SELECT name FROM folders WHERE id = ?"));
+        q = d->statements.query(QStringLiteral("SELECT name FROM folders WHERE id = ?"), &qresult);
         Q_ASSERT(qresult);
-        q.addBindValue(id);
+        q->addBindValue(id);
 
-        qresult = (q.exec() && q.next());
+        qresult = (q->exec() && q->next());
         Q_ASSERT(qresult);
 
-        const QString name = q.value(0).toString();
+        const QString name = q->value(0).toString();
+        q->finish();
 
         notificator()->notify(AbstractNotificator::FolderMarkedRead, QtInfoMsg, name);
     }
@@ -841,95 +1196,42 @@ QList<Feed*> SQLiteStorage::getFeeds(const QueryArgs &args)
     QList<Fuoten::Feed*> feeds;
 
     if (!ready()) {
-        qWarning("SQLite database not ready. Can not query folders from database.");
+        qCWarning(FUOTEN_STORAGE, "SQLite database not ready. Can not query folders from database.");
         return feeds;
     }
 
     Q_D(SQLiteStorage);
 
-    QString qs = QStringLiteral("SELECT fe.id, fe.folderId, fe.title, fe.url, fe.link, fe.added, fe.unreadCount, fe.ordering, fe.pinned, fe.updateErrorCount, fe.lastUpdateError, fe.faviconLink, fo.name AS folderName FROM feeds fe LEFT JOIN folders fo ON fo.id = fe.folderId");
-
-    if (args.parentId > -1 || !args.inIds.isEmpty() || args.unreadOnly) {
-        qs.append(QLatin1String(" WHERE"));
-    }
-
-    if (args.parentId > -1) {
-        qs.append(QStringLiteral(" fe.folderId = %1").arg(QString::number(args.parentId)));
-    }
-
-    if (!args.inIds.isEmpty() && ((args.inIdsType == FuotenEnums::Feed) || (args.inIdsType == FuotenEnums::Folder))) {
-        if (args.parentId > -1) {
-            qs.append(QLatin1String(" AND"));
-        }
-        if (args.inIdsType == FuotenEnums::Folder) {
-            qs.append(QStringLiteral(" fe.folderId IN (%1)").arg(d->intListToString(args.inIds)));
-        } else {
-            qs.append(QStringLiteral(" fe.id IN (%1)").arg(d->intListToString(args.inIds)));
-        }
-    }
-
-    if (args.unreadOnly) {
-        if ((args.parentId > -1) || (!args.inIds.isEmpty() && ((args.inIdsType == FuotenEnums::Feed) || (args.inIdsType == FuotenEnums::Folder)))) {
-            qs.append(QLatin1String(" AND"));
-        }
-        qs.append(QLatin1String(" fe.unreadCount > 0"));
-    }
-
-    switch(args.sortingRole) {
-    case FuotenEnums::Name:
-        qs.append(QLatin1String(" ORDER BY fe.title"));
-        break;
-    case FuotenEnums::FolderName:
-        qs.append(QLatin1String(" ORDER BY fo.name"));
-        break;
-    case FuotenEnums::ID:
-        qs.append(QLatin1String(" ORDER BY fe.id"));
-        break;
-    case FuotenEnums::UnreadCount:
-        qs.append(QLatin1String(" ORDER BY fe.unreadCount"));
-        break;
-    default:
-        qs.append(QLatin1String(" ORDER BY fe.title"));
-        break;
-    }
-
-    if (args.sortOrder == Qt::AscendingOrder) {
-        qs.append(QLatin1String(" ASC"));
-    } else {
-        qs.append(QLatin1String(" DESC"));
-    }
-
-    if (args.limit > 0) {
-        qs.append(QLatin1String(" LIMIT ")).append(QString::number(args.limit));
-    }
+    const SQLiteQuery query = SQLiteStoragePrivate::feedsQuery(args);
 
-    QSqlQuery q(d->db);
-    q.setForwardOnly(true);
-    bool qresult = q.exec(qs);
+    bool qresult = false;
+    QSqlQuery *q = SQLiteStoragePrivate::execQuery(d->statements, query, &qresult);
     Q_ASSERT_X(qresult, "get feeds", "failed to query feeds from database");
 
-    while (q.next()) {
+    while (q->next()) {
         feeds.append(new Feed(
-                         q.value(0).toLongLong(),
-                         q.value(1).toLongLong(),
-                         q.value(2).toString(),
-                         QUrl(q.value(3).toString()),
-                         QUrl(q.value(4).toString()),
+                         q->value(0).toLongLong(),
+                         q->value(1).toLongLong(),
+                         q->value(2).toString(),
+                         QUrl(q->value(3).toString()),
+                         QUrl(q->value(4).toString()),
 #if (QT_VERSION >= QT_VERSION_CHECK(5, 8, 0))
-                         QDateTime::fromSecsSinceEpoch(q.value(5).toUInt()),
+                         QDateTime::fromSecsSinceEpoch(q->value(5).toUInt()),
 #else
-                         QDateTime::fromTime_t(q.value(5).toUInt()),
+                         QDateTime::fromTime_t(q->value(5).toUInt()),
 #endif
-                         q.value(6).toUInt(),
-                         static_cast<Feed::FeedOrdering>(q.value(7).toInt()),
-                         q.value(8).toBool(),
-                         q.value(9).toUInt(),
-                         q.value(10).toString(),
-                         QUrl(q.value(11).toString()),
-                         q.value(12).toString()
+                         q->value(6).toUInt(),
+                         static_cast<Feed::FeedOrdering>(q->value(7).toInt()),
+                         q->value(8).toBool(),
+                         q->value(9).toUInt(),
+                         q->value(10).toString(),
+                         QUrl(q->value(11).toString()),
+                         q->value(12).toString()
                          ));
     }
 
+    q->finish();
+
     return feeds;
 }
 
@@ -938,48 +1240,50 @@ QList<Feed*> SQLiteStorage::getFeeds(const QueryArgs &args)
 Feed *SQLiteStorage::getFeed(qint64 id)
 {
     if (!ready()) {
-        qWarning("SQLite database not ready. Can not query folders from database.");
+        qCWarning(FUOTEN_STORAGE, "SQLite database not ready. Can not query folders from database.");
         return nullptr;
     }
 
     Q_D(SQLiteStorage);
 
-    QSqlQuery q(d->db);
+    QSqlQuery *q = nullptr;
 
-    bool qresult = q.prepare(QStringLiteral("SELECT fe.id, fe.folderId, fe.title, fe.url, fe.link, fe.added, fe.unreadCount, fe.ordering, fe.pinned, fe.updateErrorCount, fe.lastUpdateError, fe.faviconLink, fo.name AS folderName FROM feeds fe LEFT JOIN folders fo ON fo.id = fe.folderId WHERE fe.id = ?"));
+    bool qresult = false;
+    q = d->statements.query(QStringLiteral("SELECT fe.id, fe.folderId, fe.title, fe.url, fe.link, fe.added, fe.unreadCount, fe.ordering, fe.pinned, fe.updateErrorCount, fe.lastUpdateError, fe.faviconLink, fo.name AS folderName FROM feeds fe LEFT JOIN folders fo ON fo.id = fe.folderId WHERE fe.id = ?"), &qresult);
     Q_ASSERT_X(qresult, "get feed", "failed to prepare database query");
 
-    q.addBindValue(id);
+    q->addBindValue(id);
 
-    qresult = q.exec();
+    qresult = q->exec();
     Q_ASSERT_X(qresult, "get feed", "failed to execute database query");
 
 
-    if (Q_LIKELY(q.next())) {
+    if (Q_LIKELY(q->next())) {
         Feed *f = new Feed(
-                        q.value(0).toLongLong(),
-                        q.value(1).toLongLong(),
-                        q.value(2).toString(),
-                        QUrl(q.value(3).toString()),
-                        QUrl(q.value(4).toString()),
+                        q->value(0).toLongLong(),
+                        q->value(1).toLongLong(),
+                        q->value(2).toString(),
+                        QUrl(q->value(3).toString()),
+                        QUrl(q->value(4).toString()),
 #if (QT_VERSION >= QT_VERSION_CHECK(5, 8, 0))
-                        QDateTime::fromSecsSinceEpoch(q.value(5).toUInt()),
+                        QDateTime::fromSecsSinceEpoch(q->value(5).toUInt()),
 #else
-                        QDateTime::fromTime_t(q.value(5).toUInt()),
+                        QDateTime::fromTime_t(q->value(5).toUInt()),
 #endif
-                        q.value(6).toUInt(),
-                        static_cast<Feed::FeedOrdering>(q.value(7).toInt()),
-                        q.value(8).toBool(),
-                        q.value(9).toUInt(),
-                        q.value(10).toString(),
-                        QUrl(q.value(11).toString()),
-                        q.value(12).toString()
+                        q->value(6).toUInt(),
+                        static_cast<Feed::FeedOrdering>(q->value(7).toInt()),
+                        q->value(8).toBool(),
+                        q->value(9).toUInt(),
+                        q->value(10).toString(),
+                        QUrl(q->value(11).toString()),
+                        q->value(12).toString()
                         );
+        q->finish();
         return f;
 
     } else {
 
-        qWarning("Can not find the the feed in the local SQLite database.");
+        qCWarning(FUOTEN_STORAGE, "Can not find the the feed in the local SQLite database.");
         return nullptr;
 
     }
@@ -1002,12 +1306,12 @@ void SQLiteStorage::feedsRequested(const QJsonDocument &json)
         return;
     }
 
-    QSqlQuery q(d->db);
+    QSqlQuery *q = nullptr;
     bool qresult = true;
 
     const QJsonArray feeds = json.object().value(QStringLiteral("feeds")).toArray();
 
-    qDebug("Processing %i feeds requested from the remote server.", feeds.size());
+    qCDebug(FUOTEN_STORAGE, "Processing %i feeds requested from the remote server.", feeds.size());
 
     QueryArgs qa;
     const QList<Feed*> currentFeeds = getFeeds(qa);
@@ -1021,14 +1325,14 @@ void SQLiteStorage::feedsRequested(const QJsonDocument &json)
 
     if (feeds.isEmpty() && currentFeeds.isEmpty()) {
 
-        qDebug("%s", "Nothing to do. Local feeds and remote feeds are empty.");
+        qCDebug(FUOTEN_STORAGE, "%s", "Nothing to do. Local feeds and remote feeds are empty.");
 
         Q_EMIT requestedFeeds(updatedFeedIds, newFeedIds, deletedFeedIds);
         return;
 
     } else if (feeds.isEmpty() && !currentFeeds.isEmpty()) {
 
-        qDebug("%s", "All feeds have been deleted on the server. Deleting local ones.");
+        qCDebug(FUOTEN_STORAGE, "%s", "All feeds have been deleted on the server. Deleting local ones.");
 
         deletedFeedIds.reserve(currentFeeds.size());
         deletedFeedNames.reserve(currentFeeds.size());
@@ -1037,12 +1341,12 @@ void SQLiteStorage::feedsRequested(const QJsonDocument &json)
             deletedFeedNames.push_back(f->title());
         }
 
-        qresult = q.exec(QStringLiteral("DELETE FROM feeds"));
+        q = d->statements.exec(QStringLiteral("DELETE FROM feeds"), &qresult);
         Q_ASSERT_X(qresult, "feeds requested", "failed to delete all feeds from database");
 
     } else if (!feeds.isEmpty() && currentFeeds.isEmpty()) {
 
-        qDebug("%s", "No local feeds. Adding all requested feeds as new feeds.");
+        qCDebug(FUOTEN_STORAGE, "%s", "No local feeds. Adding all requested feeds as new feeds.");
 
         newFeedIds.reserve(feeds.size());
         newFeedNames.reserve(feeds.size());
@@ -1051,9 +1355,9 @@ void SQLiteStorage::feedsRequested(const QJsonDocument &json)
         Q_ASSERT_X(qresult, "feeds requested", "failed to start database transaction");
 
 
-        qresult = q.prepare(QStringLiteral("INSERT INTO feeds (id, folderId, title, url, link, added, ordering, pinned, updateErrorCount, lastUpdateError, faviconLink) "
+        q = d->statements.query(QStringLiteral("INSERT INTO feeds (id, folderId, title, url, link, added, ordering, pinned, updateErrorCount, lastUpdateError, faviconLink) "
                                            "VALUES (:id, :folderId, :title, :url, :link, :added, :ordering, :pinned, :updateErrorCount, :lastUpdateError, :faviconLink)"
-                                           ));
+                                           ), &qresult);
         Q_ASSERT_X(qresult, "feeds requested", "failed to prepare to insert new feed into database");
 
         for (const QJsonValue &f : feeds) {
@@ -1064,19 +1368,19 @@ void SQLiteStorage::feedsRequested(const QJsonDocument &json)
                 newFeedIds.push_back(feedId);
                 newFeedNames.push_back(feedTitle);
 
-                q.bindValue(QStringLiteral(":id"), feedId);
-                q.bindValue(QStringLiteral(":folderId"), AbstractStorage::getIdFromJson(o.value(QStringLiteral("folderId"))));
-                q.bindValue(QStringLiteral(":title"), feedTitle);
-                q.bindValue(QStringLiteral(":url"), o.value(QStringLiteral("url")).toString());
-                q.bindValue(QStringLiteral(":link"), o.value(QStringLiteral("link")).toString());
-                q.bindValue(QStringLiteral(":added"), o.value(QStringLiteral("added")).toVariant().toUInt());
-                q.bindValue(QStringLiteral(":ordering"), o.value(QStringLiteral("ordering")).toInt());
-                q.bindValue(QStringLiteral(":pinned"), o.value(QStringLiteral("pinned")).toBool());
-                q.bindValue(QStringLiteral(":updateErrorCount"), o.value(QStringLiteral("updateErrorCount")).toInt());
-                q.bindValue(QStringLiteral(":lastUpdateError"), o.value(QStringLiteral("lastUpdateError")).toString());
-                q.bindValue(QStringLiteral(":faviconLink"), o.value(QStringLiteral("faviconLink")).toString());
-
-                qresult = q.exec();
+                q->bindValue(QStringLiteral(":id"), feedId);
+                q->bindValue(QStringLiteral(":folderId"), AbstractStorage::getIdFromJson(o.value(QStringLiteral("folderId"))));
+                q->bindValue(QStringLiteral(":title"), feedTitle);
+                q->bindValue(QStringLiteral(":url"), o.value(QStringLiteral("url")).toString());
+                q->bindValue(QStringLiteral(":link"), o.value(QStringLiteral("link")).toString());
+                q->bindValue(QStringLiteral(":added"), o.value(QStringLiteral("added")).toVariant().toUInt());
+                q->bindValue(QStringLiteral(":ordering"), o.value(QStringLiteral("ordering")).toInt());
+                q->bindValue(QStringLiteral(":pinned"), o.value(QStringLiteral("pinned")).toBool());
+                q->bindValue(QStringLiteral(":updateErrorCount"), o.value(QStringLiteral("updateErrorCount")).toInt());
+                q->bindValue(QStringLiteral(":lastUpdateError"), o.value(QStringLiteral("lastUpdateError")).toString());
+                q->bindValue(QStringLiteral(":faviconLink"), o.value(QStringLiteral("faviconLink")).toString());
+
+                qresult = q->exec();
                 Q_ASSERT_X(qresult, "feeds requested", "failed to insert new feed into database");
             }
         }
@@ -1088,7 +1392,7 @@ void SQLiteStorage::feedsRequested(const QJsonDocument &json)
     } else {
 
 
-        qDebug("%s", "Checking for updated, new and deleted feeds.");
+        qCDebug(FUOTEN_STORAGE, "%s", "Checking for updated, new and deleted feeds.");
 
         QHash<qint64, Feed*> cfh; // current feeds hash
         IdList requestedFeedIds;
@@ -1111,26 +1415,26 @@ void SQLiteStorage::feedsRequested(const QJsonDocument &json)
                     newFeedIds.push_back(id);
                     newFeedNames.push_back(title);
 
-                    qDebug("Adding new feed \"%s\" with ID %lli to the database.", qUtf8Printable(o.value(QStringLiteral("title")).toString()), id);
+                    qCDebug(FUOTEN_STORAGE, "Adding new feed \"%s\" with ID %lli to the database.", qUtf8Printable(o.value(QStringLiteral("title")).toString()), id);
 
-                    qresult = q.prepare(QStringLiteral("INSERT INTO feeds (id, folderId, title, url, link, added, ordering, pinned, updateErrorCount, lastUpdateError, faviconLink) "
+                    q = d->statements.query(QStringLiteral("INSERT INTO feeds (id, folderId, title, url, link, added, ordering, pinned, updateErrorCount, lastUpdateError, faviconLink) "
                                                        "VALUES (?,?,?,?,?,?,?,?,?,?,?)"
-                                                       ));
+                                                       ), &qresult);
                     Q_ASSERT_X(qresult, "feeds requested", "failed to prepare inserting new feed into database");
 
-                    q.addBindValue(id);
-                    q.addBindValue(AbstractStorage::getIdFromJson(o.value(QStringLiteral("folderId"))));
-                    q.addBindValue(title);
-                    q.addBindValue(o.value(QStringLiteral("url")).toString());
-                    q.addBindValue(o.value(QStringLiteral("link")).toString());
-                    q.addBindValue(o.value(QStringLiteral("added")).toVariant().toUInt());
-                    q.addBindValue(o.value(QStringLiteral("ordering")).toInt());
-                    q.addBindValue(o.value(QStringLiteral("pinned")).toBool());
-                    q.addBindValue(o.value(QStringLiteral("updateErrorCount")).toInt());
-                    q.addBindValue(o.value(QStringLiteral("lastUpdateError")).toString());
-                    q.addBindValue(o.value(QStringLiteral("faviconLink")).toString());
-
-                    qresult = q.exec();
+                    q->addBindValue(id);
+                    q->addBindValue(AbstractStorage::getIdFromJson(o.value(QStringLiteral("folderId"))));
+                    q->addBindValue(title);
+                    q->addBindValue(o.value(QStringLiteral("url")).toString());
+                    q->addBindValue(o.value(QStringLiteral("link")).toString());
+                    q->addBindValue(o.value(QStringLiteral("added")).toVariant().toUInt());
+                    q->addBindValue(o.value(QStringLiteral("ordering")).toInt());
+                    q->addBindValue(o.value(QStringLiteral("pinned")).toBool());
+                    q->addBindValue(o.value(QStringLiteral("updateErrorCount")).toInt());
+                    q->addBindValue(o.value(QStringLiteral("lastUpdateError")).toString());
+                    q->addBindValue(o.value(QStringLiteral("faviconLink")).toString());
+
+                    qresult = q->exec();
                     Q_ASSERT_X(qresult, "feeds requested", "failed to insert new feed into database");
 
                 } else {
@@ -1147,7 +1451,7 @@ void SQLiteStorage::feedsRequested(const QJsonDocument &json)
 
                     if ((f->title() != title) || (f->faviconLink() != rFaviconLink) || (f->folderId() != rFolderId) || (f->ordering() != rOrdering) || (f->link() != rLink) || (f->pinned() != rPinned) || (f->updateErrorCount() != rUpdateErrorCount) || (f->lastUpdateError() != rLastUpdateError)) {
 
-                        qDebug("Updating feed \"%s\" with ID %lli in the database.", qUtf8Printable(f->title()), id);
+                        qCDebug(FUOTEN_STORAGE, "Updating feed \"%s\" with ID %lli in the database.", qUtf8Printable(f->title()), id);
 
                         updatedFeedIds.push_back(id);
 
@@ -1156,20 +1460,20 @@ void SQLiteStorage::feedsRequested(const QJsonDocument &json)
                             updatedFeedNames.push_back(title);
                         }
 
-                        qresult = q.prepare(QStringLiteral("UPDATE feeds SET folderId = ?, title = ?, link = ?, ordering = ?, pinned = ?, updateErrorCount = ?, lastUpdateError = ?, faviconLink = ? WHERE id = ?"));
+                        q = d->statements.query(QStringLiteral("UPDATE feeds SET folderId = ?, title = ?, link = ?, ordering = ?, pinned = ?, updateErrorCount = ?, lastUpdateError = ?, faviconLink = ? WHERE id = ?"), &qresult);
                         Q_ASSERT_X(qresult, "feeds requested", "failed to prepare updating feed in database");
 
-                        q.addBindValue(rFolderId);
-                        q.addBindValue(title);
-                        q.addBindValue(rLink.toString());
-                        q.addBindValue(static_cast<int>(rOrdering));
-                        q.addBindValue(rPinned);
-                        q.addBindValue(rUpdateErrorCount);
-                        q.addBindValue(rLastUpdateError);
-                        q.addBindValue(rFaviconLink.toString());
-                        q.addBindValue(id);
-
-                        qresult = q.exec();
+                        q->addBindValue(rFolderId);
+                        q->addBindValue(title);
+                        q->addBindValue(rLink.toString());
+                        q->addBindValue(static_cast<int>(rOrdering));
+                        q->addBindValue(rPinned);
+                        q->addBindValue(rUpdateErrorCount);
+                        q->addBindValue(rLastUpdateError);
+                        q->addBindValue(rFaviconLink.toString());
+                        q->addBindValue(id);
+
+                        qresult = q->exec();
                         Q_ASSERT_X(qresult, "feeds requested", "failed to update feed in database");
                     }
                 }
@@ -1188,16 +1492,16 @@ void SQLiteStorage::feedsRequested(const QJsonDocument &json)
         }
 
         if (!deletedFeedIds.isEmpty()) {
-#ifndef QT_NO_DEBUG_OUTPUT
-            QString printIdsString;
-            for (const qint64 id : deletedFeedIds) { // clazy:exclude=range-loop
-                printIdsString.append(QString::number(id)).append(QLatin1Char(','));
+            if (FUOTEN_STORAGE().isDebugEnabled()) {
+                QString printIdsString;
+                for (const qint64 id : deletedFeedIds) { // clazy:exclude=range-loop
+                    printIdsString.append(QString::number(id)).append(QLatin1Char(','));
+                }
+                printIdsString.chop(1);
+                qCDebug(FUOTEN_STORAGE, "The feeds with the following IDs have been deleted on the server: %s", qUtf8Printable(printIdsString));
             }
-            printIdsString.chop(1);
-            qDebug("The feeds with the following IDs have been deleted on the server: %s", qUtf8Printable(printIdsString));
-#endif
 
-            qresult = q.exec(QStringLiteral("DELETE FROM feeds WHERE id IN (%1)").arg(d->intListToString(deletedFeedIds)));
+            q = d->statements.execUncached(QStringLiteral("DELETE FROM feeds WHERE id IN (%1)").arg(d->intListToString(deletedFeedIds)), &qresult);
             Q_ASSERT_X(qresult, "feeds requested", "failed to delete feeds from database");
         }
 
@@ -1209,33 +1513,38 @@ void SQLiteStorage::feedsRequested(const QJsonDocument &json)
 
     qDeleteAll(currentFeeds);
 
-    q.setForwardOnly(true);
-    qresult = q.exec(QStringLiteral("SELECT id FROM folders"));
+    q = d->statements.exec(QStringLiteral("SELECT id FROM folders"), &qresult);
     Q_ASSERT(qresult);
 
     IdList folderIds;
-    while (q.next()) {
-        folderIds.push_back(q.value(0).value<qint64>());
+    while (q->next()) {
+        folderIds.push_back(q->value(0).value<qint64>());
     }
 
     if (!folderIds.empty()) {
         for (int i = 0; i < folderIds.size(); ++i) {
             const qint64 folderId = folderIds.at(i);
-            qresult = q.prepare(QStringLiteral("UPDATE folders SET unreadCount = (SELECT SUM(unreadCount) FROM feeds WHERE folderId = :folderId), feedCount = (SELECT COUNT(id) FROM feeds WHERE folderId = :folderId) WHERE id = :folderId"));
+            q = d->statements.query(QStringLiteral("UPDATE folders SET unreadCount = (SELECT SUM(unreadCount) FROM feeds WHERE folderId = :folderId), feedCount = (SELECT COUNT(id) FROM feeds WHERE folderId = :folderId) WHERE id = :folderId"), &qresult);
             Q_ASSERT(qresult);
-            q.bindValue(QStringLiteral(":folderId"), folderId);
-            qresult = q.exec();
+            q->bindValue(QStringLiteral(":folderId"), folderId);
+            qresult = q->exec();
             Q_ASSERT(qresult);
         }
     }
 
-    qresult = (q.exec(QStringLiteral(SEL_TOTAL_UNREAD)) && q.next());
+    q = d->statements.exec(QStringLiteral(SEL_TOTAL_UNREAD), &qresult);
+    qresult = (qresult && q->next());
     Q_ASSERT(qresult);
-    setTotalUnread(q.value(0).value<quint16>());
+    const int unreadCount = q->value(0).value<quint16>();
+    q->finish();
+    setTotalUnread(unreadCount);
 
-    qresult = (q.exec(QStringLiteral(SEL_TOTAL_STARRED)) && q.next());
+    q = d->statements.exec(QStringLiteral(SEL_TOTAL_STARRED), &qresult);
+    qresult = (qresult && q->next());
     Q_ASSERT(qresult);
-    setStarred(q.value(0).value<quint16>());
+    const int starredCount = q->value(0).value<quint16>();
+    q->finish();
+    setStarred(starredCount);
 
     if (!newFeedNames.empty() || !updatedFeedNames.empty() || !deletedFeedNames.empty()) {
         if (notificator()) {
@@ -1262,14 +1571,14 @@ void SQLiteStorage::feedCreated(const QJsonDocument &json)
     }
 
     if (json.isEmpty() || json.isNull()) {
-        qWarning("Can not add folder to SQLite database. JSON data is not valid.");
+        qCWarning(FUOTEN_STORAGE, "Can not add folder to SQLite database. JSON data is not valid.");
         return;
     }
 
     const QJsonArray a = json.object().value(QStringLiteral("feeds")).toArray();
 
     if (a.isEmpty()) {
-        qWarning("Can not add feed to SQLite database. JSON array is empty.");
+        qCWarning(FUOTEN_STORAGE, "Can not add feed to SQLite database. JSON array is empty.");
         return;
     }
 
@@ -1277,42 +1586,43 @@ void SQLiteStorage::feedCreated(const QJsonDocument &json)
     const QJsonObject o = a.first().toObject();
 
     if (o.isEmpty()) {
-        qWarning("Can not add feed to SQLite databse. JSON object is empty.");
+        qCWarning(FUOTEN_STORAGE, "Can not add feed to SQLite databse. JSON object is empty.");
         return;
     }
 
     Q_D(SQLiteStorage);
 
-    QSqlQuery q(d->db);
+    QSqlQuery *q = nullptr;
 
-    bool qresult = q.prepare(QStringLiteral("INSERT INTO feeds (id, folderId, title, url, link, added, ordering, pinned, updateErrorCount, lastUpdateError, faviconLink) "
+    bool qresult = false;
+    q = d->statements.query(QStringLiteral("INSERT INTO feeds (id, folderId, title, url, link, added, ordering, pinned, updateErrorCount, lastUpdateError, faviconLink) "
                                             "VALUES (?,?,?,?,?,?,?,?,?,?,?)"
-                                            ));
+                                            ), &qresult);
     Q_ASSERT_X(qresult, "feed created", "failed to prepare database query");
 
     const qint64 id = AbstractStorage::getIdFromJson(o.value(QStringLiteral("id")));
     const qint64 folderId = AbstractStorage::getIdFromJson(o.value(QStringLiteral("folderId")));
     const QString title = o.value(QStringLiteral("title")).toString();
 
-    q.addBindValue(id);
-    q.addBindValue(folderId);
-    q.addBindValue(title);
-    q.addBindValue(o.value(QStringLiteral("url")).toString());
-    q.addBindValue(o.value(QStringLiteral("link")).toString());
-    q.addBindValue(o.value(QStringLiteral("added")).toVariant().toUInt());
-    q.addBindValue(o.value(QStringLiteral("ordering")).toInt());
-    q.addBindValue(o.value(QStringLiteral("pinned")).toBool());
-    q.addBindValue(o.value(QStringLiteral("updateErrorCount")).toInt());
-    q.addBindValue(o.value(QStringLiteral("lastUpdateError")).toString());
-    q.addBindValue(o.value(QStringLiteral("faviconLink")).toString());
-
-    qresult = q.exec();
+    q->addBindValue(id);
+    q->addBindValue(folderId);
+    q->addBindValue(title);
+    q->addBindValue(o.value(QStringLiteral("url")).toString());
+    q->addBindValue(o.value(QStringLiteral("link")).toString());
+    q->addBindValue(o.value(QStringLiteral("added")).toVariant().toUInt());
+    q->addBindValue(o.value(QStringLiteral("ordering")).toInt());
+    q->addBindValue(o.value(QStringLiteral("pinned")).toBool());
+    q->addBindValue(o.value(QStringLiteral("updateErrorCount")).toInt());
+    q->addBindValue(o.value(QStringLiteral("lastUpdateError")).toString());
+    q->addBindValue(o.value(QStringLiteral("faviconLink")).toString());
+
+    qresult = q->exec();
     Q_ASSERT_X(qresult, "feed created", "failed to execute database query");
 
-    qresult = q.prepare(QStringLiteral("UPDATE folders SET feedCount = feedCount + 1, unreadCount = (SELECT SUM(unreadCount) FROM feeds WHERE folderId = :folderId) WHERE id = :folderId"));
+    q = d->statements.query(QStringLiteral("UPDATE folders SET feedCount = feedCount + 1, unreadCount = (SELECT SUM(unreadCount) FROM feeds WHERE folderId = :folderId) WHERE id = :folderId"), &qresult);
     Q_ASSERT(qresult);
-    q.bindValue(QStringLiteral(":folderId"), folderId);
-    qresult = q.exec();
+    q->bindValue(QStringLiteral(":folderId"), folderId);
+    qresult = q->exec();
     Q_ASSERT(qresult);
 
     if (notificator()) {
@@ -1340,37 +1650,45 @@ void SQLiteStorage::feedDeleted(qint64 id)
 
     Q_D(SQLiteStorage);
 
-    QSqlQuery q(d->db);
+    QSqlQuery *q = nullptr;
 
-    bool qresult = q.prepare(QStringLiteral("SELECT folderId, title FROM feeds WHERE id = ?"));
+    bool qresult = false;
+    q = d->statements.query(QStringLiteral("SELECT folderId, title FROM feeds WHERE id = ?"), &qresult);
     Q_ASSERT(qresult);
-    q.addBindValue(id);
-    qresult = (q.exec() && q.next());
+    q->addBindValue(id);
+    qresult = (q->exec() && q->next());
     Q_ASSERT(qresult);
-    const qint64 folderId = q.value(0).value<qint64>();
-    const QString title = q.value(1).toString();
+    const qint64 folderId = q->value(0).value<qint64>();
+    const QString title = q->value(1).toString();
+    q->finish();
 
-    qresult = q.prepare(QStringLiteral("DELETE FROM feeds WHERE id = ?"));
+    q = d->statements.query(QStringLiteral("DELETE FROM feeds WHERE id = ?"), &qresult);
     Q_ASSERT_X(qresult, "feed deleted", "failed to prepare database query");
 
-    q.addBindValue(id);
+    q->addBindValue(id);
 
-    qresult = q.exec();
+    qresult = q->exec();
     Q_ASSERT_X(qresult, "feed deleted", "failed to execute database query");
 
-    qresult = q.prepare(QStringLiteral("UPDATE folders SET feedCount = feedCount - 1, unreadCount = (SELECT SUM(unreadCount) FROM feeds WHERE folderId = :folderId) WHERE id = :folderId"));
+    q = d->statements.query(QStringLiteral("UPDATE folders SET feedCount = feedCount - 1, unreadCount = (SELECT SUM(unreadCount) FROM feeds WHERE folderId = :folderId) WHERE id = :folderId"), &qresult);
     Q_ASSERT(qresult);
-    q.bindValue(QStringLiteral(":folderId"), folderId);
-    qresult = q.exec();
+    q->bindValue(QStringLiteral(":folderId"), folderId);
+    qresult = q->exec();
     Q_ASSERT(qresult);
 
-    qresult = (q.exec(QStringLiteral(SEL_TOTAL_UNREAD)) && q.next());
+    q = d->statements.exec(QStringLiteral(SEL_TOTAL_UNREAD), &qresult);
+    qresult = (qresult && q->next());
     Q_ASSERT(qresult);
-    setTotalUnread(q.value(0).value<quint16>());
+    const int unreadCount = q->value(0).value<quint16>();
+    q->finish();
+    setTotalUnread(unreadCount);
 
-    qresult = (q.exec(QStringLiteral(SEL_TOTAL_STARRED)) && q.next());
+    q = d->statements.exec(QStringLiteral(SEL_TOTAL_STARRED), &qresult);
+    qresult = (qresult && q->next());
     Q_ASSERT(qresult);
-    setStarred(q.value(0).value<quint16>());
+    const int starredCount = q->value(0).value<quint16>();
+    q->finish();
+    setStarred(starredCount);
 
     if (notificator()) {
         notificator()->notify(AbstractNotificator::FeedDeleted, QtInfoMsg, title);
@@ -1406,53 +1724,58 @@ void SQLiteStorage::feedMoved(qint64 id, qint64 targetFolder)
 
     Q_D(SQLiteStorage);
 
-    QSqlQuery q(d->db);
+    QSqlQuery *q = nullptr;
 
-    bool qresult = q.prepare(QStringLiteral("SELECT folderId FROM feeds WHERE id = ?"));
+    bool qresult = false;
+    q = d->statements.query(QStringLiteral("SELECT folderId FROM feeds WHERE id = ?"), &qresult);
     Q_ASSERT(qresult);
-    q.addBindValue(id);
-    qresult = (q.exec() && q.next());
+    q->addBindValue(id);
+    qresult = (q->exec() && q->next());
     Q_ASSERT(qresult);
-    const qint64 oldFolderId = q.value(0).value<qint64>();
+    const qint64 oldFolderId = q->value(0).value<qint64>();
+    q->finish();
 
-    qresult = q.prepare(QStringLiteral("UPDATE feeds SET folderId = ? WHERE id = ?"));
+    q = d->statements.query(QStringLiteral("UPDATE feeds SET folderId = ? WHERE id = ?"), &qresult);
     Q_ASSERT_X(qresult, "feed moved", "failed to prepare database query");
 
-    q.addBindValue(targetFolder);
-    q.addBindValue(id);
+    q->addBindValue(targetFolder);
+    q->addBindValue(id);
 
-    qresult = q.exec();
+    qresult = q->exec();
     Q_ASSERT_X(qresult, "feed moved", "failed to execute database query");
 
     for (const qint64 fid : {targetFolder, oldFolderId}) {
-        qresult = q.prepare(QStringLiteral("UPDATE folders SET unreadCount = (SELECT SUM(unreadCount) FROM feeds WHERE folderId = :folderId), feedCount = (SELECT COUNT(id) FROM feeds WHERE folderId = :folderId) WHERE id = :folderId"));
+        q = d->statements.query(QStringLiteral("UPDATE folders SET unreadCount = (SELECT SUM(unreadCount) FROM feeds WHERE folderId = :folderId), feedCount = (SELECT COUNT(id) FROM feeds WHERE folderId = :folderId) WHERE id = :folderId"), &qresult);
         Q_ASSERT(qresult);
-        q.bindValue(QStringLiteral(":folderId"), fid);
-        qresult = q.exec();
+        q->bindValue(QStringLiteral(":folderId"), fid);
+        qresult = q->exec();
         Q_ASSERT(qresult);
     }
 
     if (notificator() && notificator()->isEnabled()) {
-        qresult = q.prepare(QStringLiteral("SELECT name FROM folders WHERE id = ?"));
+        q = d->statements.query(QStringLiteral("SELECT name FROM folders WHERE id = ?"), &qresult);
         Q_ASSERT(qresult);
-        q.addBindValue(oldFolderId);
-        qresult = (q.exec() && q.next());
+        q->addBindValue(oldFolderId);
+        qresult = (q->exec() && q->next());
         Q_ASSERT(qresult);
-        const QString oldFolderName = q.value(0).toString();
+        const QString oldFolderName = q->value(0).toString();
+        q->finish();
 
-        qresult = q.prepare(QStringLiteral("SELECT name FROM folders WHERE id = ?"));
+        q = d->statements.query(QStringLiteral("SELECT name FROM folders WHERE id = ?"), &qresult);
         Q_ASSERT(qresult);
-        q.addBindValue(targetFolder);
-        qresult = (q.exec() && q.next());
+        q->addBindValue(targetFolder);
+        qresult = (q->exec() && q->next());
         Q_ASSERT(qresult);
-        const QString targetFolderName = q.value(0).toString();
+        const QString targetFolderName = q->value(0).toString();
+        q->finish();
 
-        qresult = q.prepare(QStringLiteral("SELECT title FROM feeds WHERE id = ?"));
+        q = d->statements.query(QStringLiteral("SELECT title FROM feeds WHERE id = ?"), &qresult);
         Q_ASSERT(qresult);
-        q.addBindValue(id);
-        qresult = (q.exec() && q.next());
+        q->addBindValue(id);
+        qresult = (q->exec() && q->next());
         Q_ASSERT(qresult);
-        const QString feedTitle = q.value(0).toString();
+        const QString feedTitle = q->value(0).toString();
+        q->finish();
 
         QVariantList data;
         data.push_back(feedTitle);
@@ -1492,22 +1815,24 @@ void SQLiteStorage::feedRenamed(qint64 id, const QString &newTitle)
 
     Q_D(SQLiteStorage);
 
-    QSqlQuery q(d->db);
+    QSqlQuery *q = nullptr;
 
-    bool qresult = q.prepare(QStringLiteral("SELECT title FROM feeds WHERE id = ?"));
+    bool qresult = false;
+    q = d->statements.query(QStringLiteral("SELECT title FROM feeds WHERE id = ?"), &qresult);
     Q_ASSERT_X(qresult, "feed renamed", "failed to prepare query for old feed title");
-    q.addBindValue(id);
-    qresult = (q.exec() && q.next());
+    q->addBindValue(id);
+    qresult = (q->exec() && q->next());
     Q_ASSERT_X(qresult, "feed renamed", "failed to query old feed title");
-    const QString oldTitle = q.value(0).toString();
+    const QString oldTitle = q->value(0).toString();
+    q->finish();
 
-    qresult = q.prepare(QStringLiteral("UPDATE feeds SET title = ? WHERE id = ?"));
+    q = d->statements.query(QStringLiteral("UPDATE feeds SET title = ? WHERE id = ?"), &qresult);
     Q_ASSERT_X(qresult, "feed renamed", "failed to prepare database query");
 
-    q.addBindValue(newTitle);
-    q.addBindValue(id);
+    q->addBindValue(newTitle);
+    q->addBindValue(id);
 
-    qresult = q.exec();
+    qresult = q->exec();
     Q_ASSERT_X(qresult, "feed renamed", "failed to execute database query");
 
     if (notificator()) {
@@ -1547,53 +1872,59 @@ void SQLiteStorage::feedMarkedRead(qint64 id, qint64 newestItem)
 
     Q_D(SQLiteStorage);
 
-    QSqlQuery q(d->db);
+    QSqlQuery *q = nullptr;
 
-    bool qresult = q.prepare(QStringLiteral("UPDATE items SET unread = 0, lastModified = ? WHERE feedId = ? AND id <= ?"));
+    bool qresult = false;
+    q = d->statements.query(QStringLiteral("UPDATE items SET unread = 0, lastModified = ? WHERE feedId = ? AND id <= ?"), &qresult);
     Q_ASSERT_X(qresult, "feed marked read", "failed to prepare database query");
 
 #if (QT_VERSION >= QT_VERSION_CHECK(5, 8, 0))
-    q.addBindValue(QDateTime::currentDateTimeUtc().toSecsSinceEpoch());
+    q->addBindValue(QDateTime::currentDateTimeUtc().toSecsSinceEpoch());
 #else
-    q.addBindValue(QDateTime::currentDateTimeUtc().toTime_t());
+    q->addBindValue(QDateTime::currentDateTimeUtc().toTime_t());
 #endif
-    q.addBindValue(id);
-    q.addBindValue(newestItem);
+    q->addBindValue(id);
+    q->addBindValue(newestItem);
 
-    qresult = q.exec();
+    qresult = q->exec();
     Q_ASSERT_X(qresult, "feed marked read", "failed to execute database query");
 
-    qresult = q.prepare(QStringLiteral("UPDATE feeds SET unreadCount = (SELECT COUNT(id) FROM items WHERE unread = 1 AND feedId = :feedId) WHERE id = :feedId"));
+    q = d->statements.query(QStringLiteral("UPDATE feeds SET unreadCount = (SELECT COUNT(id) FROM items WHERE unread = 1 AND feedId = :feedId) WHERE id = :feedId"), &qresult);
     Q_ASSERT(qresult);
-    q.bindValue(QStringLiteral(":feedId"), id);
-    qresult = q.exec();
+    q->bindValue(QStringLiteral(":feedId"), id);
+    qresult = q->exec();
     Q_ASSERT(qresult);
 
-    qresult = q.prepare(QStringLiteral("SELECT folderId FROM feeds WHERE id = ?"));
+    q = d->statements.query(QStringLiteral("SELECT folderId FROM feeds WHERE id = ?"), &qresult);
     Q_ASSERT(qresult);
-    q.addBindValue(id);
-    qresult = (q.exec() && q.next());
+    q->addBindValue(id);
+    qresult = (q->exec() && q->next());
 
-    const qint64 folderId = q.value(0).value<qint64>();
+    const qint64 folderId = q->value(0).value<qint64>();
+    q->finish();
 
-    qresult = q.prepare(QStringLiteral("UPDATE folders SET unreadCount = (SELECT SUM(unreadCount) FROM feeds WHERE folderId = :folderId) WHERE id = :folderId"));
+    q = d->statements.query(QStringLiteral("UPDATE folders SET unreadCount = (SELECT SUM(unreadCount) FROM feeds WHERE folderId = :folderId) WHERE id = :folderId"), &qresult);
     Q_ASSERT(qresult);
-    q.bindValue(QStringLiteral(":folderId"), folderId);
-    qresult = q.exec();
+    q->bindValue(QStringLiteral(":folderId"), folderId);
+    qresult = q->exec();
     Q_ASSERT(qresult);
 
-    qresult = (q.exec(QStringLiteral(SEL_TOTAL_UNREAD)) && q.next());
+    q = d->statements.exec(QStringLiteral(SEL_TOTAL_UNREAD), &qresult);
+    qresult = (qresult && q->next());
     Q_ASSERT_X(qresult, "feed marked read", "failed to query all unread items from database");
 
-    setTotalUnread(q.value(0).toInt());
+    const int unreadCount = q->value(0).toInt();
+    q->finish();
+    setTotalUnread(unreadCount);
 
     if (notificator()) {
-        qresult = q.prepare(QStringLiteral("SELECT title FROM feeds WHERE id = ?"));
+        q = d->statements.query(QStringLiteral("SELECT title FROM feeds WHERE id = ?"), &qresult);
         Q_ASSERT_X(qresult, "feed marked read", "failed to prepare query for feed title");
-        q.addBindValue(id);
-        qresult = (q.exec() && q.next());
+        q->addBindValue(id);
+        qresult = (q->exec() && q->next());
         Q_ASSERT_X(qresult, "feed marked read", "failed to query title of the feed");
-        const QString title = q.value(0).toString();
+        const QString title = q->value(0).toString();
+        q->finish();
 
         notificator()->notify(AbstractNotificator::FeedMarkedRead, QtInfoMsg, title);
     }
@@ -1608,68 +1939,72 @@ void SQLiteStorage::feedMarkedRead(qint64 id, qint64 newestItem)
 Article *SQLiteStorage::getArticle(qint64 id, int bodyLimit)
 {
     if (!ready()) {
-        qWarning("SQLite database not ready. Can not query article from database.");
+        qCWarning(FUOTEN_STORAGE, "SQLite database not ready. Can not query article from database.");
         return nullptr;
     }
 
     Q_D(SQLiteStorage);
 
-    QSqlQuery q(d->db);
+    QSqlQuery *q = nullptr;
 
-    bool qresult = q.prepare(QStringLiteral("SELECT it.id, it.feedId, fe.title, it.guid, it.guidHash, it.url, it.title, it.author, it.pubDate, it.body, it.enclosureMime, it.enclosureLink, it.unread, it.starred, it.lastModified, it.fingerprint, fo.id, fo.name, it.queue, it.rtl, it.mediaThumbnail, it.mediaDescription FROM items it LEFT JOIN feeds fe ON fe.id = it.feedId LEFT JOIN folders fo on fo.id = fe.folderId WHERE it.id = ?"));
+    bool qresult = false;
+    q = d->statements.query(QStringLiteral("SELECT it.id, it.feedId, fe.title, it.guid, it.guidHash, it.url, it.title, it.author, it.pubDate, %1, it.enclosureMime, it.enclosureLink, it.unread, it.starred, it.lastModified, it.fingerprint, fo.id, fo.name, it.queue, it.rtl, it.mediaThumbnail, it.mediaDescription FROM items it LEFT JOIN feeds fe ON fe.id = it.feedId LEFT JOIN folders fo on fo.id = fe.folderId%2 WHERE it.id = ?").arg(SQLiteStoragePrivate::bodyColumn(bodyLimit), SQLiteStoragePrivate::bodyJoin(bodyLimit)), &qresult);
     Q_ASSERT_X(qresult, "get article", "failed to prepare database query");
 
-    q.addBindValue(id);
+    q->addBindValue(id);
 
-    qresult = q.exec();
+    qresult = q->exec();
     Q_ASSERT_X(qresult, "get article", "failed to execute database query");
 
-    QString body;
+    if (Q_LIKELY(q->next())) {
 
-    if (bodyLimit == 0) {
-        body = q.value(9).toString();
-    } else if (bodyLimit > 0) {
-        body = limitBody(q.value(9).toString(), bodyLimit);
-    }
+        QString body;
 
+        if (bodyLimit == 0) {
+            body = SQLiteStoragePrivate::uncompressBody(q->value(9).toByteArray());
+        } else if (bodyLimit > SQLiteStoragePrivate::excerptLength) {
+            body = SQLiteStoragePrivate::excerpt(SQLiteStoragePrivate::uncompressBody(q->value(9).toByteArray()), bodyLimit);
+        } else if (bodyLimit > 0) {
+            body = q->value(9).toString().left(bodyLimit);
+        }
 
-    if (Q_LIKELY(q.next())) {
-        Article *a = new Article(q.value(0).toLongLong(),
-                                 q.value(1).toLongLong(),
-                                 q.value(2).toString(),
-                                 q.value(3).toString(),
-                                 q.value(4).toString(),
-                                 QUrl(q.value(5).toString()),
-                                 q.value(6).toString(),
-                                 q.value(7).toString(),
+        Article *a = new Article(q->value(0).toLongLong(),
+                                 q->value(1).toLongLong(),
+                                 q->value(2).toString(),
+                                 q->value(3).toString(),
+                                 q->value(4).toString(),
+                                 QUrl(q->value(5).toString()),
+                                 q->value(6).toString(),
+                                 q->value(7).toString(),
 #if (QT_VERSION >= QT_VERSION_CHECK(5, 8, 0))
-                                 QDateTime::fromSecsSinceEpoch(q.value(8).toUInt()),
+                                 QDateTime::fromSecsSinceEpoch(q->value(8).toUInt()),
 #else
-                                 QDateTime::fromTime_t(q.value(8).toUInt()),
+                                 QDateTime::fromTime_t(q->value(8).toUInt()),
 #endif
                                  body,
-                                 q.value(10).toString(),
-                                 QUrl(q.value(11).toString()),
-                                 q.value(12).toBool(),
-                                 q.value(13).toBool(),
+                                 q->value(10).toString(),
+                                 QUrl(q->value(11).toString()),
+                                 q->value(12).toBool(),
+                                 q->value(13).toBool(),
 #if (QT_VERSION >= QT_VERSION_CHECK(5, 8, 0))
-                                 QDateTime::fromSecsSinceEpoch(q.value(14).toUInt()),
+                                 QDateTime::fromSecsSinceEpoch(q->value(14).toUInt()),
 #else
-                                 QDateTime::fromTime_t(q.value(14).toUInt()),
+                                 QDateTime::fromTime_t(q->value(14).toUInt()),
 #endif
-                                 q.value(15).toString(),
-                                 q.value(16).toLongLong(),
-                                 q.value(17).toString(),
-                                 FuotenEnums::QueueActions(q.value(18).toInt()),
-                                 q.value(19).toBool(),
-                                 QUrl(q.value(20).toString()),
-                                 q.value(21).toString()
+                                 q->value(15).toString(),
+                                 q->value(16).toLongLong(),
+                                 q->value(17).toString(),
+                                 FuotenEnums::QueueActions(q->value(18).toInt()),
+                                 q->value(19).toBool(),
+                                 QUrl(q->value(20).toString()),
+                                 q->value(21).toString()
                                  );
+        q->finish();
         return a;
 
     } else {
 
-        qWarning("Can not find the the article in the local SQLite database.");
+        qCWarning(FUOTEN_STORAGE, "Can not find the the article in the local SQLite database.");
         return nullptr;
 
     }
@@ -1681,229 +2016,494 @@ QList<Article*> SQLiteStorage::getArticles(const QueryArgs &args)
 {
     QList<Article*> articles;
 
-    if (!ready()) {
-        qWarning("SQLite database not ready. Can not query articles from database.");
-        return articles;
+    const ArticleRecordList records = getArticleRecords(args);
+
+    if (!records.isEmpty()) {
+        articles.reserve(records.size());
+        for (const ArticleRecord &r : records) {
+            articles.append(new Article(r));
+        }
     }
 
-    Q_D(SQLiteStorage);
+    return articles;
+}
 
-    QString qs = QStringLiteral("SELECT it.id, it.feedId, fe.title, it.guid, it.guidHash, it.url, it.title, it.author, it.pubDate, it.body, it.enclosureMime, it.enclosureLink, it.unread, it.starred, it.lastModified, it.fingerprint, fo.id, fo.name, it.queue, it.rtl, it.mediaThumbnail, it.mediaDescription FROM items it LEFT JOIN feeds fe ON fe.id = it.feedId LEFT JOIN folders fo on fo.id = fe.folderId");
 
-#if (QT_VERSION >= QT_VERSION_CHECK(5, 8, 0))
-    qs.append(QStringLiteral(" WHERE it.pubDate < %1").arg(QString::number(QDateTime::currentDateTimeUtc().toSecsSinceEpoch())));
-#else
-    qs.append(QStringLiteral(" WHERE it.pubDate < %1").arg(QString::number(QDateTime::currentDateTimeUtc().toTime_t())));
-#endif
+ArticleRecordList SQLiteStorage::getArticleRecords(const QueryArgs &args)
+{
+    ArticleRecordList records;
 
-    if (args.parentId > -1) {
-        if (args.parentIdType == FuotenEnums::Feed) {
-            qs.append(QStringLiteral(" AND it.feedId = %1").arg(QString::number(args.parentId)));
-        } else {
-            qs.append(QStringLiteral(" AND it.feedId IN (SELECT id FROM feeds WHERE folderId = %1)").arg(args.parentId));
-        }
+    if (!ready()) {
+        qCWarning(FUOTEN_STORAGE, "SQLite database not ready. Can not query articles from database.");
+        return records;
     }
 
-    if (!args.inIds.isEmpty()) {
-        switch(args.inIdsType) {
-        case FuotenEnums::Folder:
-            qs.append(QStringLiteral(" AND it.feedId IN (SELECT id FROM feeds WHERE folderId IN (%1))").arg(d->intListToString(args.inIds)));
-            break;
-        case FuotenEnums::Feed:
-            qs.append(QStringLiteral(" AND it.feedId IN (%1)").arg(d->intListToString(args.inIds)));
-            break;
-        default:
-            qs.append(QStringLiteral(" AND it.id IN (%1)").arg(d->intListToString(args.inIds)));
-            break;
-        }
-    }
+    Q_D(SQLiteStorage);
 
-    if (args.unreadOnly) {
-        qs.append(QLatin1String(" AND it.unread = 1"));
+    const SQLiteQuery query = SQLiteStoragePrivate::articlesQuery(args, d->fullTextSearch);
+
+    qCDebug(FUOTEN_STORAGE, "Start to query articles from the local SQLite database using the following query: %s", qUtf8Printable(query.sql));
+
+    bool qresult = false;
+    QSqlQuery *q = SQLiteStoragePrivate::execQuery(d->statements, query, &qresult);
+    Q_ASSERT_X(qresult, "get article", "failed to execute database query");
+
+    if (args.limit > 0) {
+        records.reserve(args.limit);
     }
 
-    if (args.starredOnly) {
-        qs.append(QLatin1String(" AND it.starred = 1"));
+    const bool withSnippet = d->fullTextSearch && !args.search.isEmpty() && (args.searchSnippetTokens > 0);
+
+    while (q->next()) {
+        records.append(SQLiteStoragePrivate::articleRecord(*q, args.bodyLimit, withSnippet));
     }
 
-    if (args.queuedOnly) {
-        qs.append(QLatin1String(" AND it.queue > 0"));
+    q->finish();
+
+    return records;
+}
+
+
+int SQLiteStorage::countArticles(const QueryArgs &args)
+{
+    const ArticleCountList counts = countArticlesGrouped(args, FuotenEnums::NoGrouping);
+    return counts.isEmpty() ? 0 : counts.first().total;
+}
+
+
+ArticleCountList SQLiteStorage::countArticlesGrouped(const QueryArgs &args, FuotenEnums::ArticleGrouping grouping)
+{
+    ArticleCountList counts;
+
+    if (!ready()) {
+        qCWarning(FUOTEN_STORAGE, "SQLite database not ready. Can not count articles in database.");
+        return counts;
     }
 
-    switch(args.sortingRole) {
-    case FuotenEnums::Time:
-        qs.append(QLatin1String(" ORDER BY it.pubDate"));
-        break;
-    case FuotenEnums::ID:
-        qs.append(QLatin1String(" ORDER BY it.id"));
-        break;
-    case FuotenEnums::Name:
-        qs.append(QLatin1String(" ORDER BY it.title"));
-        break;
-    case FuotenEnums::FolderName:
-        qs.append(QLatin1String(" ORDER BY fo.name"));
-        break;
-    default:
-        qs.append(QLatin1String(" ORDER BY it.pubDate"));
-        break;
+    Q_D(SQLiteStorage);
+
+    const SQLiteQuery query = SQLiteStoragePrivate::articleCountsQuery(args, grouping, d->fullTextSearch);
+
+    bool qresult = false;
+    QSqlQuery *q = SQLiteStoragePrivate::execQuery(d->statements, query, &qresult);
+    Q_ASSERT_X(qresult, "count articles", "failed to execute database query");
+
+    while (q->next()) {
+        ArticleCount c;
+        c.group = q->value(0).toLongLong();
+        c.total = q->value(1).toInt();
+        c.unread = q->value(2).toInt();
+        c.starred = q->value(3).toInt();
+        if (c.total > 0) {
+            counts.append(c);
+        }
     }
 
-    if (args.sortOrder== Qt::AscendingOrder) {
-        qs.append(QLatin1String(" ASC"));
-    } else {
-        qs.append(QLatin1String(" DESC"));
+    q->finish();
+
+    return counts;
+}
+
+
+QString SQLiteStoragePrivate::ftsMatchExpression(const QString &search)
+{
+    // every word becomes a quoted phrase, so the search term can not contain FTS5 query syntax
+    const QString simplified = search.simplified();
+    if (simplified.isEmpty()) {
+        return QString();
     }
 
-    if (args.limit > 0) {
-        qs.append(QLatin1String(" LIMIT ")).append(QString::number(args.limit));
+    QStringList phrases;
+    const QStringList words = simplified.split(QLatin1Char(' '));
+    phrases.reserve(words.size());
+    for (QString word : words) {
+        word.replace(QLatin1Char('"'), QLatin1String("\"\""));
+        phrases.append(QLatin1Char('"') + word + QLatin1Char('"'));
     }
 
-    qDebug("Start to query articles from the local SQLite database using the following query: %s", qUtf8Printable(qs));
+    // the last word might still be typed
+    phrases.last().append(QLatin1Char('*'));
 
-    QSqlQuery q(d->db);
-    q.setForwardOnly(true);
+    return phrases.join(QLatin1Char(' '));
+}
 
-    bool qresult = q.exec(qs);
-    Q_ASSERT_X(qresult, "get article", "failed to execute database query");
 
-    while (q.next()) {
-        QString body;
+QString SQLiteStoragePrivate::plainText(const QString &body)
+{
+    if (body.isEmpty()) {
+        return body;
+    }
 
-        if (args.bodyLimit > -1) {
+    static const QRegularExpression tags(QStringLiteral("<[^>]*>"));
 
-            body = q.value(9).toString();
+    QString s = body;
+    s.replace(tags, QStringLiteral(" "));
+    return s.simplified();
+}
 
-            if (args.bodyLimit > 0) {
 
-                body.replace(QRegularExpression(QStringLiteral("<[^>]*>")), QStringLiteral(" "));
-                body = body.simplified();
-                body = body.left(args.bodyLimit);
-            }
+QString SQLiteStoragePrivate::excerpt(const QString &body, int length)
+{
+    return plainText(body).left(length);
+}
 
-        }
 
-        articles.append(new Article(q.value(0).toLongLong(),
-                                 q.value(1).toLongLong(),
-                                 q.value(2).toString(),
-                                 q.value(3).toString(),
-                                 q.value(4).toString(),
-                                 QUrl(q.value(5).toString()),
-                                 q.value(6).toString(),
-                                 q.value(7).toString(),
-#if (QT_VERSION >= QT_VERSION_CHECK(5, 8, 0))
-                                 QDateTime::fromSecsSinceEpoch(q.value(8).toUInt()),
-#else
-                                 QDateTime::fromTime_t(q.value(8).toUInt()),
-#endif
-                                 body,
-                                 q.value(10).toString(),
-                                 QUrl(q.value(11).toString()),
-                                 q.value(12).toBool(),
-                                 q.value(13).toBool(),
-#if (QT_VERSION >= QT_VERSION_CHECK(5, 8, 0))
-                                 QDateTime::fromSecsSinceEpoch(q.value(14).toUInt()),
-#else
-                                 QDateTime::fromTime_t(q.value(14).toUInt()),
-#endif
-                                 q.value(15).toString(),
-                                 q.value(16).toLongLong(),
-                                 q.value(17).toString(),
-                                 FuotenEnums::QueueActions(q.value(18).toInt()),
-                                 q.value(19).toBool(),
-                                 QUrl(q.value(20).toString()),
-                                 q.value(21).toString()
-                                 ));
+QByteArray SQLiteStoragePrivate::compressBody(const QString &body)
+{
+    return qCompress(body.toUtf8());
+}
+
+
+QString SQLiteStoragePrivate::uncompressBody(const QByteArray &data)
+{
+    if (data.isEmpty()) {
+        return QString();
     }
 
-    return articles;
+    return QString::fromUtf8(qUncompress(data));
 }
 
 
+QString SQLiteStoragePrivate::bodyColumn(int bodyLimit)
+{
+    if (bodyLimit < 0) {
+        return QStringLiteral("NULL");
+    } else if ((bodyLimit > 0) && (bodyLimit <= excerptLength)) {
+        return QStringLiteral("it.excerpt");
+    } else {
+        return QStringLiteral("b.body");
+    }
+}
 
-GetArticlesAsyncWorker::GetArticlesAsyncWorker(const QString &dbpath, const QueryArgs &args, QObject *parent) :
-    QThread(parent), m_args(args)
+
+QString SQLiteStoragePrivate::bodyJoin(int bodyLimit)
 {
-    if (!QSqlDatabase::connectionNames().contains(QStringLiteral("fuotendb"))) {
-        m_db = QSqlDatabase::addDatabase(QStringLiteral("QSQLITE"), QStringLiteral("fuotendb"));
-        m_db.setDatabaseName(dbpath);
+    if ((bodyLimit == 0) || (bodyLimit > excerptLength)) {
+        return QStringLiteral(" LEFT JOIN item_bodies b ON b.id = it.id");
     } else {
-        m_db = QSqlDatabase::database(QStringLiteral("fuotendb"));
+        return QString();
     }
 }
 
 
-GetArticlesAsyncWorker::~GetArticlesAsyncWorker()
+/*!
+ * \internal
+ * Executes the statement of \a query from \a statements with the bound values of \a query, the IDs
+ * of \a query are inserted into the temporary query_ids table before. \a ok will be set to \c false
+ * if anything failed.
+ */
+QSqlQuery *SQLiteStoragePrivate::execQuery(SQLiteStatementCache &statements, const SQLiteQuery &query, bool *ok)
 {
+    bool qresult = true;
+
+    if (!query.ids.isEmpty()) {
+        statements.exec(QStringLiteral("CREATE TEMP TABLE IF NOT EXISTS query_ids (id INTEGER PRIMARY KEY)"), &qresult);
+
+        if (Q_LIKELY(qresult)) {
+            statements.exec(QStringLiteral("DELETE FROM temp.query_ids"), &qresult);
+        }
+
+        if (Q_LIKELY(qresult)) {
+            QSqlQuery *iq = statements.query(QStringLiteral("INSERT OR IGNORE INTO temp.query_ids (id) VALUES (?)"), &qresult);
+            if (Q_LIKELY(qresult)) {
+                QVariantList ids;
+                ids.reserve(query.ids.size());
+                for (const qint64 id : query.ids) {
+                    ids.append(id);
+                }
+                iq->addBindValue(ids);
+                qresult = iq->execBatch();
+            }
+        }
+    }
 
+    bool prepared = false;
+    QSqlQuery *q = statements.query(query.sql, &prepared);
+
+    if (Q_LIKELY(qresult && prepared)) {
+        for (const QVariant &value : query.values) {
+            q->addBindValue(value);
+        }
+        qresult = q->exec();
+    } else {
+        qresult = false;
+    }
+
+    if (ok) {
+        *ok = qresult;
+    }
+
+    return q;
 }
 
 
-void GetArticlesAsyncWorker::run()
+SQLiteQuery SQLiteStoragePrivate::foldersQuery(FuotenEnums::SortingRole sortingRole, Qt::SortOrder sortOrder, const IdList &ids, FuotenEnums::Type idType, int limit)
 {
-    QList<Article*> articles;
+    SQLiteQuery query;
+
+    QString &qs = query.sql;
+    qs = QStringLiteral("SELECT id, name, feedCount, unreadCount FROM folders");
+
+    if (!ids.isEmpty()) {
+        if (idType == FuotenEnums::Feed) {
+            qs.append(QLatin1String(" WHERE id IN (SELECT folderId FROM feeds WHERE id IN (SELECT id FROM temp.query_ids))"));
+        } else {
+            qs.append(QLatin1String(" WHERE id IN (SELECT id FROM temp.query_ids)"));
+        }
+        query.ids = ids;
+    }
 
-    QSqlQuery q(m_db);
+    switch(sortingRole) {
+    case FuotenEnums::Name:
+        qs.append(QLatin1String(" ORDER BY name"));
+        break;
+    case FuotenEnums::ID:
+        qs.append(QLatin1String(" ORDER BY id"));
+        break;
+    case FuotenEnums::UnreadCount:
+        qs.append(QLatin1String(" ORDER BY unreadCount"));
+        break;
+    case FuotenEnums::FeedCount:
+        qs.append(QLatin1String(" ORDER BY feedCount"));
+        break;
+    default:
+        qs.append(QLatin1String(" ORDER BY name"));
+        break;
+    }
+
+    if (sortOrder == Qt::AscendingOrder) {
+        qs.append(QLatin1String(" ASC"));
+    } else {
+        qs.append(QLatin1String(" DESC"));
+    }
 
-    bool qresult = q.exec(QStringLiteral("PRAGMA foreign_keys = ON"));
-    Q_ASSERT_X(qresult, "get articles async", "failed to enable foreign keys support");
+    qs.append(QLatin1String(" LIMIT ?"));
+    query.values.append((limit > 0) ? limit : -1);
+
+    return query;
+}
 
-    QString qs = QStringLiteral("SELECT it.id, it.feedId, fe.title, it.guid, it.guidHash, it.url, it.title, it.author, it.pubDate, it.body, it.enclosureMime, it.enclosureLink, it.unread, it.starred, it.lastModified, it.fingerprint, fo.id, fo.name, it.queue, it.rtl, it.mediaThumbnail, it.mediaDescription FROM items it LEFT JOIN feeds fe ON fe.id = it.feedId LEFT JOIN folders fo on fo.id = fe.folderId");
 
+SQLiteQuery SQLiteStoragePrivate::feedsQuery(const QueryArgs &args)
+{
+    SQLiteQuery query;
+
+    QString &qs = query.sql;
+    qs = QStringLiteral("SELECT fe.id, fe.folderId, fe.title, fe.url, fe.link, fe.added, fe.unreadCount, fe.ordering, fe.pinned, fe.updateErrorCount, fe.lastUpdateError, fe.faviconLink, fo.name AS folderName FROM feeds fe LEFT JOIN folders fo ON fo.id = fe.folderId WHERE 1");
+
+    if (args.parentId > -1) {
+        qs.append(QLatin1String(" AND fe.folderId = ?"));
+        query.values.append(args.parentId);
+    }
+
+    if (!args.inIds.isEmpty() && ((args.inIdsType == FuotenEnums::Feed) || (args.inIdsType == FuotenEnums::Folder))) {
+        if (args.inIdsType == FuotenEnums::Folder) {
+            qs.append(QLatin1String(" AND fe.folderId IN (SELECT id FROM temp.query_ids)"));
+        } else {
+            qs.append(QLatin1String(" AND fe.id IN (SELECT id FROM temp.query_ids)"));
+        }
+        query.ids = args.inIds;
+    }
+
+    if (args.unreadOnly) {
+        qs.append(QLatin1String(" AND fe.unreadCount > 0"));
+    }
+
+    switch(args.sortingRole) {
+    case FuotenEnums::Name:
+        qs.append(QLatin1String(" ORDER BY fe.title"));
+        break;
+    case FuotenEnums::FolderName:
+        qs.append(QLatin1String(" ORDER BY fo.name"));
+        break;
+    case FuotenEnums::ID:
+        qs.append(QLatin1String(" ORDER BY fe.id"));
+        break;
+    case FuotenEnums::UnreadCount:
+        qs.append(QLatin1String(" ORDER BY fe.unreadCount"));
+        break;
+    default:
+        qs.append(QLatin1String(" ORDER BY fe.title"));
+        break;
+    }
+
+    if (args.sortOrder == Qt::AscendingOrder) {
+        qs.append(QLatin1String(" ASC"));
+    } else {
+        qs.append(QLatin1String(" DESC"));
+    }
+
+    qs.append(QLatin1String(" LIMIT ?"));
+    query.values.append((args.limit > 0) ? args.limit : -1);
+
+    return query;
+}
+
+
+/*!
+ * \internal
+ * Appends the WHERE clause for the filters of \a args to \a query, \a fts has to be \c true if
+ * the items_fts table is part of the query.
+ */
+void SQLiteStoragePrivate::appendArticlesFilter(SQLiteQuery &query, const QueryArgs &args, bool fts)
+{
+    const bool search = !args.search.simplified().isEmpty();
+
+    query.sql.append(QLatin1String(" WHERE it.pubDate < ?"));
 #if (QT_VERSION >= QT_VERSION_CHECK(5, 8, 0))
-    qs.append(QStringLiteral(" WHERE it.pubDate < %1").arg(QString::number(QDateTime::currentDateTimeUtc().toSecsSinceEpoch())));
+    query.values.append(QDateTime::currentDateTimeUtc().toSecsSinceEpoch());
 #else
-    qs.append(QStringLiteral(" WHERE it.pubDate < %1").arg(QString::number(QDateTime::currentDateTimeUtc().toTime_t())));
+    query.values.append(QDateTime::currentDateTimeUtc().toTime_t());
 #endif
 
-    if (m_args.parentId > -1) {
-        if (m_args.parentIdType == FuotenEnums::Feed) {
-            qs.append(QStringLiteral(" AND it.feedId = %1").arg(QString::number(m_args.parentId)));
-        } else {
-            qs.append(QStringLiteral(" AND it.feedId IN (SELECT id FROM feeds WHERE folderId = %1)").arg(m_args.parentId));
+    if (fts) {
+        query.sql.append(QLatin1String(" AND items_fts MATCH ?"));
+        query.values.append(ftsMatchExpression(args.search));
+    } else if (search) {
+        const QStringList words = args.search.simplified().split(QLatin1Char(' '));
+        for (QString word : words) {
+            word.replace(QLatin1Char('\\'), QLatin1String("\\\\"));
+            word.replace(QLatin1Char('%'), QLatin1String("\\%"));
+            word.replace(QLatin1Char('_'), QLatin1String("\\_"));
+            word.prepend(QLatin1Char('%')).append(QLatin1Char('%'));
+            query.sql.append(QLatin1String(" AND (it.title LIKE ? ESCAPE '\\' OR it.excerpt LIKE ? ESCAPE '\\')"));
+            query.values.append(word);
+            query.values.append(word);
         }
     }
 
-    if (!m_args.inIds.isEmpty()) {
-        QString idListString;
-        if (m_args.inIds.count() == 1) {
-            idListString = QString::number(m_args.inIds.first());
+    if (args.parentId > -1) {
+        if (args.parentIdType == FuotenEnums::Feed) {
+            query.sql.append(QLatin1String(" AND it.feedId = ?"));
         } else {
-            const IdList ids = m_args.inIds;
-            QStringList sl;
-            sl.reserve(ids.size());
-            for (qint64 id : ids) {
-                sl.append(QString::number(id));
-            }
-            idListString = sl.join(QLatin1Char(','));
+            query.sql.append(QLatin1String(" AND it.feedId IN (SELECT id FROM feeds WHERE folderId = ?)"));
         }
+        query.values.append(args.parentId);
+    }
 
-
-        switch(m_args.inIdsType) {
+    if (!args.inIds.isEmpty()) {
+        switch(args.inIdsType) {
         case FuotenEnums::Folder:
-            qs.append(QStringLiteral(" AND it.feedId IN (SELECT id FROM feeds WHERE folderId IN (%1))").arg(idListString));
+            query.sql.append(QLatin1String(" AND it.feedId IN (SELECT id FROM feeds WHERE folderId IN (SELECT id FROM temp.query_ids))"));
             break;
         case FuotenEnums::Feed:
-            qs.append(QStringLiteral(" AND it.feedId IN (%1)").arg(idListString));
+            query.sql.append(QLatin1String(" AND it.feedId IN (SELECT id FROM temp.query_ids)"));
             break;
         default:
-            qs.append(QStringLiteral(" AND it.id IN (%1)").arg(idListString));
+            query.sql.append(QLatin1String(" AND it.id IN (SELECT id FROM temp.query_ids)"));
             break;
         }
+        query.ids = args.inIds;
+    }
+
+    if (args.unreadOnly) {
+        query.sql.append(QLatin1String(" AND it.unread = 1"));
+    }
+
+    if (args.starredOnly) {
+        query.sql.append(QLatin1String(" AND it.starred = 1"));
+    }
+
+    if (args.queuedOnly) {
+        query.sql.append(QLatin1String(" AND it.queue > 0"));
+    }
+}
+
+
+SQLiteQuery SQLiteStoragePrivate::articleCountsQuery(const QueryArgs &args, FuotenEnums::ArticleGrouping grouping, bool fullTextSearch)
+{
+    SQLiteQuery query;
+
+    const bool fts = fullTextSearch && !args.search.simplified().isEmpty();
+
+    QString group;
+    switch (grouping) {
+    case FuotenEnums::GroupByFeed:
+        group = QStringLiteral("it.feedId");
+        break;
+    case FuotenEnums::GroupByFolder:
+        group = QStringLiteral("fe.folderId");
+        break;
+    case FuotenEnums::GroupByUnread:
+        group = QStringLiteral("it.unread");
+        break;
+    case FuotenEnums::GroupByStarred:
+        group = QStringLiteral("it.starred");
+        break;
+    case FuotenEnums::GroupByDay:
+        group = QStringLiteral("(it.pubDate - (it.pubDate % 86400))");
+        break;
+    default:
+        group = QStringLiteral("0");
+        break;
     }
 
-    if (m_args.unreadOnly) {
-        qs.append(QLatin1String(" AND it.unread = 1"));
+    QString &qs = query.sql;
+    qs = QStringLiteral("SELECT %1, COUNT(*), IFNULL(SUM(it.unread), 0), IFNULL(SUM(it.starred), 0)").arg(group);
+
+    if (fts) {
+        qs.append(QLatin1String(" FROM items_fts JOIN items it ON it.id = items_fts.rowid"));
+    } else {
+        qs.append(QLatin1String(" FROM items it"));
     }
 
-    if (m_args.starredOnly) {
-        qs.append(QLatin1String(" AND it.starred = 1"));
+    if (grouping == FuotenEnums::GroupByFolder) {
+        qs.append(QLatin1String(" LEFT JOIN feeds fe ON fe.id = it.feedId"));
     }
 
-    if (m_args.queuedOnly) {
-        qs.append(QStringLiteral(" AND it.queue > 0"));
+    appendArticlesFilter(query, args, fts);
+
+    if (grouping != FuotenEnums::NoGrouping) {
+        qs.append(QStringLiteral(" GROUP BY %1 ORDER BY %1").arg(group));
     }
 
-    switch(m_args.sortingRole) {
+    return query;
+}
+
+
+SQLiteQuery SQLiteStoragePrivate::articlesQuery(const QueryArgs &args, bool fullTextSearch)
+{
+    SQLiteQuery query;
+
+    const bool fts = fullTextSearch && !args.search.simplified().isEmpty();
+
+    QString &qs = query.sql;
+    qs = QStringLiteral("SELECT it.id, it.feedId, fe.title, it.guid, it.guidHash, it.url, it.title, it.author, it.pubDate, %1, it.enclosureMime, it.enclosureLink, it.unread, it.starred, it.lastModified, it.fingerprint, fo.id, fo.name, it.queue, it.rtl, it.mediaThumbnail, it.mediaDescription").arg(bodyColumn(args.bodyLimit));
+
+    if (fts) {
+        if (args.searchSnippetTokens > 0) {
+            qs.append(QLatin1String(", snippet(items_fts, -1, '<b>', '</b>', '...', ?)"));
+            query.values.append(qBound(1, args.searchSnippetTokens, 64));
+        }
+        qs.append(QLatin1String(" FROM items_fts JOIN items it ON it.id = items_fts.rowid"));
+    } else {
+        qs.append(QLatin1String(" FROM items it"));
+    }
+
+    qs.append(QLatin1String(" LEFT JOIN feeds fe ON fe.id = it.feedId LEFT JOIN folders fo on fo.id = fe.folderId"));
+    qs.append(bodyJoin(args.bodyLimit));
+
+    appendArticlesFilter(query, args, fts);
+
+    if (args.cursorId > -1) {
+        const QString op = (args.sortOrder == Qt::AscendingOrder) ? QStringLiteral(">") : QStringLiteral("<");
+        if (args.sortingRole == FuotenEnums::ID) {
+            qs.append(QStringLiteral(" AND it.id %1 ?").arg(op));
+            query.values.append(args.cursorId);
+        } else if ((args.sortingRole == FuotenEnums::Time) && args.cursorPubDate.isValid()) {
+            qs.append(QStringLiteral(" AND (it.pubDate %1 ? OR (it.pubDate = ? AND it.id %1 ?))").arg(op));
+#if (QT_VERSION >= QT_VERSION_CHECK(5, 8, 0))
+            const qint64 cursorPubDate = args.cursorPubDate.toSecsSinceEpoch();
+#else
+            const qint64 cursorPubDate = args.cursorPubDate.toTime_t();
+#endif
+            query.values.append(cursorPubDate);
+            query.values.append(cursorPubDate);
+            query.values.append(args.cursorId);
+        }
+    }
+
+    switch(args.sortingRole) {
     case FuotenEnums::Time:
         qs.append(QLatin1String(" ORDER BY it.pubDate"));
         break;
@@ -1916,77 +2516,138 @@ void GetArticlesAsyncWorker::run()
     case FuotenEnums::FolderName:
         qs.append(QLatin1String(" ORDER BY fo.name"));
         break;
+    case FuotenEnums::Relevance:
+        qs.append(fts ? QLatin1String(" ORDER BY bm25(items_fts)") : QLatin1String(" ORDER BY it.pubDate"));
+        break;
     default:
         qs.append(QLatin1String(" ORDER BY it.pubDate"));
         break;
     }
 
-    if (m_args.sortOrder== Qt::AscendingOrder) {
+    // lower bm25 values are better matches, descending order returns the best matches first
+    const bool ascending = (fts && (args.sortingRole == FuotenEnums::Relevance)) ? (args.sortOrder != Qt::AscendingOrder) : (args.sortOrder == Qt::AscendingOrder);
+
+    if (ascending) {
         qs.append(QLatin1String(" ASC"));
     } else {
         qs.append(QLatin1String(" DESC"));
     }
 
-    if (m_args.limit > 0) {
-        qs.append(QLatin1String(" LIMIT ")).append(QString::number(m_args.limit));
+    // articles with the same publication date need a stable order for keyset pagination
+    if (args.sortingRole == FuotenEnums::Time) {
+        qs.append((args.sortOrder == Qt::AscendingOrder) ? QLatin1String(", it.id ASC") : QLatin1String(", it.id DESC"));
     }
 
-    qDebug("Start to query articles fromt the local SQLite database using the following query: %s", qUtf8Printable(qs));
+    // a negative limit returns all rows, so limited and unlimited queries share the same statement
+    qs.append(QLatin1String(" LIMIT ?"));
+    query.values.append((args.limit > 0) ? args.limit : -1);
 
-    q.setForwardOnly(true);
-    qresult = q.exec(qs);
-    Q_ASSERT_X(qresult, "get articles async", "failed to execute database query");
+    return query;
+}
 
-    while (q.next()) {
-        QString body;
 
-        if (m_args.bodyLimit > -1) {
+ArticleRecord SQLiteStoragePrivate::articleRecord(const QSqlQuery &q, int bodyLimit, bool withSnippet)
+{
+    ArticleRecord r;
+
+    r.id = q.value(0).toLongLong();
+    r.feedId = q.value(1).toLongLong();
+    r.feedTitle = q.value(2).toString();
+    r.guid = q.value(3).toString();
+    r.guidHash = q.value(4).toString();
+    r.url = q.value(5).toString();
+    r.title = q.value(6).toString();
+    r.author = q.value(7).toString();
+    r.pubDate = q.value(8).toLongLong();
 
-            body = q.value(9).toString();
+    if (bodyLimit == 0) {
+        r.body = uncompressBody(q.value(9).toByteArray());
+    } else if (bodyLimit > excerptLength) {
+        r.body = excerpt(uncompressBody(q.value(9).toByteArray()), bodyLimit);
+    } else if (bodyLimit > 0) {
+        r.body = q.value(9).toString();
+        r.body.truncate(bodyLimit);
+    }
 
-            if (m_args.bodyLimit > 0) {
+    r.enclosureMime = q.value(10).toString();
+    r.enclosureLink = q.value(11).toString();
+    r.unread = q.value(12).toBool();
+    r.starred = q.value(13).toBool();
+    r.lastModified = q.value(14).toLongLong();
+    r.fingerprint = q.value(15).toString();
+    r.folderId = q.value(16).toLongLong();
+    r.folderName = q.value(17).toString();
+    r.queue = FuotenEnums::QueueActions(q.value(18).toInt());
+    r.rtl = q.value(19).toBool();
+    r.mediaThumbnail = q.value(20).toString();
+    r.mediaDescription = q.value(21).toString();
 
-                body.replace(QRegularExpression(QStringLiteral("<[^>]*>")), QStringLiteral(" "));
-                body = body.simplified();
-                body = body.left(m_args.bodyLimit);
-            }
+    if (withSnippet) {
+        r.snippet = q.value(22).toString();
+    }
+
+    return r;
+}
+
+
+
+GetArticlesAsyncWorker::GetArticlesAsyncWorker(const QString &dbpath, const QueryArgs &args, bool fullTextSearch, const StorageRequest &request, QObject *parent) :
+    QObject(parent), QRunnable(), m_dbpath(dbpath), m_args(args), m_request(request), m_fullTextSearch(fullTextSearch)
+{
+    setAutoDelete(false);
+}
+
+
+GetArticlesAsyncWorker::~GetArticlesAsyncWorker()
+{
+
+}
 
+
+void GetArticlesAsyncWorker::run()
+{
+    if (m_request.isCanceled()) {
+        qCDebug(FUOTEN_STORAGE, "Skipping canceled article request %i.", m_request.id());
+        Q_EMIT finished();
+        return;
+    }
+
+    ArticleRecordList records;
+
+    SQLiteReader reader(m_dbpath);
+
+    const SQLiteQuery query = SQLiteStoragePrivate::articlesQuery(m_args, m_fullTextSearch);
+
+    qCDebug(FUOTEN_STORAGE, "Start to query articles fromt the local SQLite database using the following query: %s", qUtf8Printable(query.sql));
+
+    bool qresult = false;
+    QSqlQuery *q = SQLiteStoragePrivate::execQuery(*reader.statements(), query, &qresult);
+    Q_ASSERT_X(qresult, "get articles async", "failed to execute database query");
+
+    if (m_args.limit > 0) {
+        records.reserve(m_args.limit);
+    }
+
+    const bool withSnippet = m_fullTextSearch && !m_args.search.isEmpty() && (m_args.searchSnippetTokens > 0);
+
+    int row = 0;
+    while (q->next()) {
+        // do not check on every row, the flag is shared with other threads
+        if (((++row % 64) == 0) && m_request.isCanceled()) {
+            break;
         }
+        records.append(SQLiteStoragePrivate::articleRecord(*q, m_args.bodyLimit, withSnippet));
+    }
 
-        articles.append(new Article(q.value(0).toLongLong(),
-                                 q.value(1).toLongLong(),
-                                 q.value(2).toString(),
-                                 q.value(3).toString(),
-                                 q.value(4).toString(),
-                                 QUrl(q.value(5).toString()),
-                                 q.value(6).toString(),
-                                 q.value(7).toString(),
-#if (QT_VERSION >= QT_VERSION_CHECK(5, 8, 0))
-                                 QDateTime::fromSecsSinceEpoch(q.value(8).toUInt()),
-#else
-                                 QDateTime::fromTime_t(q.value(8).toUInt()),
-#endif
-                                 body,
-                                 q.value(10).toString(),
-                                 QUrl(q.value(11).toString()),
-                                 q.value(12).toBool(),
-                                 q.value(13).toBool(),
-#if (QT_VERSION >= QT_VERSION_CHECK(5, 8, 0))
-                                 QDateTime::fromSecsSinceEpoch(q.value(14).toUInt()),
-#else
-                                 QDateTime::fromTime_t(q.value(14).toUInt()),
-#endif
-                                 q.value(15).toString(),
-                                 q.value(16).toLongLong(),
-                                 q.value(17).toString(),
-                                 FuotenEnums::QueueActions(q.value(18).toInt()),
-                                 q.value(19).toBool(),
-                                 QUrl(q.value(20).toString()),
-                                 q.value(21).toString()
-                                 ));
+    q->finish();
+
+    if (!m_request.isCanceled()) {
+        Q_EMIT gotArticleRecords(m_request.id(), records);
+    } else {
+        qCDebug(FUOTEN_STORAGE, "Canceled article request %i after reading %i rows.", m_request.id(), records.size());
     }
 
-    Q_EMIT gotArticles(articles);
+    Q_EMIT finished();
 }
 
 
@@ -1994,32 +2655,61 @@ void GetArticlesAsyncWorker::run()
 void SQLiteStorage::getArticlesAsync(const QueryArgs &args)
 {
     if (!ready()) {
-        qWarning("SQLite database not ready. Can not query articles from database.");
+        qCWarning(FUOTEN_STORAGE, "SQLite database not ready. Can not query articles from database.");
         Q_EMIT gotArticlesAsync(QList<Article*>());
         return;
     }
 
     Q_D(SQLiteStorage);
 
-    GetArticlesAsyncWorker *worker = new GetArticlesAsyncWorker(d->db.databaseName(), args, this);
-    connect(worker, &GetArticlesAsyncWorker::gotArticles, this, &AbstractStorage::gotArticlesAsync);
+    GetArticlesAsyncWorker *worker = new GetArticlesAsyncWorker(d->dbpath, args, d->fullTextSearch, StorageRequest::create());
+    // the Article objects are created here, so they already belong to the thread of the receivers
+    connect(worker, &GetArticlesAsyncWorker::gotArticleRecords, this, [this] (int requestId, const ArticleRecordList &records) {
+        Q_UNUSED(requestId)
+        QList<Article*> articles;
+        articles.reserve(records.size());
+        for (const ArticleRecord &r : records) {
+            articles.append(new Article(r));
+        }
+        Q_EMIT gotArticlesAsync(articles);
+    });
     connect(worker, &GetArticlesAsyncWorker::failed, this, [=] (Error *e) {setError(e);});
-    connect(worker, &QThread::finished, worker, &QObject::deleteLater);
-    worker->start();
+    connect(worker, &GetArticlesAsyncWorker::finished, worker, &QObject::deleteLater);
+    d->readerPool.start(worker);
+}
 
+
+StorageRequest SQLiteStorage::getArticleRecordsAsync(const QueryArgs &args)
+{
+    const StorageRequest request = StorageRequest::create();
+
+    if (!ready()) {
+        qCWarning(FUOTEN_STORAGE, "SQLite database not ready. Can not query articles from database.");
+        QTimer::singleShot(0, this, [this, request] () {
+            if (!request.isCanceled()) {
+                Q_EMIT gotArticleRecordsAsync(request.id(), ArticleRecordList());
+            }
+        });
+        return request;
+    }
+
+    Q_D(SQLiteStorage);
+
+    GetArticlesAsyncWorker *worker = new GetArticlesAsyncWorker(d->dbpath, args, d->fullTextSearch, request);
+    connect(worker, &GetArticlesAsyncWorker::gotArticleRecords, this, &AbstractStorage::gotArticleRecordsAsync);
+    connect(worker, &GetArticlesAsyncWorker::failed, this, [=] (Error *e) {setError(e);});
+    connect(worker, &GetArticlesAsyncWorker::finished, worker, &QObject::deleteLater);
+    d->readerPool.start(worker);
+
+    return request;
 }
 
 
 
-ItemsRequestedWorker::ItemsRequestedWorker(const QString &dbpath, const QJsonDocument &json, AbstractConfiguration *config, AbstractNotificator *notificator, QObject *parent) :
-    QThread(parent), m_json(json), m_config(config), m_notificator(notificator)
+ItemsRequestedWorker::ItemsRequestedWorker(const QString &dbpath, const QJsonArray &items, bool lastBatch, const QSharedPointer<ItemsRequestedState> &state, bool fullTextSearch, AbstractConfiguration *config, AbstractNotificator *notificator, QObject *parent) :
+    QThread(parent), m_dbpath(dbpath), m_items(items), m_state(state), m_config(config), m_notificator(notificator), m_lastBatch(lastBatch), m_fullTextSearch(fullTextSearch)
 {
-    if (!QSqlDatabase::connectionNames().contains(QStringLiteral("fuotendb"))) {
-        m_db = QSqlDatabase::addDatabase(QStringLiteral("QSQLITE"), QStringLiteral("fuotendb"));
-        m_db.setDatabaseName(dbpath);
-    } else {
-        m_db = QSqlDatabase::database(QStringLiteral("fuotendb"));
-    }
+
 }
 
 
@@ -2031,285 +2721,404 @@ ItemsRequestedWorker::~ItemsRequestedWorker()
 
 void ItemsRequestedWorker::run()
 {
-    QSqlQuery q(m_db);
+    Q_ASSERT_X(m_state, "items requested worker", "invalid items requested state");
 
-    bool qresult = q.exec(QStringLiteral("PRAGMA foreign_keys = ON"));
-    Q_ASSERT_X(qresult, "items requested worker", "failed to enable foreign keys support");
-    q.setForwardOnly(true);
+    QSqlDatabase db = SQLiteConnectionPool::database(m_dbpath);
+    SQLiteStatementCache &statements = *SQLiteConnectionPool::statements(m_dbpath);
+    QSqlQuery *q = nullptr;
 
-    const QJsonArray items = m_json.object().value(QStringLiteral("items")).toArray();
+    bool qresult = false;
 
-    IdList updatedItemIds;
-    IdList newItemIds;
     IdList removedItemIds;
 
-    if (items.isEmpty()) {
-        Q_EMIT requestedItems(updatedItemIds, newItemIds, removedItemIds);
-        qDebug("%s", "Nothing to do. No Items.");
+    if (m_lastBatch && m_items.isEmpty() && m_state->updatedItemIds.isEmpty() && m_state->newItemIds.isEmpty()) {
+        Q_EMIT requestedItems(m_state->updatedItemIds, m_state->newItemIds, removedItemIds);
+        qCDebug(FUOTEN_STORAGE, "%s", "Nothing to do. No Items.");
         return;
     }
 
-    QHash<qint64, uint> currentItems; // contains the ids and last modified time stamps of the local items
-
-    qresult = q.exec(QStringLiteral("SELECT id, lastModified FROM items"));
-    Q_ASSERT_X(qresult, "items requested worker", "failed to query current items from database");
+    const bool publishArticles = (m_notificator && m_notificator->isArticlePublishingEnabled());
 
-    while(q.next()) {
-        currentItems.insert(q.value(0).toLongLong(), q.value(1).toUInt());
-    }
+    // the items of the batch, the item retention and the counter updates of the last batch are
+    // written in a single transaction
+    qresult = db.transaction();
+    Q_ASSERT_X(qresult, "items requested worker", "failed to start database transaction");
 
-    QHash<qint64,QString> feedsIdTitleMap;
-    qresult = q.exec(QStringLiteral("SELECT id, title FROM feeds"));
-    Q_ASSERT(qresult);
+    if (!m_items.isEmpty()) {
 
-    while(q.next()) {
-        feedsIdTitleMap.insert(q.value(0).value<qint64>(), q.value(1).toString());
-    }
+        // the batch might be only a small part of a large request, so only look up the
+        // items of the current batch instead of loading all local items
+        QSqlQuery *lq = statements.query(QStringLiteral("SELECT lastModified, unread, feedId, fingerprint, title FROM items WHERE id = ?"), &qresult);
+        Q_ASSERT_X(qresult, "items requested worker", "failed to prepare querying current item from database");
 
+        const QJsonArray items = m_items;
+        for (const QJsonValue &i : items) {
+            const QJsonObject o = i.toObject();
+            if (Q_LIKELY(!o.isEmpty())) {
+                const qint64 id = AbstractStorage::getIdFromJson(o.value(QStringLiteral("id")));
 
-    qresult = m_db.transaction();
-    Q_ASSERT_X(qresult, "items requested worker", "failed to start database transaction");
+                lq->addBindValue(id);
+                qresult = lq->exec();
+                Q_ASSERT_X(qresult, "items requested worker", "failed to query current item from database");
 
-    quint32 newUnreadItems = 0;
+                if (lq->next()) {
 
-    QVector<QJsonObject> articlesToPublish;
-    const bool publishArticles = (m_notificator && m_notificator->isArticlePublishingEnabled());
+                    const uint currentLastMod = lq->value(0).toUInt();
+                    const bool currentUnread = lq->value(1).toBool();
+                    const qint64 feedId = lq->value(2).toLongLong();
+                    const QString currentFingerprint = lq->value(3).toString();
+                    const QString currentTitle = lq->value(4).toString();
+                    lq->finish();
 
-    for (const QJsonValue &i : items) {
-        const QJsonObject o = i.toObject();
-        if (Q_LIKELY(!o.isEmpty())) {
-            const qint64 id = AbstractStorage::getIdFromJson(o.value(QStringLiteral("id")));
-
-            if (!currentItems.isEmpty() && currentItems.contains(id)) {
-
-                uint lastMod = o.value(QStringLiteral("lastModified")).toInt();
-
-                if (currentItems.value(id) < lastMod) {
-
-                    updatedItemIds.append(id);
-
-
-                    qDebug("Updating the article \"%s\" with ID %lli in the database.", qUtf8Printable(o.value(QStringLiteral("title")).toString()), id);
-
-                    qresult = q.prepare(QStringLiteral("UPDATE items SET "
-                                                       "title = ?, "
-                                                       "url = ?, "
-                                                       "author = ?, "
-                                                       "pubDate = ?, "
-                                                       "enclosureMime = ?, "
-                                                       "enclosureLink = ?, "
-                                                       "unread = ?, "
-                                                       "starred = ?, "
-                                                       "lastModified = ?,"
-                                                       "fingerprint = ?, "
-                                                       "queue = 0 "
-                                                       "WHERE id = ?"
-                                                       ));
-                    Q_ASSERT_X(qresult, "items requested worker", "failed to prepare update of item into database");
-
-                    q.addBindValue(o.value(QStringLiteral("title")).toString(QStringLiteral("")));
-                    q.addBindValue(o.value(QStringLiteral("url")).toString(QStringLiteral("")));
-                    q.addBindValue(o.value(QStringLiteral("author")).toString(QStringLiteral("")));
-                    q.addBindValue(o.value(QStringLiteral("pubDate")).toInt());
-                    q.addBindValue(o.value(QStringLiteral("enclosureMime")).toString());
-                    q.addBindValue(o.value(QStringLiteral("enclosureLink")).toString());
-                    q.addBindValue(o.value(QStringLiteral("unread")).toBool());
-                    q.addBindValue(o.value(QStringLiteral("starred")).toBool());
-                    q.addBindValue(lastMod);
-                    q.addBindValue(o.value(QStringLiteral("fingerprint")).toString());
-                    q.addBindValue(id);
-
-                    qresult = q.exec();
-                    Q_ASSERT_X(qresult, "items requested worker", "failed to update item in databae");
-                }
+                    uint lastMod = o.value(QStringLiteral("lastModified")).toInt();
 
-            } else {
+                    if (currentLastMod < lastMod) {
 
-                newItemIds.append(id);
-                const bool unread = o.value(QStringLiteral("unread")).toBool();
-                if (unread) {
-                    newUnreadItems++;
-                }
+                        m_state->updatedItemIds.append(id);
 
-                qDebug("Adding new article \"%s\" with ID %lli to the database.", qUtf8Printable(o.value(QStringLiteral("title")).toString()), id);
-
-                qresult = q.prepare(QStringLiteral("INSERT INTO items (id, feedId, guid, guidHash, url, title, author, pubDate, body, enclosureMime, enclosureLink, unread, starred, lastModified, fingerprint, rtl, mediaThumbnail, mediaDescription) "
-                                                   "VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)"
-                                                   ));
-                Q_ASSERT_X(qresult, "items requested worker", "failed to prepare insertion of new item into database");
-
-                q.addBindValue(id);
-                q.addBindValue(AbstractStorage::getIdFromJson(o.value(QStringLiteral("feedId"))));
-                q.addBindValue(o.value(QStringLiteral("guid")).toString());
-                q.addBindValue(o.value(QStringLiteral("guidHash")).toString());
-                q.addBindValue(o.value(QStringLiteral("url")).toString(QStringLiteral("")));
-                q.addBindValue(o.value(QStringLiteral("title")).toString(QStringLiteral("")));
-                q.addBindValue(o.value(QStringLiteral("author")).toString(QStringLiteral("")));
-                q.addBindValue(o.value(QStringLiteral("pubDate")).toInt());
-                q.addBindValue(o.value(QStringLiteral("body")).toString(QStringLiteral("")));
-                q.addBindValue(o.value(QStringLiteral("enclosureMime")).toString());
-                q.addBindValue(o.value(QStringLiteral("enclosureLink")).toString());
-                q.addBindValue(unread);
-                q.addBindValue(o.value(QStringLiteral("starred")).toBool());
-                q.addBindValue(o.value(QStringLiteral("lastModified")).toInt());
-                q.addBindValue(o.value(QStringLiteral("fingerprint")).toString());
-                q.addBindValue(o.value(QStringLiteral("rtl")).toBool());
-                q.addBindValue(o.value(QStringLiteral("mediaThumbnail")).toString());
-                q.addBindValue(o.value(QStringLiteral("mediaDescription")).toString());
-
-                qresult = q.exec();
-                Q_ASSERT_X(qresult, "items requested worker", "failed to execute insertion of new item into database");
-
-                if (publishArticles && unread) {
-                    if (m_notificator->checkForPublishing(o)) {
-                        articlesToPublish.push_back(o);
-                    }
-                }
-            }
-        }
-    }
+                        const bool unread = o.value(QStringLiteral("unread")).toBool();
+                        if (unread != currentUnread) {
+                            m_state->feedUnreadDeltas[feedId] += unread ? 1 : -1;
+                        }
 
-    qresult = m_db.commit();
-    Q_ASSERT_X(qresult, "items requested worker", "failed to commit database transaction");
 
-    const IdList feedIds = feedsIdTitleMap.keys();
+                        qCDebug(FUOTEN_STORAGE, "Updating the article \"%s\" with ID %lli in the database.", qUtf8Printable(o.value(QStringLiteral("title")).toString()), id);
+
+                        q = statements.query(QStringLiteral("UPDATE items SET "
+                                                           "title = ?, "
+                                                           "url = ?, "
+                                                           "author = ?, "
+                                                           "pubDate = ?, "
+                                                           "enclosureMime = ?, "
+                                                           "enclosureLink = ?, "
+                                                           "unread = ?, "
+                                                           "starred = ?, "
+                                                           "lastModified = ?,"
+                                                           "fingerprint = ?, "
+                                                           "queue = 0 "
+                                                           "WHERE id = ?"
+                                                           ), &qresult);
+                        Q_ASSERT_X(qresult, "items requested worker", "failed to prepare update of item into database");
+
+                        q->addBindValue(o.value(QStringLiteral("title")).toString(QStringLiteral("")));
+                        q->addBindValue(o.value(QStringLiteral("url")).toString(QStringLiteral("")));
+                        q->addBindValue(o.value(QStringLiteral("author")).toString(QStringLiteral("")));
+                        q->addBindValue(o.value(QStringLiteral("pubDate")).toInt());
+                        q->addBindValue(o.value(QStringLiteral("enclosureMime")).toString());
+                        q->addBindValue(o.value(QStringLiteral("enclosureLink")).toString());
+                        q->addBindValue(unread);
+                        q->addBindValue(o.value(QStringLiteral("starred")).toBool());
+                        q->addBindValue(lastMod);
+                        q->addBindValue(o.value(QStringLiteral("fingerprint")).toString());
+                        q->addBindValue(id);
+
+                        qresult = q->exec();
+                        Q_ASSERT_X(qresult, "items requested worker", "failed to update item in databae");
+
+                        // only rewrite the body if the content has changed, lastModified also changes on read and starred state changes,
+                        // without a fingerprint on either side a change can not be ruled out
+                        const QString fingerprint = o.value(QStringLiteral("fingerprint")).toString();
+                        const bool bodyChanged = fingerprint.isEmpty() || currentFingerprint.isEmpty() || (fingerprint != currentFingerprint);
+                        const QString title = o.value(QStringLiteral("title")).toString(QStringLiteral(""));
+                        if (bodyChanged || (m_fullTextSearch && (title != currentTitle))) {
+
+                            const QString body = o.value(QStringLiteral("body")).toString(QStringLiteral(""));
+                            const QString plainText = SQLiteStoragePrivate::plainText(body);
+
+                            if (bodyChanged) {
+                                q = statements.query(QStringLiteral("UPDATE items SET excerpt = ? WHERE id = ?"), &qresult);
+                                Q_ASSERT_X(qresult, "items requested worker", "failed to prepare update of item excerpt into database");
+
+                                q->addBindValue(plainText.left(SQLiteStoragePrivate::excerptLength));
+                                q->addBindValue(id);
+
+                                qresult = q->exec();
+                                Q_ASSERT_X(qresult, "items requested worker", "failed to update item excerpt in database");
+
+                                q = statements.query(QStringLiteral("INSERT OR REPLACE INTO item_bodies (id, body) VALUES (?, ?)"), &qresult);
+                                Q_ASSERT_X(qresult, "items requested worker", "failed to prepare update of item body into database");
+
+                                q->addBindValue(id);
+                                q->addBindValue(SQLiteStoragePrivate::compressBody(body));
+
+                                qresult = q->exec();
+                                Q_ASSERT_X(qresult, "items requested worker", "failed to update item body in database");
+                            }
 
-    // cleaning feeds by deleting items over threshold
-    // but check for valid configuration object first
+                            if (m_fullTextSearch) {
+                                q = statements.query(QStringLiteral("DELETE FROM items_fts WHERE rowid = ?"), &qresult);
+                                Q_ASSERT_X(qresult, "items requested worker", "failed to prepare removing item from full text search index");
 
-    if (Q_LIKELY(m_config)) {
+                                q->addBindValue(id);
 
-        if (Q_LIKELY(!feedIds.isEmpty())) {
+                                qresult = q->exec();
+                                Q_ASSERT_X(qresult, "items requested worker", "failed to remove item from full text search index");
 
-            IdList iIds; // item IDs
-            for (qint64 fId : feedIds) {
+                                q = statements.query(QStringLiteral("INSERT INTO items_fts (rowid, title, body) VALUES (?, ?, ?)"), &qresult);
+                                Q_ASSERT_X(qresult, "items requested worker", "failed to prepare adding item to full text search index");
 
-                const FuotenEnums::ItemDeletionStrategy delStrat = m_config->getPerFeedDeletionStrategy(fId);
-                const quint16 delVal = m_config->getPerFeedDeletionValue(fId);
+                                q->addBindValue(id);
+                                q->addBindValue(title);
+                                q->addBindValue(plainText);
 
-                if ((delStrat != FuotenEnums::NoItemDeletion) && (delVal > 0)) {
+                                qresult = q->exec();
+                                Q_ASSERT_X(qresult, "items requested worker", "failed to add item to full text search index");
+                            }
+                        }
+                    }
 
-                    if (delStrat == FuotenEnums::DeleteItemsByCount) {
+                } else {
 
-                        qresult = q.prepare(QStringLiteral("SELECT id FROM items WHERE feedId = ? AND starred = 0 ORDER BY id DESC"));
-                        Q_ASSERT_X(qresult, "items requested worker", "failed to preparey querying item IDs from database");
+                    lq->finish();
 
-                        q.addBindValue(fId);
+                    m_state->newItemIds.append(id);
+                    const qint64 feedId = AbstractStorage::getIdFromJson(o.value(QStringLiteral("feedId")));
+                    const bool unread = o.value(QStringLiteral("unread")).toBool();
+                    if (unread) {
+                        m_state->newUnreadItems++;
+                        m_state->feedUnreadDeltas[feedId]++;
+                    }
 
-                        qresult = q.exec();
-                        Q_ASSERT_X(qresult, "items requested worker", "failed to execute querying item IDs from database");
+                    qCDebug(FUOTEN_STORAGE, "Adding new article \"%s\" with ID %lli to the database.", qUtf8Printable(o.value(QStringLiteral("title")).toString()), id);
+
+                    q = statements.query(QStringLiteral("INSERT INTO items (id, feedId, guid, guidHash, url, title, author, pubDate, body, excerpt, enclosureMime, enclosureLink, unread, starred, lastModified, fingerprint, rtl, mediaThumbnail, mediaDescription) "
+                                                       "VALUES (?, ?, ?, ?, ?, ?, ?, ?, '', ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)"
+                                                       ), &qresult);
+                    Q_ASSERT_X(qresult, "items requested worker", "failed to prepare insertion of new item into database");
+
+                    q->addBindValue(id);
+                    q->addBindValue(feedId);
+                    q->addBindValue(o.value(QStringLiteral("guid")).toString());
+                    q->addBindValue(o.value(QStringLiteral("guidHash")).toString());
+                    q->addBindValue(o.value(QStringLiteral("url")).toString(QStringLiteral("")));
+                    q->addBindValue(o.value(QStringLiteral("title")).toString(QStringLiteral("")));
+                    q->addBindValue(o.value(QStringLiteral("author")).toString(QStringLiteral("")));
+                    q->addBindValue(o.value(QStringLiteral("pubDate")).toInt());
+                    const QString body = o.value(QStringLiteral("body")).toString(QStringLiteral(""));
+                    const QString plainText = SQLiteStoragePrivate::plainText(body);
+                    q->addBindValue(plainText.left(SQLiteStoragePrivate::excerptLength));
+                    q->addBindValue(o.value(QStringLiteral("enclosureMime")).toString());
+                    q->addBindValue(o.value(QStringLiteral("enclosureLink")).toString());
+                    q->addBindValue(unread);
+                    q->addBindValue(o.value(QStringLiteral("starred")).toBool());
+                    q->addBindValue(o.value(QStringLiteral("lastModified")).toInt());
+                    q->addBindValue(o.value(QStringLiteral("fingerprint")).toString());
+                    q->addBindValue(o.value(QStringLiteral("rtl")).toBool());
+                    q->addBindValue(o.value(QStringLiteral("mediaThumbnail")).toString());
+                    q->addBindValue(o.value(QStringLiteral("mediaDescription")).toString());
+
+                    qresult = q->exec();
+                    Q_ASSERT_X(qresult, "items requested worker", "failed to execute insertion of new item into database");
+
+                    q = statements.query(QStringLiteral("INSERT INTO item_bodies (id, body) VALUES (?, ?)"), &qresult);
+                    Q_ASSERT_X(qresult, "items requested worker", "failed to prepare insertion of new item body into database");
+
+                    q->addBindValue(id);
+                    q->addBindValue(SQLiteStoragePrivate::compressBody(body));
+
+                    qresult = q->exec();
+                    Q_ASSERT_X(qresult, "items requested worker", "failed to execute insertion of new item body into database");
+
+                    if (m_fullTextSearch) {
+                        q = statements.query(QStringLiteral("INSERT INTO items_fts (rowid, title, body) VALUES (?, ?, ?)"), &qresult);
+                        Q_ASSERT_X(qresult, "items requested worker", "failed to prepare adding item to full text search index");
+
+                        q->addBindValue(id);
+                        q->addBindValue(o.value(QStringLiteral("title")).toString(QStringLiteral("")));
+                        q->addBindValue(plainText);
+
+                        qresult = q->exec();
+                        Q_ASSERT_X(qresult, "items requested worker", "failed to add item to full text search index");
+                    }
 
-                        iIds.clear();
-                        while (q.next()) {
-                            iIds.append(q.value(0).toLongLong());
+                    if (publishArticles && unread) {
+                        if (m_notificator->checkForPublishing(o)) {
+                            m_state->articlesToPublish.push_back(o);
                         }
+                    }
+                }
+            }
+        }
+    }
 
-                        if (iIds.count() > delVal) {
+    if (!m_lastBatch) {
+        // commit the counter changes together with the items of the batch, so that they
+        // stay consistent if a later batch is never processed
+        SQLiteStoragePrivate::applyUnreadDeltas(statements, m_state->feedUnreadDeltas);
 
-                            qDebug("Removing all items from feed with ID %lli, keeping only %i most recent items.", fId, delVal);
+        qresult = db.commit();
+        Q_ASSERT_X(qresult, "items requested worker", "failed to commit database transaction");
+        m_state->feedUnreadDeltas.clear();
 
-                            QStringList iIdsToDelete;
-                            for (int i = 0; i < iIds.count(); ++i) {
-                                if (i >= delVal) {
-                                    iIdsToDelete.append(QString::number(iIds.at(i)));
-                                    removedItemIds.append(iIds.at(i));
-                                }
-                            }
+        qCDebug(FUOTEN_STORAGE, "Processed batch of %i items.", m_items.size());
+        return;
+    }
 
-                            if (!iIdsToDelete.isEmpty()) {
-                                qresult = q.exec(QStringLiteral("DELETE FROM items WHERE id IN (%1)").arg(iIdsToDelete.join(QLatin1Char(','))));
-                                Q_ASSERT_X(qresult, "items requested worker", "failed to delete items from database");
-                            }
-                        }
+    QHash<qint64,QString> feedsIdTitleMap;
+    q = statements.exec(QStringLiteral("SELECT id, title FROM feeds"), &qresult);
+    Q_ASSERT(qresult);
+
+    while(q->next()) {
+        feedsIdTitleMap.insert(q->value(0).value<qint64>(), q->value(1).toString());
+    }
+
+    const IdList feedIds = feedsIdTitleMap.keys();
 
-                    } else {
+    // cleaning feeds by deleting items over threshold
+    // but check for valid configuration object first
 
-                        const QDateTime tt = QDateTime::currentDateTimeUtc().addDays(delVal * -1);
+    if (Q_LIKELY(m_config && !feedIds.isEmpty())) {
 
-                        qDebug("Removing all items older thant %s from the feed with ID %lli.", qUtf8Printable(tt.toString(Qt::ISODate)), fId);
+        // collect the limits of all feeds first and select the items to remove of all feeds
+        // with one set-based statement instead of querying and deleting the items feed by feed
+        statements.exec(QStringLiteral("CREATE TEMP TABLE IF NOT EXISTS retention_limits (feedId INTEGER PRIMARY KEY NOT NULL, maxCount INTEGER, minPubDate INTEGER)"), &qresult);
+        Q_ASSERT_X(qresult, "items requested worker", "failed to create temporary retention_limits table");
 
-                        qresult = q.prepare(QStringLiteral("SELECT id FROM items WHERE feedId = ? AND starred = 0 AND pubDate < ?"));
-                        Q_ASSERT_X(qresult, "items requested worker", "failed to prepare selecting item IDs from database");
+        statements.exec(QStringLiteral("CREATE TEMP TABLE IF NOT EXISTS retention_ids (id INTEGER PRIMARY KEY NOT NULL, feedId INTEGER NOT NULL, unread INTEGER NOT NULL)"), &qresult);
+        Q_ASSERT_X(qresult, "items requested worker", "failed to create temporary retention_ids table");
 
-                        q.addBindValue(fId);
-#if (QT_VERSION >= QT_VERSION_CHECK(5, 8, 0))
-                        q.addBindValue(tt.toSecsSinceEpoch());
-#else
-                        q.addBindValue(tt.toTime_t());
-#endif
+        statements.exec(QStringLiteral("DELETE FROM temp.retention_limits"), &qresult);
+        Q_ASSERT_X(qresult, "items requested worker", "failed to clear temporary retention_limits table");
 
-                        qresult = q.exec();
-                        Q_ASSERT_X(qresult, "items requested worker", "failed to selecting item IDs from database");
+        statements.exec(QStringLiteral("DELETE FROM temp.retention_ids"), &qresult);
+        Q_ASSERT_X(qresult, "items requested worker", "failed to clear temporary retention_ids table");
 
-                        while (q.next()) {
-                            removedItemIds.append(q.value(0).toLongLong());
-                        }
+        const QDateTime now = QDateTime::currentDateTimeUtc();
+        QVariantList limitFeedIds;
+        QVariantList limitMaxCounts;
+        QVariantList limitMinPubDates;
 
-                        qresult = q.prepare(QStringLiteral("DELETE FROM items WHERE feedId = ? AND starred = 0 AND pubDate < ?"));
-                        Q_ASSERT_X(qresult, "items requested worker", "failed to prepare item deletion from database");
+        for (qint64 fId : feedIds) {
 
-                        q.addBindValue(fId);
+            const FuotenEnums::ItemDeletionStrategy delStrat = m_config->getPerFeedDeletionStrategy(fId);
+            const quint16 delVal = m_config->getPerFeedDeletionValue(fId);
+
+            if ((delStrat != FuotenEnums::NoItemDeletion) && (delVal > 0)) {
+
+                limitFeedIds.append(fId);
+
+                if (delStrat == FuotenEnums::DeleteItemsByCount) {
+                    qCDebug(FUOTEN_STORAGE, "Removing all items from feed with ID %lli, keeping only %i most recent items.", fId, delVal);
+                    limitMaxCounts.append(delVal);
+                    limitMinPubDates.append(QVariant());
+                } else {
+                    const QDateTime tt = now.addDays(delVal * -1);
+                    qCDebug(FUOTEN_STORAGE, "Removing all items older thant %s from the feed with ID %lli.", qUtf8Printable(tt.toString(Qt::ISODate)), fId);
+                    limitMaxCounts.append(QVariant());
 #if (QT_VERSION >= QT_VERSION_CHECK(5, 8, 0))
-                        q.addBindValue(tt.toSecsSinceEpoch());
+                    limitMinPubDates.append(tt.toSecsSinceEpoch());
 #else
-                        q.addBindValue(tt.toTime_t());
+                    limitMinPubDates.append(tt.toTime_t());
 #endif
+                }
+            }
+        }
 
-                        qresult = q.exec();
-                        Q_ASSERT_X(qresult, "items requested worker", "failed to execute item deletion from database");
-                    }
+        if (!limitFeedIds.isEmpty()) {
+
+            q = statements.query(QStringLiteral("INSERT INTO temp.retention_limits (feedId, maxCount, minPubDate) VALUES (?, ?, ?)"), &qresult);
+            Q_ASSERT_X(qresult, "items requested worker", "failed to prepare insertion of retention limits");
+            q->addBindValue(limitFeedIds);
+            q->addBindValue(limitMaxCounts);
+            q->addBindValue(limitMinPubDates);
+            qresult = q->execBatch();
+            Q_ASSERT_X(qresult, "items requested worker", "failed to insert retention limits");
+
+            // a non-starred item is removed if it is older than the time limit of its feed or if
+            // its feed has at least as many newer non-starred items as allowed, comparisons
+            // with the NULL limit of the other strategy are never true
+            statements.exec(QStringLiteral("INSERT INTO temp.retention_ids (id, feedId, unread) "
+                                           "SELECT it.id, it.feedId, it.unread FROM items it JOIN temp.retention_limits l ON l.feedId = it.feedId "
+                                           "WHERE it.starred = 0 AND (it.pubDate < l.minPubDate "
+                                           "OR (SELECT COUNT(*) FROM items n WHERE n.feedId = it.feedId AND n.starred = 0 AND n.id > it.id) >= l.maxCount)"), &qresult);
+            Q_ASSERT_X(qresult, "items requested worker", "failed to select items to remove");
+
+            q = statements.exec(QStringLiteral("SELECT id, feedId, unread FROM temp.retention_ids"), &qresult);
+            Q_ASSERT_X(qresult, "items requested worker", "failed to query items to remove");
+
+            while (q->next()) {
+                removedItemIds.append(q->value(0).toLongLong());
+                if (q->value(2).toBool()) {
+                    m_state->feedUnreadDeltas[q->value(1).toLongLong()]--;
                 }
             }
+
+            if (!removedItemIds.isEmpty()) {
+                statements.exec(QStringLiteral("DELETE FROM items WHERE id IN (SELECT id FROM temp.retention_ids)"), &qresult);
+                Q_ASSERT_X(qresult, "items requested worker", "failed to delete items from database");
+            }
         }
     }
 
-    if (!feedIds.empty()) {
-        qresult = m_db.transaction();
-        Q_ASSERT(qresult);
-        qresult = q.prepare(QStringLiteral("UPDATE feeds SET unreadCount = (SELECT COUNT(id) FROM items WHERE unread = 1 AND feedId = :feedId) WHERE id = :feedId"));
-        Q_ASSERT(qresult);
-        for (const qint64 id : feedIds) {
-            q.bindValue(QStringLiteral(":feedId"), id);
-            qresult = q.exec();
-            Q_ASSERT(qresult);
+    SQLiteStoragePrivate::applyUnreadDeltas(statements, m_state->feedUnreadDeltas);
+
+    // read the records of the changed articles in this thread, so that the models do not
+    // have to query them again in the thread of the storage
+    ArticleChangeSet changes;
+    const int changedCount = m_state->updatedItemIds.size() + m_state->newItemIds.size();
+    const bool emitChanges = ((changedCount > 0) || !removedItemIds.isEmpty()) && (changedCount <= SQLiteStoragePrivate::maxChangeSetSize);
+
+    if (emitChanges && (changedCount > 0)) {
+
+        QueryArgs qa;
+        qa.inIds = m_state->updatedItemIds + m_state->newItemIds;
+        qa.inIdsType = FuotenEnums::Item;
+        qa.bodyLimit = SQLiteStoragePrivate::excerptLength;
+        qa.sortingRole = FuotenEnums::ID;
+        qa.sortOrder = Qt::AscendingOrder;
+
+        const SQLiteQuery query = SQLiteStoragePrivate::articlesQuery(qa, false);
+
+        q = SQLiteStoragePrivate::execQuery(statements, query, &qresult);
+        Q_ASSERT_X(qresult, "items requested worker", "failed to query changed articles");
+
+        QSet<qint64> newIds;
+        newIds.reserve(m_state->newItemIds.size());
+        for (const qint64 id : m_state->newItemIds) {
+            newIds.insert(id);
+        }
+
+        while (q->next()) {
+            const ArticleRecord r = SQLiteStoragePrivate::articleRecord(*q, qa.bodyLimit, false);
+            if (newIds.contains(r.id)) {
+                changes.added.append(r);
+            } else {
+                changes.updated.append(r);
+            }
         }
-        qresult = m_db.commit();
-        Q_ASSERT(qresult);
-    }
 
-    IdList folderIds;
-    qresult = q.exec(QStringLiteral("SELECT id FROM folders"));
-    Q_ASSERT(qresult);
-    while (q.next()) {
-        folderIds.push_back(q.value(0).value<qint64>());
+        q->finish();
     }
 
-    if (!folderIds.empty()) {
-        qresult = m_db.transaction();
-        Q_ASSERT(qresult);
-        qresult = q.prepare(QStringLiteral("UPDATE folders SET unreadCount = (SELECT SUM(unreadCount) FROM feeds WHERE folderId = :folderId) WHERE id = :folderId"));
-        Q_ASSERT(qresult);
-        for (const qint64 id : folderIds) {
-            q.bindValue(QStringLiteral(":folderId"), id);
-            qresult = q.exec();
-            Q_ASSERT(qresult);
-        }
-        qresult = m_db.commit();
-        Q_ASSERT(qresult);
-    }
+    changes.removed = removedItemIds;
+    changes.bodyLimit = SQLiteStoragePrivate::excerptLength;
+
+    qresult = db.commit();
+    Q_ASSERT_X(qresult, "items requested worker", "failed to commit database transaction");
+    m_state->feedUnreadDeltas.clear();
 
-    qresult = (q.exec(QStringLiteral(SEL_TOTAL_UNREAD)) && q.next());
+    q = statements.exec(QStringLiteral(SEL_TOTAL_UNREAD), &qresult);
+    qresult = (qresult && q->next());
     Q_ASSERT_X(qresult, "items requested worker", "failed to select total unread item count from database");
-    Q_EMIT gotTotalUnread(q.value(0).toInt());
+    const int unreadCount = q->value(0).toInt();
+    q->finish();
+    Q_EMIT gotTotalUnread(unreadCount);
 
-    qresult = (q.exec(QStringLiteral(SEL_TOTAL_STARRED)) && q.next());
+    q = statements.exec(QStringLiteral(SEL_TOTAL_STARRED), &qresult);
+    qresult = (qresult && q->next());
     Q_ASSERT_X(qresult, "items requested worker", "failed to select total starred item count from database");
-    Q_EMIT gotStarred(q.value(0).toInt());
+    const int starredCount = q->value(0).toInt();
+    q->finish();
+    Q_EMIT gotStarred(starredCount);
+
+    if (emitChanges) {
+        Q_EMIT articlesChanged(changes);
+    }
 
-    Q_EMIT requestedItems(updatedItemIds, newItemIds, removedItemIds);
+    Q_EMIT requestedItems(m_state->updatedItemIds, m_state->newItemIds, removedItemIds);
 
-    if (publishArticles && !articlesToPublish.empty()) {
-        for (auto i = articlesToPublish.constBegin(); i != articlesToPublish.constEnd(); ++i) {
+    if (publishArticles && !m_state->articlesToPublish.empty()) {
+        for (auto i = m_state->articlesToPublish.constBegin(); i != m_state->articlesToPublish.constEnd(); ++i) {
             const QJsonObject o = *i;
             if (!removedItemIds.contains(o.value(QStringLiteral("id")).toVariant().value<qint64>())) {
                 m_notificator->publishArticle(o, feedsIdTitleMap.value(o.value(QStringLiteral("feedId")).toVariant().value<qint64>()));
@@ -2317,8 +3126,8 @@ void ItemsRequestedWorker::run()
         }
     }
 
-    if (m_notificator && (newUnreadItems > 0)) {
-        m_notificator->notify(AbstractNotificator::ItemsRequested, QtInfoMsg, newUnreadItems);
+    if (m_notificator && (m_state->newUnreadItems > 0)) {
+        m_notificator->notify(AbstractNotificator::ItemsRequested, QtInfoMsg, m_state->newUnreadItems);
     }
 }
 
@@ -2327,24 +3136,74 @@ void ItemsRequestedWorker::run()
 
 void SQLiteStorage::itemsRequested(const QJsonDocument &json)
 {
+    if (!ready()) {
+        //% "SQLite database not ready. Can not process requested data."
+        setError(new Error(Error::StorageError, Error::Warning, qtTrId("libfuoten-err-sqlite-db-not-ready"), QString(), this));
+        return;
+    }
+
     Q_D(SQLiteStorage);
 
+    // an empty reply is queued as well, its completion has to be reported after the running requests
+    d->itemBatches.enqueue(qMakePair(json.object().value(QStringLiteral("items")).toArray(), true));
+    processItemBatches();
+}
+
+
+void SQLiteStorage::itemsBatchRequested(const QJsonArray &items, bool lastBatch)
+{
     if (!ready()) {
         //% "SQLite database not ready. Can not process requested data."
         setError(new Error(Error::StorageError, Error::Warning, qtTrId("libfuoten-err-sqlite-db-not-ready"), QString(), this));
         return;
     }
 
-    if (json.isEmpty() || json.isNull()) {
+    Q_D(SQLiteStorage);
+
+    d->itemBatches.enqueue(qMakePair(items, lastBatch));
+    processItemBatches();
+}
+
+
+void SQLiteStorage::processItemBatches()
+{
+    Q_D(SQLiteStorage);
+
+    // batches have to be written one after another, they share the same connection and state
+    if (d->itemsWorkerRunning || d->itemBatches.isEmpty()) {
+        return;
+    }
+
+    const QPair<QJsonArray, bool> batch = d->itemBatches.dequeue();
+
+    // nothing to write for a request without items
+    if (batch.second && batch.first.isEmpty() && !d->itemsState) {
+        qCDebug(FUOTEN_STORAGE, "%s", "Nothing to do. No Items.");
         Q_EMIT requestedItems(IdList(), IdList(), IdList());
+        processItemBatches();
         return;
     }
 
-    ItemsRequestedWorker *worker = new ItemsRequestedWorker(d->db.databaseName(), json, configuration(), notificator(), this);
+    if (!d->itemsState) {
+        d->itemsState = QSharedPointer<ItemsRequestedState>::create();
+    }
+
+    d->itemsWorkerRunning = true;
+
+    ItemsRequestedWorker *worker = new ItemsRequestedWorker(d->dbpath, batch.first, batch.second, d->itemsState, d->fullTextSearch, configuration(), notificator(), this);
+    connect(worker, &ItemsRequestedWorker::articlesChanged, this, &SQLiteStorage::articlesChanged);
     connect(worker, &ItemsRequestedWorker::requestedItems, this, &SQLiteStorage::requestedItems);
     connect(worker, &ItemsRequestedWorker::gotStarred, this, &SQLiteStorage::setStarred);
     connect(worker, &ItemsRequestedWorker::gotTotalUnread, this, &SQLiteStorage::setTotalUnread);
     connect(worker, &ItemsRequestedWorker::failed, this, [=] (Error *e) {setError(e);});
+    connect(worker, &QThread::finished, this, [this, batch] () {
+        Q_D(SQLiteStorage);
+        d->itemsWorkerRunning = false;
+        if (batch.second) {
+            d->itemsState.reset();
+        }
+        processItemBatches();
+    });
     connect(worker, &QThread::finished, worker, &QObject::deleteLater);
     worker->start();
 }
@@ -2353,7 +3212,7 @@ void SQLiteStorage::itemsRequested(const QJsonDocument &json)
 
 void SQLiteStorage::itemsMarked(const IdList &itemIds, bool unread)
 {
-    qDebug("%s", "Start to mark items as read in the local storage.");
+    qCDebug(FUOTEN_STORAGE, "%s", "Start to mark items as read in the local storage.");
 
     if (!ready()) {
         //% "SQLite database not ready. Can not process requested data."
@@ -2363,79 +3222,43 @@ void SQLiteStorage::itemsMarked(const IdList &itemIds, bool unread)
     }
 
     if (itemIds.isEmpty()) {
-        qWarning("List of marked articles is empty.");
+        qCWarning(FUOTEN_STORAGE, "List of marked articles is empty.");
         return;
     }
 
     Q_D(SQLiteStorage);
 
-    const QString idListString = d->intListToString(itemIds);
+    QSqlQuery *q = nullptr;
 
-    QSqlQuery q(d->db);
-    q.setForwardOnly(true);
-    bool qresult = q.prepare(QStringLiteral("UPDATE items SET unread = ?, lastModified = ? WHERE id IN (%1)").arg(idListString));
+    bool qresult = d->db.transaction();
+    Q_ASSERT_X(qresult, "items marked", "failed to start database transaction");
+
+    qresult = d->fillBulkIds(itemIds);
+    Q_ASSERT_X(qresult, "items marked", "failed to fill temporary id table");
+
+    const int unreadDelta = d->applyBulkUnreadDeltas(unread);
+    qCDebug(FUOTEN_STORAGE, "Updated affected feeds and folders before items in the database will be marked as %s.", unread ? "unread" : "read");
+
+    q = d->statements.query(QStringLiteral("UPDATE items SET unread = ?, lastModified = ? WHERE id IN (SELECT id FROM temp.bulk_ids)"), &qresult);
     Q_ASSERT_X(qresult, "items marked", "failed to prepare database query");
 
-    q.addBindValue(unread);
+    q->addBindValue(unread);
 #if (QT_VERSION >= QT_VERSION_CHECK(5, 8, 0))
-    q.addBindValue(QDateTime::currentDateTimeUtc().toSecsSinceEpoch());
+    q->addBindValue(QDateTime::currentDateTimeUtc().toSecsSinceEpoch());
 #else
-    q.addBindValue(QDateTime::currentDateTimeUtc().toTime_t());
+    q->addBindValue(QDateTime::currentDateTimeUtc().toTime_t());
 #endif
 
-    qresult = q.exec();
+    qresult = q->exec();
     Q_ASSERT_X(qresult, "items marked", "failed to execute databae query");
 
-    qDebug("Updated items in the database that have been marked as %s", unread ? "unread" : "read");
-
-    qresult = q.exec(QStringLiteral("SELECT DISTINCT feedId FROM items WHERE id IN (%1)").arg(idListString));
-    Q_ASSERT(qresult);
-    IdList feedIds;
-    while (q.next()) {
-        feedIds.push_back(q.value(0).value<qint64>());
-    }
-    qDebug("Selected affected feeds after items in the database have been marked as %s.", unread ? "unread" : "read");
-    if (!feedIds.empty()) {
-        qresult = d->db.transaction();
-        Q_ASSERT(qresult);
-        for (const qint64 id : feedIds) {
-            qresult = q.prepare(QStringLiteral("UPDATE feeds SET unreadCount = (SELECT COUNT(id) FROM items WHERE unread = 1 AND feedId = :feedId) WHERE id = :feedId"));
-            Q_ASSERT(qresult);
-            q.bindValue(QStringLiteral(":feedId"), id);
-            qresult = q.exec();
-            Q_ASSERT(qresult);
-        }
-        qresult = d->db.commit();
-        Q_ASSERT(qresult);
-    }
-    qDebug("Updated affected feeds after items in the database have been marked as %s.", unread ? "unread" : "read");
+    qresult = d->db.commit();
+    Q_ASSERT_X(qresult, "items marked", "failed to commit database transaction");
 
-    qresult = q.exec(QStringLiteral("SELECT DISTINCT folderId FROM feeds WHERE id IN (%1)").arg(d->intListToString(feedIds)));
-    Q_ASSERT(qresult);
-    IdList folderIds;
-    while (q.next()) {
-        folderIds.push_back(q.value(0).value<qint64>());
-    }
-    qDebug("Selected affected folders after items in the database have been marked as %s.", unread ? "unread" : "read");
-    if (!folderIds.empty()) {
-        qresult = d->db.transaction();
-        Q_ASSERT(qresult);
-        for (const qint64 id : folderIds) {
-            qresult = q.prepare(QStringLiteral("UPDATE folders SET unreadCount = (SELECT SUM(unreadCount) FROM feeds WHERE folderId = :folderId) WHERE id = :folderId"));
-            Q_ASSERT(qresult);
-            q.bindValue(QStringLiteral(":folderId"), id);
-            qresult = q.exec();
-            Q_ASSERT(qresult);
-        }
-        qresult = d->db.commit();
-        Q_ASSERT(qresult);
-    }
-    qDebug("Updated affected folders after items in the database have been marked as %s.", unread ? "unread" : "read");
+    qCDebug(FUOTEN_STORAGE, "Updated items in the database that have been marked as %s", unread ? "unread" : "read");
 
-    qresult = (q.exec(QStringLiteral(SEL_TOTAL_UNREAD)) && q.next());
-    Q_ASSERT(qresult);
-    setTotalUnread(q.value(0).value<quint16>());
-    qDebug("Updated total count of unread items.");
+    setTotalUnread(totalUnread() + unreadDelta);
+    qCDebug(FUOTEN_STORAGE, "Updated total count of unread items.");
 
     Q_EMIT markedItems(itemIds, unread);
 }
@@ -2451,43 +3274,49 @@ void SQLiteStorage::itemsStarred(const QList<QPair<qint64, QString> > &articles,
     }
 
     if (articles.isEmpty()) {
-        qWarning("No articles in the list. Can not update local storage.");
+        qCWarning(FUOTEN_STORAGE, "No articles in the list. Can not update local storage.");
+        return;
     }
 
     Q_D(SQLiteStorage);
 
-    QSqlQuery q(d->db);
-    q.setForwardOnly(true);
+    QSqlQuery *q = nullptr;
 
     bool qresult = d->db.transaction();
     Q_ASSERT_X(qresult, "items starred", "failed to start database transaction");
 
-    for (const QPair<qint64,QString> &p : articles) {
+    qresult = d->fillBulkGuidHashes(articles);
+    Q_ASSERT_X(qresult, "items starred", "failed to fill temporary guid hash table");
 
-        qresult = q.prepare(QStringLiteral("UPDATE items SET starred = ?, lastModified = ? WHERE feedId = ? and guidHash = ?"));
-        Q_ASSERT_X(qresult, "items starred", "failed to prepare updating item in database");
+    // only count items whose state really changes, some of them might already have been changed locally
+    q = d->statements.query(QStringLiteral("SELECT COUNT(it.id) FROM temp.bulk_guids b JOIN items it ON it.feedId = b.feedId AND it.guidHash = b.guidHash WHERE it.starred = ?"), &qresult);
+    Q_ASSERT_X(qresult, "items starred", "failed to prepare counting changed items");
+    q->addBindValue(!star);
+    qresult = (q->exec() && q->next());
+    Q_ASSERT_X(qresult, "items starred", "failed to execute counting changed items");
+    const int changed = q->value(0).toInt();
+    q->finish();
 
-        q.addBindValue(star);
+    q = d->statements.query(QStringLiteral("UPDATE items SET starred = ?, lastModified = ? WHERE id IN (SELECT it.id FROM temp.bulk_guids b JOIN items it ON it.feedId = b.feedId AND it.guidHash = b.guidHash)"), &qresult);
+    Q_ASSERT_X(qresult, "items starred", "failed to prepare updating items in database");
+
+    q->addBindValue(star);
 #if (QT_VERSION >= QT_VERSION_CHECK(5, 8, 0))
-        q.addBindValue(QDateTime::currentDateTimeUtc().toSecsSinceEpoch());
+    q->addBindValue(QDateTime::currentDateTimeUtc().toSecsSinceEpoch());
 #else
-        q.addBindValue(QDateTime::currentDateTimeUtc().toTime_t());
+    q->addBindValue(QDateTime::currentDateTimeUtc().toTime_t());
 #endif
-        q.addBindValue(p.first);
-        q.addBindValue(p.second);
-
-        qresult = q.exec();
-        Q_ASSERT_X(qresult, "items starred", "failed to execute updating item in database");
 
-    }
+    qresult = q->exec();
+    Q_ASSERT_X(qresult, "items starred", "failed to execute updating items in database");
 
     qresult = d->db.commit();
     Q_ASSERT_X(qresult, "items starred", "failed to commit database transaction");
 
     if (star) {
-        setStarred(starred() + articles.count());
+        setStarred(starred() + changed);
     } else {
-        setStarred(starred() - articles.count());
+        setStarred(starred() - changed);
     }
 
     Q_EMIT starredItems(articles, star);
@@ -2505,51 +3334,60 @@ void SQLiteStorage::itemMarked(qint64 itemId, bool unread)
 
     Q_D(SQLiteStorage);
 
-    QSqlQuery q(d->db);
+    QSqlQuery *q = nullptr;
+
+    bool qresult = d->db.transaction();
+    Q_ASSERT_X(qresult, "item marked", "failed to start database transaction");
 
-    bool qresult = q.prepare(QStringLiteral("UPDATE items SET unread = ?, lastModified = ? WHERE id = ?"));
+    // the item might already have been changed locally, only update the counters if its state really changes
+    q = d->statements.query(QStringLiteral("UPDATE items SET unread = ?, lastModified = ? WHERE id = ? AND unread != ?"), &qresult);
     Q_ASSERT_X(qresult, "item marked", "failed to prepare database transaction");
 
-    q.addBindValue(unread);
+    q->addBindValue(unread);
 #if (QT_VERSION >= QT_VERSION_CHECK(5, 8, 0))
-    q.addBindValue(QDateTime::currentDateTimeUtc().toSecsSinceEpoch());
+    q->addBindValue(QDateTime::currentDateTimeUtc().toSecsSinceEpoch());
 #else
-    q.addBindValue(QDateTime::currentDateTimeUtc().toTime_t());
+    q->addBindValue(QDateTime::currentDateTimeUtc().toTime_t());
 #endif
-    q.addBindValue(itemId);
+    q->addBindValue(itemId);
+    q->addBindValue(unread);
 
-    qresult = q.exec();
+    qresult = q->exec();
     Q_ASSERT_X(qresult, "item marked", "failed to execute database transaction");
 
-    qresult = q.prepare(QStringLiteral("SELECT it.feedId, fe.folderId FROM items it JOIN feeds fe ON fe.id = it.feedId WHERE it.id = ?"));
-    Q_ASSERT(qresult);
-    q.addBindValue(itemId);
-    qresult = (q.exec() && q.next());
-    Q_ASSERT(qresult);
+    const int changed = q->numRowsAffected();
 
-    const qint64 feedId = q.value(0).value<qint64>();
-    const qint64 folderId = q.value(1).value<qint64>();
+    if (changed > 0) {
+        q = d->statements.query(QStringLiteral("SELECT it.feedId, fe.folderId FROM items it JOIN feeds fe ON fe.id = it.feedId WHERE it.id = ?"), &qresult);
+        Q_ASSERT(qresult);
+        q->addBindValue(itemId);
+        qresult = (q->exec() && q->next());
+        Q_ASSERT(qresult);
 
-    qresult = q.prepare(QStringLiteral("UPDATE feeds SET unreadCount = unreadCount + ? WHERE id = ?"));
-    Q_ASSERT(qresult);
-    q.addBindValue(unread ? 1 : -1);
-    q.addBindValue(feedId);
-    qresult = q.exec();
-    Q_ASSERT(qresult);
+        const qint64 feedId = q->value(0).value<qint64>();
+        const qint64 folderId = q->value(1).value<qint64>();
+        q->finish();
 
-    qresult = q.prepare(QStringLiteral("UPDATE folders SET unreadCount = unreadCount + ? WHERE id = ?"));
-    Q_ASSERT(qresult);
-    q.addBindValue(unread ? 1 : -1);
-    q.addBindValue(folderId);
-    qresult = q.exec();
-    Q_ASSERT(qresult);
+        q = d->statements.query(QStringLiteral("UPDATE feeds SET unreadCount = unreadCount + ? WHERE id = ?"), &qresult);
+        Q_ASSERT(qresult);
+        q->addBindValue(unread ? changed : -changed);
+        q->addBindValue(feedId);
+        qresult = q->exec();
+        Q_ASSERT(qresult);
 
-    if (unread) {
-        setTotalUnread(totalUnread()+1);
-    } else {
-        setTotalUnread(totalUnread()-1);
+        q = d->statements.query(QStringLiteral("UPDATE folders SET unreadCount = unreadCount + ? WHERE id = ?"), &qresult);
+        Q_ASSERT(qresult);
+        q->addBindValue(unread ? changed : -changed);
+        q->addBindValue(folderId);
+        qresult = q->exec();
+        Q_ASSERT(qresult);
     }
 
+    qresult = d->db.commit();
+    Q_ASSERT_X(qresult, "item marked", "failed to commit database transaction");
+
+    setTotalUnread(totalUnread() + (unread ? changed : -changed));
+
     Q_EMIT markedItem(itemId, unread);
 }
 
@@ -2566,27 +3404,32 @@ void SQLiteStorage::itemStarred(qint64 feedId, const QString &guidHash, bool sta
 
     Q_D(SQLiteStorage);
 
-    QSqlQuery q(d->db);
+    QSqlQuery *q = nullptr;
 
-    bool qresult = q.prepare(QStringLiteral("UPDATE items SET starred = ?, lastModified = ? WHERE feedId = ? and guidHash = ?"));
+    bool qresult = false;
+    // the item might already have been changed locally, only count it if its state really changes
+    q = d->statements.query(QStringLiteral("UPDATE items SET starred = ?, lastModified = ? WHERE feedId = ? AND guidHash = ? AND starred != ?"), &qresult);
     Q_ASSERT_X(qresult, "item starred", "failed to prepare database transaction");
 
-    q.addBindValue(star);
+    q->addBindValue(star);
 #if (QT_VERSION >= QT_VERSION_CHECK(5, 8, 0))
-    q.addBindValue(QDateTime::currentDateTimeUtc().toSecsSinceEpoch());
+    q->addBindValue(QDateTime::currentDateTimeUtc().toSecsSinceEpoch());
 #else
-    q.addBindValue(QDateTime::currentDateTimeUtc().toTime_t());
+    q->addBindValue(QDateTime::currentDateTimeUtc().toTime_t());
 #endif
-    q.addBindValue(feedId);
-    q.addBindValue(guidHash);
+    q->addBindValue(feedId);
+    q->addBindValue(guidHash);
+    q->addBindValue(star);
 
-    qresult = q.exec();
+    qresult = q->exec();
     Q_ASSERT_X(qresult, "item starred", "failed to execute database transaction");
 
+    const int changed = q->numRowsAffected();
+
     if (star) {
-        setStarred(starred() + 1);
+        setStarred(starred() + changed);
     } else {
-        setStarred(starred() - 1);
+        setStarred(starred() - changed);
     }
 
     Q_EMIT starredItem(feedId, guidHash, star);
@@ -2604,20 +3447,21 @@ void SQLiteStorage::allItemsMarkedRead(qint64 newestItemId)
 
     Q_D(SQLiteStorage);
 
-    QSqlQuery q(d->db);
+    QSqlQuery *q = nullptr;
 
-    bool qresult = q.prepare(QStringLiteral("UPDATE items SET unread = 0, lastModified = ? WHERE id <= ?"));
+    bool qresult = false;
+    q = d->statements.query(QStringLiteral("UPDATE items SET unread = 0, lastModified = ? WHERE id <= ?"), &qresult);
     Q_ASSERT_X(qresult, "all items marked read", "failed to prepare database transaciton");
 
-    q.addBindValue(newestItemId);
+    q->addBindValue(newestItemId);
 
-    qresult = q.exec();
+    qresult = q->exec();
     Q_ASSERT_X(qresult, "all items marked read", "failed to execute database transaction");
 
-    qresult = q.exec(QStringLiteral("UPDATE feeds SET unreadCount = 0"));
+    q = d->statements.exec(QStringLiteral("UPDATE feeds SET unreadCount = 0"), &qresult);
     Q_ASSERT(qresult);
 
-    qresult = q.exec(QStringLiteral("UPDATE folders SET unreadCount = 0"));
+    q = d->statements.exec(QStringLiteral("UPDATE folders SET unreadCount = 0"), &qresult);
     Q_ASSERT(qresult);
 
     setTotalUnread(0);
@@ -2640,18 +3484,20 @@ QString SQLiteStorage::getArticleBody(qint64 id)
 
     Q_D(SQLiteStorage);
 
-    QSqlQuery q(d->db);
+    QSqlQuery *q = nullptr;
 
-    bool qresult = q.prepare(QStringLiteral("SELECT body FROM items WHERE id = ?"));
+    bool qresult = false;
+    q = d->statements.query(QStringLiteral("SELECT body FROM item_bodies WHERE id = ?"), &qresult);
     Q_ASSERT_X(qresult, "get article body", "failed to prepare database transaction");
 
-    q.addBindValue(id);
+    q->addBindValue(id);
 
-    qresult = q.exec();
+    qresult = q->exec();
     Q_ASSERT_X(qresult, "get article body", "failed to execute database query");
 
-    if (Q_LIKELY(q.next())) {
-        body = q.value(0).toString();
+    if (Q_LIKELY(q->next())) {
+        body = SQLiteStoragePrivate::uncompressBody(q->value(0).toByteArray());
+        q->finish();
     }
 
     return body;
@@ -2713,79 +3559,100 @@ bool SQLiteStorage::enqueueItem(FuotenEnums::QueueAction action, Article *articl
         qs.append(QLatin1String("starred = 0, "));
         break;
     default:
-        qWarning("Invalid queue action.");
+        qCWarning(FUOTEN_STORAGE, "Invalid queue action.");
         return false;
     }
 
     qs.append(QLatin1String("queue = ? "));
 
-    if ((action == FuotenEnums::MarkAsUnread) || (action == FuotenEnums::MarkAsRead)) {
-        qs.append(QLatin1String("WHERE id = ?"));
-    } else {
-        qs.append(QLatin1String("WHERE feedId = ? AND guidHash = ?"));
+    // only items whose state really changes will be enqueued and counted
+    switch (action) {
+    case FuotenEnums::MarkAsRead:
+        qs.append(QLatin1String("WHERE id = ? AND unread = 1"));
+        break;
+    case FuotenEnums::MarkAsUnread:
+        qs.append(QLatin1String("WHERE id = ? AND unread = 0"));
+        break;
+    case FuotenEnums::Star:
+        qs.append(QLatin1String("WHERE feedId = ? AND guidHash = ? AND starred = 0"));
+        break;
+    default:
+        qs.append(QLatin1String("WHERE feedId = ? AND guidHash = ? AND starred = 1"));
+        break;
     }
 
     Q_D(SQLiteStorage);
 
-    QSqlQuery q(d->db);
+    QSqlQuery *q = nullptr;
+
+    bool qresult = d->db.transaction();
+    Q_ASSERT_X(qresult, "enqueue item", "failed to start database transaction");
 
-    bool qresult = q.prepare(qs);
+    q = d->statements.prepareUncached(qs, &qresult);
     Q_ASSERT_X(qresult, "enqueue item", "failed to prepare datbase query");
 
 #if (QT_VERSION >= QT_VERSION_CHECK(5, 8, 0))
-    q.addBindValue(QDateTime::currentDateTimeUtc().toSecsSinceEpoch() - 10);
+    q->addBindValue(QDateTime::currentDateTimeUtc().toSecsSinceEpoch() - 10);
 #else
-    q.addBindValue(QDateTime::currentDateTimeUtc().toTime_t() - 10);
+    q->addBindValue(QDateTime::currentDateTimeUtc().toTime_t() - 10);
 #endif
-    q.addBindValue(static_cast<int>(aq));
+    q->addBindValue(static_cast<int>(aq));
 
     if ((action == FuotenEnums::MarkAsUnread) || (action == FuotenEnums::MarkAsRead)) {
-        q.addBindValue(article->id());
+        q->addBindValue(article->id());
     } else {
-        q.addBindValue(article->feedId());
-        q.addBindValue(article->guidHash());
+        q->addBindValue(article->feedId());
+        q->addBindValue(article->guidHash());
     }
 
-    qresult = q.exec();
+    qresult = q->exec();
     Q_ASSERT_X(qresult, "enqueue item", "failed to execute database query");
 
-    article->setQueue(aq);
+    // the article object might be outdated and the stored item might already have the requested state
+    const int changed = q->numRowsAffected();
 
-    if ((action == FuotenEnums::MarkAsUnread) || (action == FuotenEnums::MarkAsRead)) {
-        qresult = q.prepare(QStringLiteral("UPDATE feeds SET unreadCount = unreadCount + ? WHERE id = ?"));
+    if ((changed > 0) && ((action == FuotenEnums::MarkAsUnread) || (action == FuotenEnums::MarkAsRead))) {
+        q = d->statements.query(QStringLiteral("UPDATE feeds SET unreadCount = unreadCount + ? WHERE id = ?"), &qresult);
         Q_ASSERT(qresult);
-        q.addBindValue((action == FuotenEnums::MarkAsUnread) ? 1 : -1);
-        q.addBindValue(article->feedId());
-        qresult = q.exec();
+        q->addBindValue((action == FuotenEnums::MarkAsUnread) ? changed : -changed);
+        q->addBindValue(article->feedId());
+        qresult = q->exec();
         Q_ASSERT(qresult);
 
-        qresult = q.prepare(QStringLiteral("UPDATE folders SET unreadCount = unreadCount + ? WHERE id = ?"));
+        q = d->statements.query(QStringLiteral("UPDATE folders SET unreadCount = unreadCount + ? WHERE id = ?"), &qresult);
         Q_ASSERT(qresult);
-        q.addBindValue((action == FuotenEnums::MarkAsUnread) ? 1 : -1);
-        q.addBindValue(article->folderId());
-        qresult = q.exec();
+        q->addBindValue((action == FuotenEnums::MarkAsUnread) ? changed : -changed);
+        q->addBindValue(article->folderId());
+        qresult = q->exec();
         Q_ASSERT(qresult);
     }
 
+    qresult = d->db.commit();
+    Q_ASSERT_X(qresult, "enqueue item", "failed to commit database transaction");
+
+    if (changed > 0) {
+        article->setQueue(aq);
+    }
+
     switch (action) {
     case FuotenEnums::MarkAsRead:
         Q_EMIT markedItem(article->id(), false);
-        setTotalUnread(totalUnread()-1);
+        setTotalUnread(totalUnread() - changed);
         break;
     case FuotenEnums::MarkAsUnread:
         Q_EMIT markedItem(article->id(), true);
-        setTotalUnread(totalUnread()+1);
+        setTotalUnread(totalUnread() + changed);
         break;
     case FuotenEnums::Star:
         Q_EMIT starredItem(article->feedId(), article->guidHash(), true);
-        setStarred(starred()+1);
+        setStarred(starred() + changed);
         break;
     case FuotenEnums::Unstar:
         Q_EMIT starredItem(article->feedId(), article->guidHash(), false);
-        setStarred(starred()-1);
+        setStarred(starred() - changed);
         break;
     default:
-        qWarning("Invalid queue action.");
+        qCWarning(FUOTEN_STORAGE, "Invalid queue action.");
         return false;
     }
 
@@ -2794,15 +3661,158 @@ bool SQLiteStorage::enqueueItem(FuotenEnums::QueueAction action, Article *articl
 
 
 
-EnqueueMarkReadWorker::EnqueueMarkReadWorker(const QString &dbpath, qint64 id, FuotenEnums::Type idType, qint64 newestItemId, QObject *parent) :
-    QThread(parent), m_id(id), m_newestItemId(newestItemId), m_idType(idType)
+/*!
+ * \internal
+ * Performs the queue \a action on the items identified by \a itemIds inside an already running
+ * transaction. The IDs of items whose unread state changed are appended to \a changedIds, the feed ID
+ * and guid hash of items whose starred state changed are appended to \a changedArticles and the
+ * change of the total unread count is added to \a unreadDelta. Returns \c false on an invalid \a action.
+ */
+bool SQLiteStoragePrivate::enqueueBulk(FuotenEnums::QueueAction action, const IdList &itemIds, IdList &changedIds, QList<QPair<qint64, QString>> &changedArticles, int &unreadDelta)
 {
-    if (!QSqlDatabase::connectionNames().contains(QStringLiteral("fuotendb"))) {
-        m_db = QSqlDatabase::addDatabase(QStringLiteral("QSQLITE"), QStringLiteral("fuotendb"));
-        m_db.setDatabaseName(dbpath);
-    } else {
-        m_db = QSqlDatabase::database(QStringLiteral("fuotendb"));
+    FuotenEnums::QueueAction opposite = FuotenEnums::MarkAsUnread;
+    bool newValue = false;
+
+    switch (action) {
+    case FuotenEnums::MarkAsRead:
+        opposite = FuotenEnums::MarkAsUnread;
+        break;
+    case FuotenEnums::MarkAsUnread:
+        opposite = FuotenEnums::MarkAsRead;
+        newValue = true;
+        break;
+    case FuotenEnums::Star:
+        opposite = FuotenEnums::Unstar;
+        newValue = true;
+        break;
+    case FuotenEnums::Unstar:
+        opposite = FuotenEnums::Star;
+        break;
+    default:
+        qCWarning(FUOTEN_STORAGE, "Invalid queue action.");
+        return false;
+    }
+
+    const bool isMarkAction = ((action == FuotenEnums::MarkAsRead) || (action == FuotenEnums::MarkAsUnread));
+    const QString column = isMarkAction ? QStringLiteral("unread") : QStringLiteral("starred");
+
+    QSqlQuery *q = nullptr;
+
+    bool qresult = fillBulkIds(itemIds);
+    Q_ASSERT_X(qresult, "enqueue items", "failed to fill temporary id table");
+
+    // only items whose state really changes will be enqueued
+    q = statements.query(QStringLiteral("SELECT it.id, it.feedId, it.guidHash FROM temp.bulk_ids b JOIN items it ON it.id = b.id WHERE it.%1 != ?").arg(column), &qresult);
+    Q_ASSERT_X(qresult, "enqueue items", "failed to prepare selecting changed items");
+    q->addBindValue(newValue);
+    qresult = q->exec();
+    Q_ASSERT_X(qresult, "enqueue items", "failed to execute selecting changed items");
+
+    bool changed = false;
+    while (q->next()) {
+        changed = true;
+        if (isMarkAction) {
+            changedIds.append(q->value(0).value<qint64>());
+        } else {
+            changedArticles.append(qMakePair(q->value(1).value<qint64>(), q->value(2).toString()));
+        }
+    }
+
+    if (!changed) {
+        return true;
+    }
+
+    if (isMarkAction) {
+        unreadDelta += applyBulkUnreadDeltas(newValue);
+    }
+
+    q = statements.query(QStringLiteral("UPDATE items SET %1 = ?, lastModified = ?, queue = CASE WHEN (queue & %2) THEN (queue & ~%2) ELSE (queue | %3) END WHERE id IN (SELECT id FROM temp.bulk_ids) AND %1 != ?").arg(column).arg(static_cast<int>(opposite)).arg(static_cast<int>(action)), &qresult);
+    Q_ASSERT_X(qresult, "enqueue items", "failed to prepare database query");
+
+    q->addBindValue(newValue);
+#if (QT_VERSION >= QT_VERSION_CHECK(5, 8, 0))
+    q->addBindValue(QDateTime::currentDateTimeUtc().toSecsSinceEpoch() - 10);
+#else
+    q->addBindValue(QDateTime::currentDateTimeUtc().toTime_t() - 10);
+#endif
+    q->addBindValue(newValue);
+
+    qresult = q->exec();
+    Q_ASSERT_X(qresult, "enqueue items", "failed to execute database query");
+
+    return true;
+}
+
+
+bool SQLiteStorage::enqueueItems(FuotenEnums::QueueAction action, const IdList &itemIds)
+{
+    if (itemIds.isEmpty()) {
+        qCWarning(FUOTEN_STORAGE, "List of articles to enqueue is empty.");
+        return false;
+    }
+
+    QMap<FuotenEnums::QueueAction, IdList> actions;
+    actions.insert(action, itemIds);
+
+    return enqueueItems(actions);
+}
+
+
+bool SQLiteStorage::enqueueItems(const QMap<FuotenEnums::QueueAction, IdList> &actions)
+{
+    if (!ready()) {
+        //% "SQLite database not ready. Can not process requested data."
+        setError(new Error(Error::StorageError, Error::Warning, qtTrId("libfuoten-err-sqlite-db-not-ready"), QString(), this));
+        notify(error());
+        return false;
+    }
+
+    Q_D(SQLiteStorage);
+
+    bool qresult = d->db.transaction();
+    Q_ASSERT_X(qresult, "enqueue items", "failed to start database transaction");
+
+    QMap<FuotenEnums::QueueAction, IdList> changedIds;
+    QMap<FuotenEnums::QueueAction, QList<QPair<qint64, QString>>> changedArticles;
+    int unreadDelta = 0;
+
+    for (auto it = actions.cbegin(), end = actions.cend(); it != end; ++it) {
+        if (it.value().isEmpty()) {
+            continue;
+        }
+        if (!d->enqueueBulk(it.key(), it.value(), changedIds[it.key()], changedArticles[it.key()], unreadDelta)) {
+            d->db.rollback();
+            return false;
+        }
+    }
+
+    qresult = d->db.commit();
+    Q_ASSERT_X(qresult, "enqueue items", "failed to commit database transaction");
+
+    setTotalUnread(totalUnread() + unreadDelta);
+
+    for (auto it = changedIds.cbegin(), end = changedIds.cend(); it != end; ++it) {
+        if (!it.value().isEmpty()) {
+            Q_EMIT markedItems(it.value(), it.key() == FuotenEnums::MarkAsUnread);
+        }
     }
+
+    for (auto it = changedArticles.cbegin(), end = changedArticles.cend(); it != end; ++it) {
+        if (!it.value().isEmpty()) {
+            const bool star = (it.key() == FuotenEnums::Star);
+            setStarred(starred() + (star ? it.value().size() : -it.value().size()));
+            Q_EMIT starredItems(it.value(), star);
+        }
+    }
+
+    return true;
+}
+
+
+EnqueueMarkReadWorker::EnqueueMarkReadWorker(const QString &dbpath, qint64 id, FuotenEnums::Type idType, qint64 newestItemId, QObject *parent) :
+    QThread(parent), m_id(id), m_newestItemId(newestItemId), m_dbpath(dbpath), m_idType(idType)
+{
+
 }
 
 
@@ -2814,23 +3824,23 @@ EnqueueMarkReadWorker::~EnqueueMarkReadWorker()
 
 void EnqueueMarkReadWorker::run()
 {
-    QSqlQuery q(m_db);
-    q.setForwardOnly(true);
+    QSqlDatabase db = SQLiteConnectionPool::database(m_dbpath);
+    SQLiteStatementCache &statements = *SQLiteConnectionPool::statements(m_dbpath);
+    QSqlQuery *q = nullptr;
 
-    bool qresult = q.exec(QStringLiteral("PRAGMA foreign_keys = ON"));
-    Q_ASSERT_X(qresult, "enqueue mark read worker", "failed to enable foreign keys support");
+    bool qresult = false;
 
     QString qs; // query string
 
     switch(m_idType) {
     case FuotenEnums::Feed:
-        qs = QStringLiteral("SELECT id, queue FROM items WHERE unread = 1 AND id <= ? AND feedId = ?");
+        qs = QStringLiteral("SELECT id, queue, feedId FROM items WHERE unread = 1 AND id <= ? AND feedId = ?");
         break;
     case FuotenEnums::Folder:
-        qs = QStringLiteral("SELECT id, queue FROM items WHERE unread = 1 AND id <= ? AND feedId IN (SELECT id FROM feeds WHERE folderId = ?)");
+        qs = QStringLiteral("SELECT id, queue, feedId FROM items WHERE unread = 1 AND id <= ? AND feedId IN (SELECT id FROM feeds WHERE folderId = ?)");
         break;
     case FuotenEnums::All:
-        qs = QStringLiteral("SELECT id, queue FROM items WHERE unread = 1");
+        qs = QStringLiteral("SELECT id, queue, feedId FROM items WHERE unread = 1");
         break;
     default:
         //% "Invalid ID type."
@@ -2838,105 +3848,70 @@ void EnqueueMarkReadWorker::run()
         return;
     }
 
-    qresult = q.prepare(qs);
+    qresult = db.transaction();
+    Q_ASSERT_X(qresult, "equeue mark read worker", "failed to start database transaction");
+
+    q = statements.prepareUncached(qs, &qresult);
     Q_ASSERT_X(qresult, "enqueue mark read worker", "failed to prepare database query");
 
     if (m_idType != FuotenEnums::All) {
-        q.addBindValue(m_newestItemId);
-        q.addBindValue(m_id);
+        q->addBindValue(m_newestItemId);
+        q->addBindValue(m_id);
     }
 
-    qresult = q.exec();
+    qresult = q->exec();
     Q_ASSERT_X(qresult, "enqueue mark read worker", "failed to execute database query");
 
-    QHash<qint64,FuotenEnums::QueueActions> idsAndQueue;
+    QHash<qint64,QPair<qint64,FuotenEnums::QueueActions>> idsAndQueue;
 
-    while (q.next()) {
-        idsAndQueue.insert(q.value(0).toLongLong(), FuotenEnums::QueueActions(q.value(1).toInt()));
+    while (q->next()) {
+        idsAndQueue.insert(q->value(0).toLongLong(), qMakePair(q->value(2).toLongLong(), FuotenEnums::QueueActions(q->value(1).toInt())));
     }
+    q->finish();
 
     if (idsAndQueue.isEmpty()) {
-        qWarning("No items found.");
+        db.rollback();
+        qCWarning(FUOTEN_STORAGE, "No items found.");
         return;
     }
 
-    QHash<qint64,FuotenEnums::QueueActions> idsAndQueueUpdated;
-    QHash<qint64,FuotenEnums::QueueActions>::const_iterator i = idsAndQueue.constBegin();
+    QHash<qint64, int> feedUnreadDeltas;
+
+    QHash<qint64,QPair<qint64,FuotenEnums::QueueActions>>::const_iterator i = idsAndQueue.constBegin();
     while (i != idsAndQueue.constEnd()) {
-        FuotenEnums::QueueActions qa = i.value();
+        FuotenEnums::QueueActions qa = i.value().second;
         if (qa.testFlag(FuotenEnums::MarkAsUnread)) {
             qa ^= FuotenEnums::MarkAsUnread;
         } else {
             qa |= FuotenEnums::MarkAsRead;
         }
-        idsAndQueueUpdated.insert(i.key(), qa);
-        ++i;
-    }
 
-    qresult = m_db.transaction();
-    Q_ASSERT_X(qresult, "equeue mark read worker", "failed to start database transaction");
-
-    QHash<qint64,FuotenEnums::QueueActions>::const_iterator ii = idsAndQueueUpdated.constBegin();
-    while (ii != idsAndQueueUpdated.constEnd()) {
-
-        qresult = q.prepare(QStringLiteral("UPDATE items SET unread = 0, queue = ? WHERE id = ?"));
+        q = statements.query(QStringLiteral("UPDATE items SET unread = 0, queue = ? WHERE id = ? AND unread = 1"), &qresult);
         Q_ASSERT_X(qresult, "enqueue mark read worker", "failed to prepary database query");
 
-        q.addBindValue(static_cast<int>(ii.value()));
-        q.addBindValue(ii.key());
+        q->addBindValue(static_cast<int>(qa));
+        q->addBindValue(i.key());
 
-        qresult = q.exec();
+        qresult = q->exec();
         Q_ASSERT_X(qresult, "enqueue mark read worker", "failed to execute database query");
 
-        ++ii;
-    }
-
-    qresult = m_db.commit();
-    Q_ASSERT_X(qresult, "enqueue mark read worker", "failed to commit database transaction");
+        // only count items whose state really changed
+        feedUnreadDeltas[i.value().first] -= q->numRowsAffected();
 
-    qresult = q.exec(QStringLiteral("SELECT id FROM feeds"));
-    Q_ASSERT(qresult);
-    IdList feedIds;
-    while (q.next()) {
-        feedIds.push_back(q.value(0).value<qint64>());
-    }
-    if (!feedIds.empty()) {
-        qresult = m_db.transaction();
-        Q_ASSERT(qresult);
-        for (const qint64 id : feedIds) {
-            qresult = q.prepare(QStringLiteral("UPDATE feeds SET unreadCount = (SELECT COUNT(id) FROM items WHERE unread = 1 AND feedId = :feedId) WHERE id = :feedId"));
-            Q_ASSERT(qresult);
-            q.bindValue(QStringLiteral(":feedId"), id);
-            qresult = q.exec();
-            Q_ASSERT(qresult);
-        }
-        qresult = m_db.commit();
-        Q_ASSERT(qresult);
+        ++i;
     }
 
-    qresult = q.exec(QStringLiteral("SELECT id FROM folders"));
-    Q_ASSERT(qresult);
-    IdList folderIds;
-    while (q.next()) {
-        folderIds.push_back(q.value(0).value<qint64>());
-    }
-    if (!folderIds.empty()) {
-        qresult = m_db.transaction();
-        Q_ASSERT(qresult);
-        for (const qint64 id : folderIds) {
-            qresult = q.prepare(QStringLiteral("UPDATE folders SET unreadCount = (SELECT SUM(unreadCount) FROM feeds WHERE folderId = :folderId) WHERE id = :folderId"));
-            Q_ASSERT(qresult);
-            q.bindValue(QStringLiteral(":folderId"), id);
-            qresult = q.exec();
-            Q_ASSERT(qresult);
-        }
-        qresult = m_db.commit();
-        Q_ASSERT(qresult);
-    }
+    SQLiteStoragePrivate::applyUnreadDeltas(statements, feedUnreadDeltas);
+
+    qresult = db.commit();
+    Q_ASSERT_X(qresult, "enqueue mark read worker", "failed to commit database transaction");
 
-    qresult = (q.exec(QStringLiteral(SEL_TOTAL_UNREAD)) && q.next());
+    q = statements.exec(QStringLiteral(SEL_TOTAL_UNREAD), &qresult);
+    qresult = (qresult && q->next());
     Q_ASSERT_X(qresult, "enqueue mark read worker", "failed to query totol unread item count from database");
-    Q_EMIT gotTotalUnread(q.value(0).toInt());
+    const int unreadCount = q->value(0).toInt();
+    q->finish();
+    Q_EMIT gotTotalUnread(unreadCount);
 
     switch (m_idType) {
     case FuotenEnums::Feed:
@@ -2956,7 +3931,7 @@ void EnqueueMarkReadWorker::run()
 bool SQLiteStorage::enqueueMarkFeedRead(qint64 feedId, qint64 newestItemId)
 {
     if (inOperation()) {
-        qWarning("Still in operation. Returning.");
+        qCWarning(FUOTEN_STORAGE, "Still in operation. Returning.");
         return false;
     }
 
@@ -2985,7 +3960,7 @@ bool SQLiteStorage::enqueueMarkFeedRead(qint64 feedId, qint64 newestItemId)
 
     Q_D(SQLiteStorage);
 
-    EnqueueMarkReadWorker *worker = new EnqueueMarkReadWorker(d->db.databaseName(), feedId, FuotenEnums::Feed, newestItemId, this);
+    EnqueueMarkReadWorker *worker = new EnqueueMarkReadWorker(d->dbpath, feedId, FuotenEnums::Feed, newestItemId, this);
     connect(worker, &EnqueueMarkReadWorker::markedReadFeedInQueue, this, &SQLiteStorage::markedReadFeedInQueue);
     connect(worker, &EnqueueMarkReadWorker::gotTotalUnread, this, &SQLiteStorage::setTotalUnread);
     connect(worker, &EnqueueMarkReadWorker::failed, this, [=] (Error *e) {setError(e);});
@@ -3001,7 +3976,7 @@ bool SQLiteStorage::enqueueMarkFeedRead(qint64 feedId, qint64 newestItemId)
 bool SQLiteStorage::enqueueMarkFolderRead(qint64 folderId, qint64 newestItemId)
 {
     if (inOperation()) {
-        qWarning("Still in operation. Returning.");
+        qCWarning(FUOTEN_STORAGE, "Still in operation. Returning.");
         return false;
     }
 
@@ -3030,7 +4005,7 @@ bool SQLiteStorage::enqueueMarkFolderRead(qint64 folderId, qint64 newestItemId)
 
     Q_D(SQLiteStorage);
 
-    EnqueueMarkReadWorker *worker = new EnqueueMarkReadWorker(d->db.databaseName(), folderId, FuotenEnums::Folder, newestItemId, this);
+    EnqueueMarkReadWorker *worker = new EnqueueMarkReadWorker(d->dbpath, folderId, FuotenEnums::Folder, newestItemId, this);
     connect(worker, &EnqueueMarkReadWorker::markedReadFolderInQueue, this, &SQLiteStorage::markedReadFolderInQueue);
     connect(worker, &EnqueueMarkReadWorker::gotTotalUnread, this, &SQLiteStorage::setTotalUnread);
     connect(worker, &EnqueueMarkReadWorker::failed, this, [=] (Error *e) {setError(e);});
@@ -3046,7 +4021,7 @@ bool SQLiteStorage::enqueueMarkFolderRead(qint64 folderId, qint64 newestItemId)
 bool SQLiteStorage::enqueueMarkAllItemsRead()
 {
     if (inOperation()) {
-        qWarning("Still in operation. Returning.");
+        qCWarning(FUOTEN_STORAGE, "Still in operation. Returning.");
         return false;
     }
 
@@ -3061,7 +4036,7 @@ bool SQLiteStorage::enqueueMarkAllItemsRead()
 
     Q_D(SQLiteStorage);
 
-    EnqueueMarkReadWorker *worker = new EnqueueMarkReadWorker(d->db.databaseName(), 0, FuotenEnums::All, -1, this);
+    EnqueueMarkReadWorker *worker = new EnqueueMarkReadWorker(d->dbpath, 0, FuotenEnums::All, -1, this);
     connect(worker, &EnqueueMarkReadWorker::markedAllItemsReadInQueue, this, &SQLiteStorage::markedAllItemsReadInQueue);
     connect(worker, &EnqueueMarkReadWorker::gotTotalUnread, this, &SQLiteStorage::setTotalUnread);
     connect(worker, &EnqueueMarkReadWorker::failed, this, [=] (Error *e) {setError(e);});
@@ -3075,14 +4050,9 @@ bool SQLiteStorage::enqueueMarkAllItemsRead()
 
 
 ClearQueueWorker::ClearQueueWorker(const QString &dbpath, QObject *parent) :
-    QThread(parent)
+    QThread(parent), m_dbpath(dbpath)
 {
-    if (!QSqlDatabase::connectionNames().contains(QStringLiteral("fuotendb"))) {
-        m_db = QSqlDatabase::addDatabase(QStringLiteral("QSQLITE"), QStringLiteral("fuotendb"));
-        m_db.setDatabaseName(dbpath);
-    } else {
-        m_db = QSqlDatabase::database(QStringLiteral("fuotendb"));
-    }
+
 }
 
 
@@ -3094,12 +4064,13 @@ ClearQueueWorker::~ClearQueueWorker()
 
 void ClearQueueWorker::run()
 {
-    QSqlQuery q(m_db);
+    QSqlDatabase db = SQLiteConnectionPool::database(m_dbpath);
+    SQLiteStatementCache &statements = *SQLiteConnectionPool::statements(m_dbpath);
+    QSqlQuery *q = nullptr;
 
-    bool qresult = q.exec(QStringLiteral("PRAGMA foreign_keys = ON"));
-    Q_ASSERT_X(qresult, "clear queue worker", "failed to enable foreign keys support");
+    bool qresult = false;
 
-    qresult = q.exec(QStringLiteral("UPDATE items SET queue = 0"));
+    q = statements.exec(QStringLiteral("UPDATE items SET queue = 0 WHERE queue > 0"), &qresult);
     Q_ASSERT_X(qresult, "clear queue worker", "failed to execute databae query");
 
     Q_EMIT queueCleared();
@@ -3110,7 +4081,7 @@ void ClearQueueWorker::run()
 void SQLiteStorage::clearQueue()
 {
     if (inOperation()) {
-        qWarning("Still in operation. Returning.");
+        qCWarning(FUOTEN_STORAGE, "Still in operation. Returning.");
         return;
     }
 
@@ -3125,7 +4096,7 @@ void SQLiteStorage::clearQueue()
 
     Q_D(SQLiteStorage);
 
-    ClearQueueWorker *worker = new ClearQueueWorker(d->db.databaseName(), this);
+    ClearQueueWorker *worker = new ClearQueueWorker(d->dbpath, this);
     connect(worker, &ClearQueueWorker::queueCleared, this, &AbstractStorage::queueCleared);
     connect(worker, &ClearQueueWorker::failed, this, [=] (Error *e) {setError(e);});
     connect(worker, &QThread::finished, this, [=] () {setInOperation(false);});
@@ -3138,7 +4109,7 @@ void SQLiteStorage::clearStorage()
     Q_ASSERT_X(configuration(), "clear storage", "no configuration available");
 
     if (inOperation()) {
-        qWarning("%s", "Still in operation. Returning.");
+        qCWarning(FUOTEN_STORAGE, "%s", "Still in operation. Returning.");
         return;
     }
 
@@ -3147,12 +4118,15 @@ void SQLiteStorage::clearStorage()
         return;
     }
 
-    qDebug("%s", "Start clearing local storage.");
+    qCDebug(FUOTEN_STORAGE, "%s", "Start clearing local storage.");
 
     setInOperation(true);
 
     Q_D(SQLiteStorage);
 
+    // cached statements refer to the tables that will be dropped
+    d->statements.clear();
+
     QSqlQuery q(d->db);
 
     if (Q_UNLIKELY(!q.exec(QStringLiteral("DROP VIEW IF EXISTS total_starred")))) {
@@ -3185,6 +4159,20 @@ void SQLiteStorage::clearStorage()
         return;
     }
 
+    if (Q_UNLIKELY(!q.exec(QStringLiteral("DROP TABLE IF EXISTS items_fts")))) {
+        setError(new Error(q.lastError(), QString(), this));
+        setInOperation(false);
+        return;
+    }
+
+    d->fullTextSearch = false;
+
+    if (Q_UNLIKELY(!q.exec(QStringLiteral("DROP TABLE IF EXISTS item_bodies")))) {
+        setError(new Error(q.lastError(), QString(), this));
+        setInOperation(false);
+        return;
+    }
+
     if (Q_UNLIKELY(!q.exec(QStringLiteral("DROP TABLE IF EXISTS items")))) {
         setError(new Error(q.lastError(), QString(), this));
         setInOperation(false);
@@ -3212,7 +4200,7 @@ void SQLiteStorage::clearStorage()
 
     configuration()->setLastSync(QDateTime::fromMSecsSinceEpoch(0));
 
-    qDebug("%s", "Finished clearing local storage.");
+    qCDebug(FUOTEN_STORAGE, "%s", "Finished clearing local storage.");
 
     setInOperation(false);
 
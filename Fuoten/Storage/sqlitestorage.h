@@ -25,6 +25,14 @@ class Article;
  * To use this storage, simply set the path to the SQLite database file in the constructor and call init().
  * The path to the database file will not be created automatically. It has to be created before calling init().
  *
+ * Article bodies are stored compressed in a separate table and are only read if a query needs the full body,
+ * like getArticleBody() or article queries with a QueryArgs::bodyLimit of \c 0. Smaller body limits are served
+ * from a plain text excerpt that is created when the article is stored.
+ *
+ * Article queries with QueryArgs::search use a FTS5 full text index over the title and the plain text body of the
+ * articles. If the SQLite library has no FTS5 support, the search will fall back to slower pattern matching on the
+ * title and the excerpt without relevance ranking and snippets.
+ *
  * If you want to have a custom storage class, derive from AbstractStorage.
  *
  * \headerfile "" <Fuoten/Storage/SQLiteStorage>
@@ -69,13 +77,45 @@ public:
      * \brief Invokes an asynchronous query for articles in a different thread.
      *
      * Will emit the AbstractStorage::gotArticlesAsync() signal after the query finished. The signal
-     * will contain a list of Article objects. When connecting to this signal, be aware that the objects
-     * in the list have been created in a different thread.
+     * will contain a list of Article objects that have been created in the thread of the storage.
+     * The query is executed by the same thread pool as getArticleRecordsAsync(), but can not be canceled.
      *
      * \param args query arguments
      */
     void getArticlesAsync(const QueryArgs &args) override;
 
+    /*!
+     * \brief Returns a list of ArticleRecord values from the \a items table.
+     * \since 0.9.0
+     */
+    ArticleRecordList getArticleRecords(const QueryArgs &args) override;
+
+    /*!
+     * \brief Invokes an asynchronous query for article records in a different thread.
+     *
+     * The query is executed by a thread pool that runs at most as many queries in parallel as there
+     * are read-only database connections. Will emit the AbstractStorage::gotArticleRecordsAsync() signal
+     * after the query finished. Canceling the returned request removes a waiting query without executing
+     * it and stops a running query before the next rows are read.
+     *
+     * \since 0.9.0
+     *
+     * \param args query arguments
+     */
+    StorageRequest getArticleRecordsAsync(const QueryArgs &args) override;
+
+    /*!
+     * \brief Returns the number of articles matching \a args using a single aggregate query.
+     * \since 0.9.0
+     */
+    int countArticles(const QueryArgs &args) override;
+
+    /*!
+     * \brief Returns the article counts matching \a args grouped by \a grouping using a single aggregate query.
+     * \since 0.9.0
+     */
+    ArticleCountList countArticlesGrouped(const QueryArgs &args, FuotenEnums::ArticleGrouping grouping) override;
+
     /*!
      * \brief Returns the Feed identified by \a id.
      *
@@ -116,6 +156,34 @@ public:
      */
     bool enqueueItem(FuotenEnums::QueueAction action, Article *article) override;
 
+    /*!
+     * \brief Enqueues the \a action for all articles identified by \a itemIds in the local SQLite database.
+     *
+     * The IDs are written into a temporary table that is joined against the items table, so the whole
+     * set is processed in a single transaction, regardless of its size. Only articles whose state really
+     * changes will be enqueued. The unread counters of feeds and folders are updated by the difference.
+     *
+     * \since 0.9.0
+     *
+     * \param action    the action to be performed on the articles
+     * \param itemIds   IDs of the articles the action should be performed on
+     * \return          \c true if the enqueue was successful, otherwise \c false
+     */
+    bool enqueueItems(FuotenEnums::QueueAction action, const IdList &itemIds) override;
+
+    /*!
+     * \brief Enqueues all \a actions in a single transaction in the local SQLite database.
+     *
+     * Works like enqueueItems(FuotenEnums::QueueAction, const IdList&) for every action in the map, but
+     * all of them are written in the same transaction. The signals are emitted after the commit.
+     *
+     * \since 0.9.0
+     *
+     * \param actions   IDs of the articles the actions should be performed on, mapped by the action
+     * \return          \c true if the enqueue was successful, otherwise \c false
+     */
+    bool enqueueItems(const QMap<FuotenEnums::QueueAction, IdList> &actions) override;
+
     /*!
      * \brief Adds all articles older than \a newestItemId in the feed identified by \a feedId as read to the local queue.
      *
@@ -181,6 +249,7 @@ public Q_SLOTS:
     void feedMarkedRead(qint64 id, qint64 newestItem) override;
 
     void itemsRequested(const QJsonDocument &json) override;
+    void itemsBatchRequested(const QJsonArray &items, bool lastBatch) override;
     void itemsMarked(const Fuoten::IdList &itemIds, bool unread) override;
     void itemsStarred(const QList<QPair<qint64, QString>> &articles, bool star) override;
     void itemMarked(qint64 itemId, bool unread) override;
@@ -188,6 +257,8 @@ public Q_SLOTS:
     void allItemsMarkedRead(qint64 newestItemId) override;
 
 private:
+    void processItemBatches();
+
     Q_DECLARE_PRIVATE(SQLiteStorage)
     Q_DISABLE_COPY(SQLiteStorage)
 };
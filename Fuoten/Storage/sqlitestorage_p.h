@@ -8,6 +8,8 @@
 
 #include "sqlitestorage.h"
 #include "abstractstorage_p.h"
+#include "sqlitestatementcache_p.h"
+#include "sqliteconnectionpool_p.h"
 #include "../Helpers/abstractconfiguration.h"
 #include "../Helpers/abstractnotificator.h"
 #include "../article.h"
@@ -15,8 +17,25 @@
 #include <QSqlError>
 #include <QStringList>
 #include <QThread>
+#include <QThreadPool>
+#include <QRunnable>
 #include <QJsonDocument>
+#include <QJsonArray>
+#include <QJsonObject>
 #include <QSqlQuery>
+#include <QSharedPointer>
+#include <QQueue>
+#include <QPair>
+#include <QVector>
+#include <QHash>
+#include <QVariant>
+
+// exports internals that are checked by the unit tests
+#ifdef FUOTEN_AUTOTESTS
+#define FUOTEN_AUTOTEST_EXPORT FUOTEN_EXPORT
+#else
+#define FUOTEN_AUTOTEST_EXPORT
+#endif
 
 namespace Fuoten {
 
@@ -27,7 +46,7 @@ public:
     ~SQLiteStorageManager() override;
 
 private:
-    QSqlDatabase m_db;
+    QString m_dbpath;
     quint16 m_currentDbVersion;
     void setFailed(const QSqlError &sqlError, const QString &text);
 
@@ -40,17 +59,86 @@ Q_SIGNALS:
 };
 
 
+/*!
+ * \internal
+ * \brief Collects the results of all item batches that belong to one items request.
+ *
+ * Only one ItemsRequestedWorker is running at a time, so the state is never accessed concurrently.
+ */
+struct ItemsRequestedState
+{
+    IdList updatedItemIds;
+    IdList newItemIds;
+    QVector<QJsonObject> articlesToPublish;
+    QHash<qint64, int> feedUnreadDeltas;
+    quint32 newUnreadItems = 0;
+};
+
+
+/*
+ * SQL text of a query together with the values to bind to it. The SQL text only depends on the
+ * shape of the query and not on the queried values, so that it can be kept prepared in a
+ * SQLiteStatementCache. IDs are not bound but inserted into the temporary query_ids table.
+ */
+struct SQLiteQuery
+{
+    QString sql;
+    QVariantList values;
+    IdList ids;
+};
+
+
 class SQLiteStoragePrivate : public AbstractStoragePrivate {
 public:
     SQLiteStoragePrivate(const QString &_dbpath);
     ~SQLiteStoragePrivate() override;
 
-    QStringList intListToStringList(const IdList &ints) const;
-    QString intListToString(const IdList &ints) const;
+    /*!
+     * \brief Maximum length of the plain text excerpt that is stored together with every article.
+     *
+     * Body limits up to this value are served from the excerpt column, larger ones have to strip the full body.
+     */
+    static constexpr int excerptLength = 512;
+
+    /*!
+     * \brief Maximum number of changed articles whose records are sent with AbstractStorage::articlesChanged().
+     *
+     * Larger changes like the initial synchronization are cheaper to handle by reloading the models.
+     */
+    static constexpr int maxChangeSetSize = 1000;
+
+    static QStringList intListToStringList(const IdList &ints);
+    static QString intListToString(const IdList &ints);
+    static QString ftsMatchExpression(const QString &search);
+    static QString plainText(const QString &body);
+    static QString excerpt(const QString &body, int length = excerptLength);
+    static QByteArray compressBody(const QString &body);
+    static QString uncompressBody(const QByteArray &data);
+    static QString bodyColumn(int bodyLimit);
+    static QString bodyJoin(int bodyLimit);
+    static QSqlQuery *execQuery(SQLiteStatementCache &statements, const SQLiteQuery &query, bool *ok = nullptr);
+    static SQLiteQuery foldersQuery(FuotenEnums::SortingRole sortingRole, Qt::SortOrder sortOrder, const IdList &ids, FuotenEnums::Type idType, int limit);
+    static SQLiteQuery feedsQuery(const QueryArgs &args);
+    static void appendArticlesFilter(SQLiteQuery &query, const QueryArgs &args, bool fts);
+    static FUOTEN_AUTOTEST_EXPORT SQLiteQuery articleCountsQuery(const QueryArgs &args, FuotenEnums::ArticleGrouping grouping, bool fullTextSearch);
+    static FUOTEN_AUTOTEST_EXPORT SQLiteQuery articlesQuery(const QueryArgs &args, bool fullTextSearch);
+    static ArticleRecord articleRecord(const QSqlQuery &q, int bodyLimit, bool withSnippet);
     QSqlQuery getQuery() const;
+    bool fillBulkIds(const IdList &ids);
+    bool fillBulkGuidHashes(const QList<QPair<qint64, QString>> &articles);
+    int applyBulkUnreadDeltas(bool unread);
+    static void applyUnreadDeltas(SQLiteStatementCache &statements, const QHash<qint64, int> &feedDeltas);
+    bool enqueueBulk(FuotenEnums::QueueAction action, const IdList &itemIds, IdList &changedIds, QList<QPair<qint64, QString>> &changedArticles, int &unreadDelta);
 
+    QString dbpath;
     QSqlDatabase db;
+    SQLiteStatementCache statements;
     QThread worker;
+    QThreadPool readerPool;
+    QQueue<QPair<QJsonArray, bool>> itemBatches;
+    QSharedPointer<ItemsRequestedState> itemsState;
+    bool itemsWorkerRunning = false;
+    bool fullTextSearch = false;
 };
 
 
@@ -58,11 +146,12 @@ class ItemsRequestedWorker : public QThread
 {
     Q_OBJECT
 public:
-    ItemsRequestedWorker(const QString &dbpath, const QJsonDocument &json, AbstractConfiguration *config = nullptr, AbstractNotificator *notificator = nullptr, QObject *parent = nullptr);
+    ItemsRequestedWorker(const QString &dbpath, const QJsonArray &items, bool lastBatch, const QSharedPointer<ItemsRequestedState> &state, bool fullTextSearch, AbstractConfiguration *config = nullptr, AbstractNotificator *notificator = nullptr, QObject *parent = nullptr);
     ~ItemsRequestedWorker() override;
 
 Q_SIGNALS:
     void requestedItems(const Fuoten::IdList &updatedItems, const Fuoten::IdList &newItems, const Fuoten::IdList &deletedItems);
+    void articlesChanged(const Fuoten::ArticleChangeSet &changes);
     void gotTotalUnread(int tu);
     void gotStarred(int st);
     void failed(Fuoten::Error *e);
@@ -71,30 +160,39 @@ protected:
     void run() override;
 
 private:
-    QSqlDatabase m_db;
-    QJsonDocument m_json;
+    QString m_dbpath;
+    QJsonArray m_items;
+    QSharedPointer<ItemsRequestedState> m_state;
     AbstractConfiguration *m_config;
     AbstractNotificator *m_notificator;
+    bool m_lastBatch;
+    bool m_fullTextSearch;
 };
 
 
-class GetArticlesAsyncWorker : public QThread
+/*
+ * Runs in SQLiteStoragePrivate::readerPool. The worker lives in the thread of the storage
+ * and deletes itself there after it emitted finished().
+ */
+class GetArticlesAsyncWorker : public QObject, public QRunnable
 {
     Q_OBJECT
 public:
-    GetArticlesAsyncWorker(const QString &dbpath, const QueryArgs &args, QObject *parent = nullptr);
+    GetArticlesAsyncWorker(const QString &dbpath, const QueryArgs &args, bool fullTextSearch, const StorageRequest &request, QObject *parent = nullptr);
     ~GetArticlesAsyncWorker() override;
 
+    void run() override;
+
 Q_SIGNALS:
-    void gotArticles(const Fuoten::ArticleList &articles);
+    void gotArticleRecords(int requestId, const Fuoten::ArticleRecordList &records);
     void failed(Fuoten::Error *e);
-
-protected:
-    void run() override;
+    void finished();
 
 private:
-    QSqlDatabase m_db;
+    QString m_dbpath;
     QueryArgs m_args;
+    StorageRequest m_request;
+    bool m_fullTextSearch;
 };
 
 
@@ -118,7 +216,7 @@ protected:
 private:
     qint64 m_id;
     qint64 m_newestItemId;
-    QSqlDatabase m_db;
+    QString m_dbpath;
     FuotenEnums::Type m_idType;
 };
 
@@ -139,7 +237,7 @@ protected:
     void run() override;
 
 private:
-    QSqlDatabase m_db;
+    QString m_dbpath;
 };
 
 
@@ -0,0 +1,68 @@
+/*
+ * SPDX-FileCopyrightText: (C) 2016-2022 Matthias Fehring <https://www.huessenbergnetz.de>
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#include "storagerequest.h"
+#include <QAtomicInt>
+
+namespace Fuoten {
+
+struct StorageRequestData
+{
+    int id = 0;
+    QAtomicInt canceled;
+};
+
+}
+
+using namespace Fuoten;
+
+StorageRequest::StorageRequest()
+{
+
+}
+
+
+StorageRequest StorageRequest::create()
+{
+    static QAtomicInt lastId;
+
+    StorageRequest r;
+    r.d = QSharedPointer<StorageRequestData>::create();
+    // zero is reserved for invalid handles
+    int id = lastId.fetchAndAddOrdered(1) + 1;
+    if (Q_UNLIKELY(id <= 0)) {
+        lastId.storeRelease(1);
+        id = 1;
+    }
+    r.d->id = id;
+
+    return r;
+}
+
+
+int StorageRequest::id() const
+{
+    return d ? d->id : 0;
+}
+
+
+bool StorageRequest::isValid() const
+{
+    return !d.isNull();
+}
+
+
+void StorageRequest::cancel()
+{
+    if (d) {
+        d->canceled.storeRelease(1);
+    }
+}
+
+
+bool StorageRequest::isCanceled() const
+{
+    return d && (d->canceled.loadAcquire() == 1);
+}
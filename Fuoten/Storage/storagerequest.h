@@ -0,0 +1,75 @@
+/*
+ * SPDX-FileCopyrightText: (C) 2016-2022 Matthias Fehring <https://www.huessenbergnetz.de>
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#ifndef FUOTENSTORAGEREQUEST_H
+#define FUOTENSTORAGEREQUEST_H
+
+#include <QSharedPointer>
+#include <QMetaType>
+#include "fuoten_export.h"
+
+namespace Fuoten {
+
+struct StorageRequestData;
+
+/*!
+ * \brief Handle for an asynchronous request to the local storage.
+ *
+ * Returned by AbstractStorage::getArticleRecordsAsync(). The signal that delivers the result contains
+ * the id() of the request, so receivers can ignore results of requests they are not interested in anymore.
+ * Copies of a handle refer to the same request, so canceling one copy cancels the request for all of them.
+ *
+ * A default constructed handle is invalid.
+ *
+ * \since 0.9.0
+ *
+ * \headerfile "" <Fuoten/Storage/StorageRequest>
+ */
+class FUOTEN_EXPORT StorageRequest
+{
+public:
+    /*!
+     * \brief Constructs an invalid request handle.
+     */
+    StorageRequest();
+
+    /*!
+     * \brief Creates a handle for a new request with a unique id().
+     */
+    static StorageRequest create();
+
+    /*!
+     * \brief Returns the ID of the request, \c 0 if the handle is invalid.
+     */
+    int id() const;
+
+    /*!
+     * \brief Returns \c true if the handle refers to a request.
+     */
+    bool isValid() const;
+
+    /*!
+     * \brief Cancels the request.
+     *
+     * A request that has not been started yet will not be executed at all, a running request
+     * will be stopped as soon as possible by the storage. No result will be delivered for
+     * a canceled request. Canceling an already finished request has no effect.
+     */
+    void cancel();
+
+    /*!
+     * \brief Returns \c true if cancel() has been called on any copy of this handle.
+     */
+    bool isCanceled() const;
+
+private:
+    QSharedPointer<StorageRequestData> d;
+};
+
+}
+
+Q_DECLARE_METATYPE(Fuoten::StorageRequest)
+
+#endif // FUOTENSTORAGEREQUEST_H
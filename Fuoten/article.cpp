@@ -4,9 +4,11 @@
  */
 
 #include "article_p.h"
+#include "logging_p.h"
 #include "API/component.h"
 #include "API/markitem.h"
 #include "API/staritem.h"
+#include "Helpers/articleactioncoalescer.h"
 #include "fuoten.h"
 #include "error.h"
 
@@ -97,6 +99,39 @@ ArticlePrivate::ArticlePrivate(Article *other) :
 }
 
 
+ArticlePrivate::ArticlePrivate(const ArticleRecord &record) :
+    BaseItemPrivate(record.id),
+    feedId(record.feedId),
+    folderId(record.folderId),
+    feedTitle(record.feedTitle),
+    guid(record.guid),
+    guidHash(record.guidHash),
+    title(record.title),
+    author(record.author),
+    body(record.body),
+    enclosureMime(record.enclosureMime),
+    fingerprint(record.fingerprint),
+    folderName(record.folderName),
+    mediaDescription(record.mediaDescription),
+    url(record.url),
+    enclosureLink(record.enclosureLink),
+    mediaThumbnail(record.mediaThumbnail),
+#if (QT_VERSION >= QT_VERSION_CHECK(5, 8, 0))
+    pubDate(QDateTime::fromSecsSinceEpoch(record.pubDate)),
+    lastModified(QDateTime::fromSecsSinceEpoch(record.lastModified)),
+#else
+    pubDate(QDateTime::fromTime_t(static_cast<uint>(record.pubDate))),
+    lastModified(QDateTime::fromTime_t(static_cast<uint>(record.lastModified))),
+#endif
+    queue(record.queue),
+    unread(record.unread),
+    starred(record.starred),
+    rtl(record.rtl)
+{
+    createHumanPubDateTime();
+}
+
+
 ArticlePrivate::~ArticlePrivate()
 {
 
@@ -135,14 +170,14 @@ void ArticlePrivate::createHumanPubDateTime()
 Article::Article(QObject *parent) :
     BaseItem(* new ArticlePrivate, parent)
 {
-    qDebug("Creating new empty Article object at %p.", this);
+    qCDebug(FUOTEN_CORE, "Creating new empty Article object at %p.", this);
 }
 
 
 Article::Article(qint64 id, qint64 feedId, const QString &feedTitle, const QString &guid, const QString &guidHash, const QUrl &url, const QString &title, const QString &author, const QDateTime &pubDate, const QString &body, const QString &enclosureMime, const QUrl &enclosureLink, bool unread, bool starred, const QDateTime &lastModified, const QString &fingerprint, qint64 folderId, const QString &folderName, FuotenEnums::QueueActions queue, bool rtl, const QUrl &mediaThumbnail, const QString &mediaDescription, QObject *parent) :
     BaseItem(* new ArticlePrivate(id, feedId, feedTitle, guid, guidHash, url, title, author, pubDate, body, enclosureMime, enclosureLink, unread, starred, lastModified, fingerprint, folderId, folderName, queue, rtl, mediaThumbnail, mediaDescription), parent)
 {
-    qDebug("Creating new Article object (ID: %lli, Title: %s) at %p.", id, qUtf8Printable(title), this);
+    qCDebug(FUOTEN_CORE, "Creating new Article object (ID: %lli, Title: %s) at %p.", id, qUtf8Printable(title), this);
 }
 
 
@@ -152,6 +187,12 @@ Article::Article(Article *other, QObject *parent) :
 }
 
 
+Article::Article(const ArticleRecord &record, QObject *parent) :
+    BaseItem(* new ArticlePrivate(record), parent)
+{
+}
+
+
 Article::Article(ArticlePrivate &dd, QObject *parent) :
     BaseItem(dd, parent)
 {
@@ -172,7 +213,7 @@ void Article::setFeedId(qint64 nFeedId)
     Q_D(Article);
     if (nFeedId != d->feedId) {
         d->feedId = nFeedId;
-        qDebug("Changed feedId to %lli.", d->feedId);
+        qCDebug(FUOTEN_CORE, "Changed feedId to %lli.", d->feedId);
         Q_EMIT feedIdChanged(feedId());
     }
 }
@@ -185,7 +226,7 @@ void Article::setFeedTitle(const QString &nFeedTitle)
     Q_D(Article);
     if (nFeedTitle != d->feedTitle) {
         d->feedTitle = nFeedTitle;
-        qDebug("Changed feedTitle to \"%s\".", qUtf8Printable(d->feedTitle));
+        qCDebug(FUOTEN_CORE, "Changed feedTitle to \"%s\".", qUtf8Printable(d->feedTitle));
         Q_EMIT feedTitleChanged(feedTitle());
     }
 }
@@ -198,7 +239,7 @@ void Article::setGuid(const QString &nGuid)
     Q_D(Article);
     if (nGuid != d->guid) {
         d->guid = nGuid;
-        qDebug("Changed guid to \"%s\".", qUtf8Printable(d->guid));
+        qCDebug(FUOTEN_CORE, "Changed guid to \"%s\".", qUtf8Printable(d->guid));
         Q_EMIT guidChanged(guid());
     }
 }
@@ -211,7 +252,7 @@ void Article::setGuidHash(const QString &nGuidHash)
     Q_D(Article);
     if (nGuidHash != d->guidHash) {
         d->guidHash = nGuidHash;
-        qDebug("Changed guidHash to \"%s\".", qUtf8Printable(d->guidHash));
+        qCDebug(FUOTEN_CORE, "Changed guidHash to \"%s\".", qUtf8Printable(d->guidHash));
         Q_EMIT guidHashChanged(guidHash());
     }
 }
@@ -224,7 +265,7 @@ void Article::setUrl(const QUrl &nUrl)
     Q_D(Article);
     if (nUrl != d->url) {
         d->url = nUrl;
-        qDebug("Changed url to %s.", qUtf8Printable(d->url.toString()));
+        qCDebug(FUOTEN_CORE, "Changed url to %s.", qUtf8Printable(d->url.toString()));
         Q_EMIT urlChanged(url());
     }
 }
@@ -237,7 +278,7 @@ void Article::setTitle(const QString &nTitle)
     Q_D(Article);
     if (nTitle != d->title) {
         d->title = nTitle;
-        qDebug("Changed title to \"%s\".", qUtf8Printable(d->title));
+        qCDebug(FUOTEN_CORE, "Changed title to \"%s\".", qUtf8Printable(d->title));
         Q_EMIT titleChanged(title());
     }
 }
@@ -250,7 +291,7 @@ void Article::setAuthor(const QString &nAuthor)
     Q_D(Article);
     if (nAuthor != d->author) {
         d->author = nAuthor;
-        qDebug("Changed author to \"%s\".", qUtf8Printable(d->author));
+        qCDebug(FUOTEN_CORE, "Changed author to \"%s\".", qUtf8Printable(d->author));
         Q_EMIT authorChanged(author());
     }
 }
@@ -263,7 +304,7 @@ void Article::setPubDate(const QDateTime &nPubDate)
     Q_D(Article);
     if (nPubDate != d->pubDate) {
         d->pubDate = nPubDate;
-        qDebug("Changed pubDate to %s.", qUtf8Printable(d->pubDate.toString(Qt::ISODate)));
+        qCDebug(FUOTEN_CORE, "Changed pubDate to %s.", qUtf8Printable(d->pubDate.toString(Qt::ISODate)));
         Q_EMIT pubDateChanged(pubDate());
         d->createHumanPubDateTime();
         Q_EMIT humanPubDateChanged(humanPubDate());
@@ -279,7 +320,7 @@ void Article::setBody(const QString &nBody)
     Q_D(Article);
     if (nBody != d->body) {
         d->body = nBody;
-        qDebug("%s", "Changed body.");
+        qCDebug(FUOTEN_CORE, "%s", "Changed body.");
         Q_EMIT bodyChanged(body());
     }
 }
@@ -292,7 +333,7 @@ void Article::setEnclosureMime(const QString &nEnclosureMime)
     Q_D(Article);
     if (nEnclosureMime != d->enclosureMime) {
         d->enclosureMime = nEnclosureMime;
-        qDebug("Changed enclosureMime to \"%s\".", qUtf8Printable(d->enclosureMime));
+        qCDebug(FUOTEN_CORE, "Changed enclosureMime to \"%s\".", qUtf8Printable(d->enclosureMime));
         Q_EMIT enclosureMimeChanged(enclosureMime());
     }
 }
@@ -305,7 +346,7 @@ void Article::setEnclosureLink(const QUrl &nEnclosureLink)
     Q_D(Article);
     if (nEnclosureLink != d->enclosureLink) {
         d->enclosureLink = nEnclosureLink;
-        qDebug("Changed enclosureLink to %s.", qUtf8Printable(d->enclosureLink.toString()));
+        qCDebug(FUOTEN_CORE, "Changed enclosureLink to %s.", qUtf8Printable(d->enclosureLink.toString()));
         Q_EMIT enclosureLinkChanged(enclosureLink());
     }
 }
@@ -318,7 +359,7 @@ void Article::setUnread(bool nUnread)
     Q_D(Article);
     if (nUnread != d->unread) {
         d->unread = nUnread;
-        qDebug("Changed unread to %s.", d->unread ? "true" : "false");
+        qCDebug(FUOTEN_CORE, "Changed unread to %s.", d->unread ? "true" : "false");
         Q_EMIT unreadChanged(unread());
     }
 }
@@ -331,7 +372,7 @@ void Article::setStarred(bool nStarred)
     Q_D(Article);
     if (nStarred != d->starred) {
         d->starred = nStarred;
-        qDebug("Changed starred to %s.", d->starred ? "true" : "false");
+        qCDebug(FUOTEN_CORE, "Changed starred to %s.", d->starred ? "true" : "false");
         Q_EMIT starredChanged(starred());
     }
 }
@@ -344,7 +385,7 @@ void Article::setLastModified(const QDateTime &nLastModified)
     Q_D(Article);
     if (nLastModified != d->lastModified) {
         d->lastModified = nLastModified;
-        qDebug("Changed lastModified to %s.", qUtf8Printable(d->lastModified.toString(Qt::ISODate)));
+        qCDebug(FUOTEN_CORE, "Changed lastModified to %s.", qUtf8Printable(d->lastModified.toString(Qt::ISODate)));
         Q_EMIT lastModifiedChanged(lastModified());
     }
 }
@@ -357,7 +398,7 @@ void Article::setFingerprint(const QString &nFingerprint)
     Q_D(Article);
     if (nFingerprint != d->fingerprint) {
         d->fingerprint = nFingerprint;
-        qDebug("Changed fingerprint to \"%s\".", qUtf8Printable(d->fingerprint));
+        qCDebug(FUOTEN_CORE, "Changed fingerprint to \"%s\".", qUtf8Printable(d->fingerprint));
         Q_EMIT fingerprintChanged(fingerprint());
     }
 }
@@ -370,7 +411,7 @@ void Article::setFolderId(qint64 nFolderId)
     Q_D(Article);
     if (nFolderId != d->folderId) {
         d->folderId = nFolderId;
-        qDebug("Changed folderId to %lli.", d->folderId);
+        qCDebug(FUOTEN_CORE, "Changed folderId to %lli.", d->folderId);
         Q_EMIT folderIdChanged(folderId());
     }
 }
@@ -383,7 +424,7 @@ void Article::setFolderName(const QString &nFolderName)
     Q_D(Article);
     if (nFolderName != d->folderName) {
         d->folderName = nFolderName;
-        qDebug("Changed folderName to \"%s\".", qUtf8Printable(d->folderName));
+        qCDebug(FUOTEN_CORE, "Changed folderName to \"%s\".", qUtf8Printable(d->folderName));
         Q_EMIT folderNameChanged(folderName());
     }
 }
@@ -401,7 +442,7 @@ void Article::setRtl(bool nRtl)
 {
     Q_D(Article);
     if (nRtl != d->rtl) {
-        qDebug("Changed rtl from %s to %s.", d->rtl ? "true" : "false", nRtl ? "true" : "false");
+        qCDebug(FUOTEN_CORE, "Changed rtl from %s to %s.", d->rtl ? "true" : "false", nRtl ? "true" : "false");
         d->rtl = nRtl;
         Q_EMIT rtlChanged(rtl());
     }
@@ -414,7 +455,7 @@ void Article::setMediaThumbnail(const QUrl &nMediaThumbnail)
 {
     Q_D(Article);
     if (nMediaThumbnail != d->mediaThumbnail) {
-        qDebug("Changed mediaThumbnail from \"%s\" to \"%s\".", qUtf8Printable(d->mediaThumbnail.toString()), qUtf8Printable(nMediaThumbnail.toString()));
+        qCDebug(FUOTEN_CORE, "Changed mediaThumbnail from \"%s\" to \"%s\".", qUtf8Printable(d->mediaThumbnail.toString()), qUtf8Printable(nMediaThumbnail.toString()));
         d->mediaThumbnail = nMediaThumbnail;
         Q_EMIT mediaThumbnailChanged(mediaThumbnail());
     }
@@ -427,7 +468,7 @@ void Article::setMediaDescription(const QString &nMediaDescription)
 {
     Q_D(Article);
     if (nMediaDescription != d->mediaDescription) {
-        qDebug("%s", "Changed mediaDescription.");
+        qCDebug(FUOTEN_CORE, "%s", "Changed mediaDescription.");
         d->mediaDescription = nMediaDescription;
         Q_EMIT mediaDescriptionChanged(mediaDescription());
     }
@@ -467,17 +508,61 @@ void Article::copy(BaseItem *other)
         setFolderName(o->folderName());
         setQueue(o->queue());
     } else {
-        qCritical("Failed to cast BaseItem to Article when trying to create a deep copy!");
+        qCCritical(FUOTEN_CORE, "Failed to cast BaseItem to Article when trying to create a deep copy!");
     }
 }
 
 
+ArticleRecord Article::toRecord() const
+{
+    Q_D(const Article);
+
+    ArticleRecord r;
+    r.id = d->id;
+    r.feedId = d->feedId;
+    r.folderId = d->folderId;
+#if (QT_VERSION >= QT_VERSION_CHECK(5, 8, 0))
+    r.pubDate = d->pubDate.toSecsSinceEpoch();
+    r.lastModified = d->lastModified.toSecsSinceEpoch();
+#else
+    r.pubDate = d->pubDate.toTime_t();
+    r.lastModified = d->lastModified.toTime_t();
+#endif
+    r.feedTitle = d->feedTitle;
+    r.guid = d->guid;
+    r.guidHash = d->guidHash;
+    r.url = d->url.toString();
+    r.title = d->title;
+    r.author = d->author;
+    r.body = d->body;
+    r.enclosureMime = d->enclosureMime;
+    r.enclosureLink = d->enclosureLink.toString();
+    r.fingerprint = d->fingerprint;
+    r.folderName = d->folderName;
+    r.mediaThumbnail = d->mediaThumbnail.toString();
+    r.mediaDescription = d->mediaDescription;
+    r.queue = d->queue;
+    r.unread = d->unread;
+    r.starred = d->starred;
+    r.rtl = d->rtl;
+
+    return r;
+}
+
+
 void Article::mark(bool unread, AbstractConfiguration *config, AbstractStorage *storage, bool enqueue)
 {
     Q_ASSERT_X(config, "mark article as read", "invalid configuration");
 
     if (Q_UNLIKELY(inOperation())) {
-        qWarning("Item is still in operation.");
+        qCWarning(FUOTEN_CORE, "Item is still in operation.");
+        return;
+    }
+
+    // the coalescer performs the actions with its own configuration and storage
+    ArticleActionCoalescer *coalescer = Component::defaultActionCoalescer();
+    if (coalescer && (coalescer->configuration() == config) && (coalescer->storage() == storage)) {
+        coalescer->mark(this, unread, enqueue);
         return;
     }
 
@@ -522,7 +607,14 @@ void Article::star(bool starred, AbstractConfiguration *config, AbstractStorage
     Q_ASSERT_X(config, "star article", "invalid configuration");
 
     if (Q_UNLIKELY(inOperation())) {
-        qWarning("Item is still in operation.");
+        qCWarning(FUOTEN_CORE, "Item is still in operation.");
+        return;
+    }
+
+    // the coalescer performs the actions with its own configuration and storage
+    ArticleActionCoalescer *coalescer = Component::defaultActionCoalescer();
+    if (coalescer && (coalescer->configuration() == config) && (coalescer->storage() == storage)) {
+        coalescer->star(this, starred, enqueue);
         return;
     }
 
@@ -12,6 +12,7 @@
 #include "baseitem.h"
 #include "fuoten_global.h"
 #include "fuoten.h"
+#include "articlerecord.h"
 #include "fuoten_export.h"
 
 namespace Fuoten {
@@ -248,6 +249,12 @@ public:
      */
     explicit Article(Article *other, QObject *parent = nullptr);
 
+    /*!
+     * \brief Constructs a new Article object with the given \a parent from the data in \a record.
+     * \since 0.9.0
+     */
+    explicit Article(const ArticleRecord &record, QObject *parent = nullptr);
+
     /*!
      * \brief Deconstructs the %Article object.
      */
@@ -497,6 +504,12 @@ public:
      */
     void copy(BaseItem *other) override;
 
+    /*!
+     * \brief Returns the data of this article as ArticleRecord.
+     * \since 0.9.0
+     */
+    ArticleRecord toRecord() const;
+
     /*!
      * \brief Marks this article as \a read or \a unread on the server.
      *
@@ -506,6 +519,10 @@ public:
      * \param config    pointer to an AbstractConfiguration object that containts the authentication credentials
      * \param storage   pointer to an AbstractStorage object to update the local storage after successful request
      * \param enqueue   \c true to enqueue the marking local up to the next sync, valid \c storage has to be available
+     *
+     * If a default ArticleActionCoalescer has been set via Component::setDefaultActionCoalescer() that uses
+     * the same \a config and \a storage, the marking will be handed over to it and performed together with
+     * other markings. Otherwise it will be performed directly.
      */
     Q_INVOKABLE void mark(bool unread, Fuoten::AbstractConfiguration *config, Fuoten::AbstractStorage *storage = nullptr, bool enqueue = false);
 
@@ -527,6 +544,9 @@ public:
      * \param config    pointer to an AbstractConfiguration object that containts the authentication credentials
      * \param storage   pointer to an AbstractStorage object to update the local storage after successful request
      * \param enqueue   \c true to enqueue the un/starring local up to the next sync, valid \c storage has to be available
+     *
+     * Like mark(), this will be handed over to the default ArticleActionCoalescer if it uses the same
+     * \a config and \a storage.
      */
     Q_INVOKABLE void star(bool starred, Fuoten::AbstractConfiguration *config, Fuoten::AbstractStorage *storage = nullptr, bool enqueue = false);
 
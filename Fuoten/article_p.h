@@ -41,6 +41,8 @@ public:
 
     ArticlePrivate(Article *other);
 
+    explicit ArticlePrivate(const ArticleRecord &record);
+
     ~ArticlePrivate() override;
 
     void createHumanPubDateTime();
@@ -0,0 +1,44 @@
+/*
+ * SPDX-FileCopyrightText: (C) 2016-2022 Matthias Fehring <https://www.huessenbergnetz.de>
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#ifndef FUOTENARTICLECHANGESET_H
+#define FUOTENARTICLECHANGESET_H
+
+#include <QMetaType>
+#include "fuoten_global.h"
+#include "articlerecord.h"
+#include "fuoten_export.h"
+
+namespace Fuoten {
+
+/*!
+ * \brief Articles that have been changed by a single storage operation.
+ *
+ * Emitted by AbstractStorage::articlesChanged() after items have been requested from the server. It
+ * contains the complete records of the new and updated articles, so that models can update their rows
+ * without querying the storage again. The ArticleRecord::body of the records contains the plain text
+ * excerpt of the article as returned for a positive QueryArgs::bodyLimit of up to bodyLimit characters.
+ *
+ * \since 0.9.0
+ *
+ * \headerfile "" <Fuoten/ArticleChangeSet>
+ */
+struct FUOTEN_EXPORT ArticleChangeSet {
+    ArticleRecordList added;    /**< Records of the articles that are new in the storage. */
+    ArticleRecordList updated;  /**< Records of the articles that have been updated. */
+    IdList removed;             /**< IDs of the articles that have been removed from the storage. */
+    int bodyLimit = 0;          /**< Maximum length of the body excerpts in the records. */
+
+    /*!
+     * \brief Returns \c true if the change set does not contain any change.
+     */
+    bool isEmpty() const { return added.isEmpty() && updated.isEmpty() && removed.isEmpty(); }
+};
+
+}
+
+Q_DECLARE_METATYPE(Fuoten::ArticleChangeSet)
+
+#endif // FUOTENARTICLECHANGESET_H
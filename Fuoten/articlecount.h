@@ -0,0 +1,45 @@
+/*
+ * SPDX-FileCopyrightText: (C) 2016-2022 Matthias Fehring <https://www.huessenbergnetz.de>
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#ifndef FUOTENARTICLECOUNT_H
+#define FUOTENARTICLECOUNT_H
+
+#include <QVector>
+#include <QMetaType>
+#include "fuoten.h"
+#include "fuoten_export.h"
+
+namespace Fuoten {
+
+/*!
+ * \brief Number of articles in a group of articles.
+ *
+ * Returned by AbstractStorage::countArticlesGrouped(). The meaning of group depends on the
+ * requested FuotenEnums::ArticleGrouping.
+ *
+ * \since 0.9.0
+ *
+ * \headerfile "" <Fuoten/ArticleCount>
+ */
+struct FUOTEN_EXPORT ArticleCount {
+    qint64 group = 0;   /**< Feed ID, folder ID, state or day of the group, \c 0 if not grouped. */
+    int total = 0;      /**< Number of articles in the group. */
+    int unread = 0;     /**< Number of unread articles in the group. */
+    int starred = 0;    /**< Number of starred articles in the group. */
+};
+
+/*!
+ * \brief List of ArticleCount values.
+ * \since 0.9.0
+ */
+using ArticleCountList = QVector<ArticleCount>;
+
+}
+
+Q_DECLARE_TYPEINFO(Fuoten::ArticleCount, Q_PRIMITIVE_TYPE);
+Q_DECLARE_METATYPE(Fuoten::ArticleCount)
+Q_DECLARE_METATYPE(Fuoten::ArticleCountList)
+
+#endif // FUOTENARTICLECOUNT_H
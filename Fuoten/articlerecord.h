@@ -0,0 +1,75 @@
+/*
+ * SPDX-FileCopyrightText: (C) 2016-2022 Matthias Fehring <https://www.huessenbergnetz.de>
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#ifndef FUOTENARTICLERECORD_H
+#define FUOTENARTICLERECORD_H
+
+#include <QString>
+#include <QVector>
+#include <QMetaType>
+#include "fuoten.h"
+#include "fuoten_export.h"
+
+namespace Fuoten {
+
+/*!
+ * \brief Plain value type containing the data of a single article.
+ *
+ * In contrast to Article, this is no QObject. It can be copied cheaply, it can be passed between
+ * threads and a list of it only needs a single allocation. It is used by AbstractStorage::getArticleRecords()
+ * and AbstractStorage::getArticleRecordsAsync() to query articles for the models, that will only create
+ * an Article object for a row if it is requested.
+ *
+ * URLs are stored as strings and dates as seconds since the epoch in UTC, they will only be parsed
+ * if an Article object gets created from the record.
+ *
+ * \since 0.9.0
+ *
+ * \headerfile "" <Fuoten/ArticleRecord>
+ */
+struct FUOTEN_EXPORT ArticleRecord {
+    qint64 id = 0;                          /**< ID of the article. \c 0 if the record is not valid. */
+    qint64 feedId = 0;                      /**< ID of the feed the article belongs to. */
+    qint64 folderId = 0;                    /**< ID of the folder the feed of the article belongs to. */
+    qint64 pubDate = 0;                     /**< Publication date in seconds since the epoch in UTC. */
+    qint64 lastModified = 0;                /**< Last modification date in seconds since the epoch in UTC. */
+    QString feedTitle;                      /**< Title of the feed the article belongs to. */
+    QString guid;                           /**< GUID of the article. */
+    QString guidHash;                       /**< GUID hash of the article. */
+    QString url;                            /**< URL of the article. */
+    QString title;                          /**< Title of the article. */
+    QString author;                         /**< Author of the article. */
+    QString body;                           /**< Body of the article, might be limited by QueryArgs::bodyLimit. */
+    QString enclosureMime;                  /**< Mime type of the enclosure. */
+    QString enclosureLink;                  /**< URL of the enclosure. */
+    QString fingerprint;                    /**< Fingerprint of the article. */
+    QString folderName;                     /**< Name of the folder the feed of the article belongs to. */
+    QString mediaThumbnail;                 /**< URL of the media thumbnail. */
+    QString mediaDescription;               /**< Media description. */
+    QString snippet;                        /**< Excerpt of the matching text if QueryArgs::searchSnippetTokens has been set on a full text search. */
+    FuotenEnums::QueueActions queue;        /**< Locally queued actions. */
+    bool unread = false;                    /**< \c true if the article is unread. */
+    bool starred = false;                   /**< \c true if the article is starred. */
+    bool rtl = false;                       /**< \c true if the article should be displayed right-to-left. */
+
+    /*!
+     * \brief Returns \c true if the record contains a valid article ID.
+     */
+    bool isValid() const { return id > 0; }
+};
+
+/*!
+ * \brief List of ArticleRecord values.
+ * \since 0.9.0
+ */
+using ArticleRecordList = QVector<ArticleRecord>;
+
+}
+
+Q_DECLARE_TYPEINFO(Fuoten::ArticleRecord, Q_MOVABLE_TYPE);
+Q_DECLARE_METATYPE(Fuoten::ArticleRecord)
+Q_DECLARE_METATYPE(Fuoten::ArticleRecordList)
+
+#endif // FUOTENARTICLERECORD_H
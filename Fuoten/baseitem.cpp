@@ -4,6 +4,7 @@
  */
 
 #include "baseitem_p.h"
+#include "logging_p.h"
 #include "error.h"
 
 using namespace Fuoten;
@@ -59,7 +60,7 @@ void BaseItem::setId(qint64 nId)
     Q_D(BaseItem);
     if (nId != d->id) {
         d->id = nId;
-        qDebug("Changed id to %lli.", d->id);
+        qCDebug(FUOTEN_CORE, "Changed id to %lli.", d->id);
         Q_EMIT idChanged(id());
     }
 }
@@ -86,7 +87,7 @@ void BaseItem::setError(Error *nError)
             d->error = nError;
         }
 
-        qDebug("Changed error to %p.", d->error);
+        qCDebug(FUOTEN_CORE, "Changed error to %p.", d->error);
         Q_EMIT errorChanged(error());
 
         if (old) {
@@ -4,6 +4,7 @@
  */
 
 #include "error_p.h"
+#include "logging_p.h"
 #include <QNetworkReply>
 #include <QJsonParseError>
 #include <QSqlError>
@@ -391,7 +392,7 @@ void Error::setText(const QString &nText)
     Q_D(Error);
     if (nText != d->text) {
         d->text = nText;
-        qDebug("Changed text to \"%s\".", qUtf8Printable(d->text));
+        qCDebug(FUOTEN_CORE, "Changed text to \"%s\".", qUtf8Printable(d->text));
         Q_EMIT textChanged(text());
     }
 }
@@ -404,7 +405,7 @@ void Error::setType(Type nType)
     Q_D(Error);
     if (nType != d->type) {
         d->type = nType;
-        qDebug("Changed type to %s.", metaObject()->enumerator(metaObject()->indexOfEnumerator("Type")).valueToKey(d->type));
+        qCDebug(FUOTEN_CORE, "Changed type to %s.", metaObject()->enumerator(metaObject()->indexOfEnumerator("Type")).valueToKey(d->type));
         Q_EMIT typeChanged(type());
     }
 }
@@ -417,7 +418,7 @@ void Error::setData(const QString &nData)
     Q_D(Error);
     if (nData != d->data) {
         d->data = nData;
-        qDebug("Changed data to \"%s\".", qUtf8Printable(d->data));
+        qCDebug(FUOTEN_CORE, "Changed data to \"%s\".", qUtf8Printable(d->data));
         Q_EMIT dataChanged(data());
     }
 }
@@ -432,7 +433,7 @@ void Error::setSeverity(Severity nSeverity)
     Q_D(Error);
     if (nSeverity != d->severity) {
         d->severity = nSeverity;
-        qDebug("Changed severity to %s.", metaObject()->enumerator(metaObject()->indexOfEnumerator("Severity")).valueToKey(d->severity));
+        qCDebug(FUOTEN_CORE, "Changed severity to %s.", metaObject()->enumerator(metaObject()->indexOfEnumerator("Severity")).valueToKey(d->severity));
         Q_EMIT severityChanged(severity());
     }
 }
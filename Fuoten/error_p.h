@@ -7,6 +7,7 @@
 #define FUOTENERROR_P_H
 
 #include "error.h"
+#include "logging_p.h"
 #include <QMetaEnum>
 #include <QMetaObject>
 
@@ -24,10 +25,10 @@ public:
     {
         switch(severity) {
         case Error::Warning:
-            qWarning("%s: %s", Error::staticMetaObject.enumerator(Error::staticMetaObject.indexOfEnumerator("Type")).valueToKey(type), qUtf8Printable(text));
+            qCWarning(FUOTEN_CORE, "%s: %s", Error::staticMetaObject.enumerator(Error::staticMetaObject.indexOfEnumerator("Type")).valueToKey(type), qUtf8Printable(text));
             break;
         case Error::Critical:
-            qCritical("%s: %s", Error::staticMetaObject.enumerator(Error::staticMetaObject.indexOfEnumerator("Type")).valueToKey(type), qUtf8Printable(text));
+            qCCritical(FUOTEN_CORE, "%s: %s", Error::staticMetaObject.enumerator(Error::staticMetaObject.indexOfEnumerator("Type")).valueToKey(type), qUtf8Printable(text));
             break;
         case Error::Fatal:
             qFatal("%s: %s", Error::staticMetaObject.enumerator(Error::staticMetaObject.indexOfEnumerator("Type")).valueToKey(type), qUtf8Printable(text));
@@ -35,11 +36,9 @@ public:
             break;
         }
 
-#ifndef QT_NO_DEBUG_OUTPUT
         if (!data.isEmpty()) {
-            qDebug("Error data: %s", qUtf8Printable(data));
+            qCDebug(FUOTEN_CORE, "Error data: %s", qUtf8Printable(data));
         }
-#endif
     }
 
 };
@@ -4,6 +4,7 @@
  */
 
 #include "feed_p.h"
+#include "logging_p.h"
 #include "API/component.h"
 #include "API/renamefeed.h"
 #include "API/deletefeed.h"
@@ -50,14 +51,14 @@ FeedPrivate::~FeedPrivate()
 Feed::Feed(QObject *parent) :
     BaseItem(* new FeedPrivate, parent)
 {
-    qDebug("Creatig new empty Feed object at %p.", this);
+    qCDebug(FUOTEN_CORE, "Creatig new empty Feed object at %p.", this);
 }
 
 
 Feed::Feed(qint64 id, qint64 folderId, const QString &title, const QUrl &url, const QUrl &link, const QDateTime &added, uint unreadCount, Feed::FeedOrdering ordering, bool pinned, uint updateErrorCount, const QString &lastUpdateError, const QUrl &faviconLink, const QString &folderName, QObject *parent) :
     BaseItem(* new FeedPrivate(id, folderId, title, url, link, added, unreadCount, ordering, pinned, updateErrorCount, lastUpdateError, faviconLink, folderName), parent)
 {
-    qDebug("Creating new Feed object (ID: %lli, Title: %s) at %p.", id, qUtf8Printable(title), this);
+    qCDebug(FUOTEN_CORE, "Creating new Feed object (ID: %lli, Title: %s) at %p.", id, qUtf8Printable(title), this);
 }
 
 
@@ -80,7 +81,7 @@ void Feed::setUrl(const QUrl &nUrl)
     Q_D(Feed);
     if (nUrl != d->url) {
         d->url = nUrl;
-        qDebug("Changed URL to %s.", qUtf8Printable(d->url.toString()));
+        qCDebug(FUOTEN_CORE, "Changed URL to %s.", qUtf8Printable(d->url.toString()));
         Q_EMIT urlChanged(url());
     }
 }
@@ -95,7 +96,7 @@ void Feed::setTitle(const QString &nTitle)
     Q_D(Feed);
     if (nTitle != d->title) {
         d->title = nTitle;
-        qDebug("Changed title to %s.", qUtf8Printable(d->title));
+        qCDebug(FUOTEN_CORE, "Changed title to %s.", qUtf8Printable(d->title));
         Q_EMIT titleChanged(title());
     }
 }
@@ -110,7 +111,7 @@ void Feed::setAdded(const QDateTime &nAdded)
     Q_D(Feed);
     if (nAdded != d->added) {
         d->added = nAdded;
-        qDebug("Changed added to %s.", qUtf8Printable(d->added.toString(Qt::ISODate)));
+        qCDebug(FUOTEN_CORE, "Changed added to %s.", qUtf8Printable(d->added.toString(Qt::ISODate)));
         Q_EMIT addedChanged(added());
     }
 }
@@ -125,7 +126,7 @@ void Feed::setFolderId(qint64 nFolderId)
     Q_D(Feed);
     if (nFolderId != d->folderId) {
         d->folderId = nFolderId;
-        qDebug("Changed folderId to %lli.", d->folderId);
+        qCDebug(FUOTEN_CORE, "Changed folderId to %lli.", d->folderId);
         Q_EMIT folderIdChanged(folderId());
     }
 }
@@ -140,7 +141,7 @@ void Feed::setFolderName(const QString &nFolderName)
     Q_D(Feed);
     if (nFolderName != d->folderName) {
         d->folderName = nFolderName;
-        qDebug("Changed folderName to %s.", qUtf8Printable(d->folderName));
+        qCDebug(FUOTEN_CORE, "Changed folderName to %s.", qUtf8Printable(d->folderName));
         Q_EMIT folderNameChanged(folderName());
     }
 }
@@ -155,7 +156,7 @@ void Feed::setUnreadCount(uint nUnreadCount)
     Q_D(Feed);
     if (nUnreadCount != d->unreadCount) {
         d->unreadCount = nUnreadCount;
-        qDebug("Changed unreadCount to %u.", d->unreadCount);
+        qCDebug(FUOTEN_CORE, "Changed unreadCount to %u.", d->unreadCount);
         Q_EMIT unreadCountChanged(unreadCount());
     }
 }
@@ -170,7 +171,7 @@ void Feed::setOrdering(FeedOrdering nOrdering)
     Q_D(Feed);
     if (nOrdering != d->ordering) {
         d->ordering = nOrdering;
-        qDebug("Changed ordering to %s.", metaObject()->enumerator(metaObject()->indexOfEnumerator("FeedOrdering")).valueToKey(d->ordering));
+        qCDebug(FUOTEN_CORE, "Changed ordering to %s.", metaObject()->enumerator(metaObject()->indexOfEnumerator("FeedOrdering")).valueToKey(d->ordering));
         Q_EMIT orderingChanged(ordering());
     }
 }
@@ -185,7 +186,7 @@ void Feed::setLink(const QUrl &nLink)
     Q_D(Feed);
     if (nLink != d->link) {
         d->link = nLink;
-        qDebug("Changed link to %s.", qUtf8Printable(d->link.toString()));
+        qCDebug(FUOTEN_CORE, "Changed link to %s.", qUtf8Printable(d->link.toString()));
         Q_EMIT linkChanged(link());
     }
 }
@@ -200,7 +201,7 @@ void Feed::setPinned(bool nPinned)
     Q_D(Feed);
     if (nPinned != d->pinned) {
         d->pinned = nPinned;
-        qDebug("Changed pinned to %s.", d->pinned ? "true" : "false");
+        qCDebug(FUOTEN_CORE, "Changed pinned to %s.", d->pinned ? "true" : "false");
         Q_EMIT pinnedChanged(pinned());
     }
 }
@@ -215,7 +216,7 @@ void Feed::setUpdateErrorCount(uint nUpdateErrorCount)
     Q_D(Feed);
     if (nUpdateErrorCount != d->updateErrorCount) {
         d->updateErrorCount = nUpdateErrorCount;
-        qDebug("Changed updateErrorCount to %u.", d->updateErrorCount);
+        qCDebug(FUOTEN_CORE, "Changed updateErrorCount to %u.", d->updateErrorCount);
         Q_EMIT updateErrorCountChanged(updateErrorCount());
     }
 }
@@ -230,7 +231,7 @@ void Feed::setLastUpdateError(const QString &nLastUpdateError)
     Q_D(Feed);
     if (nLastUpdateError != d->lastUpdateError) {
         d->lastUpdateError = nLastUpdateError;
-        qDebug("Changed lastUpdateError to %s.", qUtf8Printable(d->lastUpdateError));
+        qCDebug(FUOTEN_CORE, "Changed lastUpdateError to %s.", qUtf8Printable(d->lastUpdateError));
         Q_EMIT lastUpdateErrorChanged(lastUpdateError());
     }
 }
@@ -245,7 +246,7 @@ void Feed::setFaviconLink(const QUrl &nFaviconLink)
     Q_D(Feed);
     if (nFaviconLink != d->faviconLink) {
         d->faviconLink = nFaviconLink;
-        qDebug("Changed faviconLink to %s.", qUtf8Printable(d->faviconLink.toString()));
+        qCDebug(FUOTEN_CORE, "Changed faviconLink to %s.", qUtf8Printable(d->faviconLink.toString()));
         Q_EMIT faviconLinkChanged(faviconLink());
     }
 }
@@ -271,7 +272,7 @@ void Feed::copy(Fuoten::BaseItem *other)
         setUpdateErrorCount(o->updateErrorCount());
         setUrl(o->url());
     } else {
-        qCritical("Failed to cast BaseItem to Feed when trying to create a deep copy!");
+        qCCritical(FUOTEN_CORE, "Failed to cast BaseItem to Feed when trying to create a deep copy!");
     }
 }
 
@@ -282,7 +283,7 @@ void Feed::rename(const QString &newName, AbstractConfiguration *config, Abstrac
     Q_ASSERT_X(config, "rename feed", "invalid configuration");
 
     if (Q_UNLIKELY(inOperation())) {
-        qWarning("Folder is still in operation.");
+        qCWarning(FUOTEN_CORE, "Folder is still in operation.");
         return;
     }
 
@@ -318,7 +319,7 @@ void Feed::remove(AbstractConfiguration *config, AbstractStorage *storage)
     Q_ASSERT_X(config, "remove feed", "invalid configuration");
 
     if (inOperation()) {
-        qWarning("Feed is still in operation.");
+        qCWarning(FUOTEN_CORE, "Feed is still in operation.");
         return;
     }
 
@@ -344,7 +345,7 @@ void Feed::move(qint64 targetFolderId, AbstractConfiguration *config, AbstractSt
     Q_ASSERT_X(config, "move feed", "invalid configuration");
 
     if (inOperation()) {
-        qWarning("Feed is still in operation.");
+        qCWarning(FUOTEN_CORE, "Feed is still in operation.");
         return;
     }
 
@@ -380,7 +381,7 @@ void Feed::markAsRead(AbstractConfiguration *config, AbstractStorage *storage, b
     Q_ASSERT_X(config, "enqueue mark feed as read", "missing configuration object");
 
     if (Q_UNLIKELY(inOperation())) {
-        qWarning("Folder is still in operation.");
+        qCWarning(FUOTEN_CORE, "Folder is still in operation.");
         return;
     }
 
@@ -4,6 +4,7 @@
  */
 
 #include "folder_p.h"
+#include "logging_p.h"
 #include <QJsonDocument>
 #include <QJsonObject>
 #include "API/deletefolder.h"
@@ -42,7 +43,7 @@ FolderPrivate::~FolderPrivate()
 Folder::Folder(QObject *parent) :
     BaseItem(* new FolderPrivate, parent)
 {
-    qDebug("Creating new empty Folder object at %p.", this);
+    qCDebug(FUOTEN_CORE, "Creating new empty Folder object at %p.", this);
 }
 
 
@@ -50,7 +51,7 @@ Folder::Folder(QObject *parent) :
 Folder::Folder(qint64 id, const QString &name, uint feedCount, uint unreadCount, QObject *parent) :
     BaseItem(* new FolderPrivate(id, name, feedCount, unreadCount), parent)
 {
-    qDebug("Creating new Folder object (ID: %lli, Name: %s) at %p.", id, qUtf8Printable(name), this);
+    qCDebug(FUOTEN_CORE, "Creating new Folder object (ID: %lli, Name: %s) at %p.", id, qUtf8Printable(name), this);
 }
 
 
@@ -74,7 +75,7 @@ void Folder::setName(const QString &nName)
     Q_D(Folder);
     if (nName != d->name) {
         d->name = nName;
-        qDebug("Changed name to %s.", qUtf8Printable(d->name));
+        qCDebug(FUOTEN_CORE, "Changed name to %s.", qUtf8Printable(d->name));
         Q_EMIT nameChanged(name());
     }
 }
@@ -89,7 +90,7 @@ void Folder::setFeedCount(uint nFeedCount)
     Q_D(Folder);
     if (nFeedCount != d->feedCount) {
         d->feedCount = nFeedCount;
-        qDebug("Changed feedCount to %u.", d->feedCount);
+        qCDebug(FUOTEN_CORE, "Changed feedCount to %u.", d->feedCount);
         Q_EMIT feedCountChanged(feedCount());
     }
 }
@@ -104,7 +105,7 @@ void Folder::setUnreadCount(uint nUnreadCount)
     Q_D(Folder);
     if (nUnreadCount != d->unreadCount) {
         d->unreadCount = nUnreadCount;
-        qDebug("Changed unreadCount to %u.", d->unreadCount);
+        qCDebug(FUOTEN_CORE, "Changed unreadCount to %u.", d->unreadCount);
         Q_EMIT unreadCountChanged(unreadCount());
     }
 }
@@ -118,7 +119,7 @@ void Folder::rename(const QString &newName, AbstractConfiguration *config, Abstr
     Q_ASSERT_X(!newName.isEmpty(), "rename folder", "empty new name");
 
     if (Q_UNLIKELY(inOperation())) {
-        qWarning("Folder is still in operation.");
+        qCWarning(FUOTEN_CORE, "Folder is still in operation.");
         return;
     }
 
@@ -154,7 +155,7 @@ void Folder::remove(AbstractConfiguration *config, AbstractStorage *storage)
     Q_ASSERT_X(config, "remove folder", "missing configuration");
 
     if (Q_UNLIKELY(inOperation())) {
-        qWarning("Folder is still in operation.");
+        qCWarning(FUOTEN_CORE, "Folder is still in operation.");
         return;
     }
 
@@ -180,7 +181,7 @@ void Folder::markAsRead(AbstractConfiguration *config, AbstractStorage *storage,
     Q_ASSERT_X(config, "mark folder as read", "missing configuration");
 
     if (Q_UNLIKELY(inOperation())) {
-        qWarning("Folder is still in operation.");
+        qCWarning(FUOTEN_CORE, "Folder is still in operation.");
         return;
     }
 
@@ -227,7 +228,7 @@ void Folder::copy(BaseItem *other)
         setFeedCount(o->feedCount());
         setUnreadCount(o->unreadCount());
     } else {
-        qCritical("Failed to cast BaseItem to Folder when trying to create a deep copy!");
+        qCCritical(FUOTEN_CORE, "Failed to cast BaseItem to Folder when trying to create a deep copy!");
     }
 
 }
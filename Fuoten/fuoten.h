@@ -45,7 +45,8 @@ public:
         Time        = 2,    /**< Sort by time */
         UnreadCount = 3,    /**< Sort by unread item count */
         FeedCount   = 4,    /**< Sort by feed count (only applicable to folders) */
-        FolderName  = 5     /**< Sort by folder name (only applicable to feeds) */
+        FolderName  = 5,    /**< Sort by folder name (only applicable to feeds) */
+        Relevance   = 6     /**< Sort by relevance of a full text search (only applicable to article searches, since 0.9.0) */
     };
     Q_ENUM(SortingRole)
 
@@ -72,6 +73,21 @@ public:
     };
     Q_ENUM(ItemDeletionStrategy)
 
+    /*!
+     * \brief Grouping of article counts.
+     * \since 0.9.0
+     * \sa AbstractStorage::countArticlesGrouped()
+     */
+    enum ArticleGrouping : quint8 {
+        NoGrouping      = 0,    /**< All matching articles are counted together. */
+        GroupByFeed     = 1,    /**< Articles are counted per feed ID. */
+        GroupByFolder   = 2,    /**< Articles are counted per folder ID. */
+        GroupByUnread   = 3,    /**< Articles are counted by unread state, the group is \c 1 for unread articles. */
+        GroupByStarred  = 4,    /**< Articles are counted by starred state, the group is \c 1 for starred articles. */
+        GroupByDay      = 5     /**< Articles are counted per day of publication, the group is the start of the day in seconds since the epoch in UTC. */
+    };
+    Q_ENUM(ArticleGrouping)
+
 private:
     FuotenEnums();
     ~FuotenEnums();
@@ -0,0 +1,12 @@
+/*
+ * SPDX-FileCopyrightText: (C) 2016-2022 Matthias Fehring <https://www.huessenbergnetz.de>
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#include "logging_p.h"
+
+Q_LOGGING_CATEGORY(FUOTEN_CORE, "fuoten.core", QtInfoMsg)
+Q_LOGGING_CATEGORY(FUOTEN_NETWORK, "fuoten.network", QtInfoMsg)
+Q_LOGGING_CATEGORY(FUOTEN_STORAGE, "fuoten.storage", QtInfoMsg)
+Q_LOGGING_CATEGORY(FUOTEN_SYNC, "fuoten.sync", QtInfoMsg)
+Q_LOGGING_CATEGORY(FUOTEN_MODELS, "fuoten.models", QtInfoMsg)
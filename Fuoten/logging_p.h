@@ -0,0 +1,22 @@
+/*
+ * SPDX-FileCopyrightText: (C) 2016-2022 Matthias Fehring <https://www.huessenbergnetz.de>
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#ifndef FUOTENLOGGING_P_H
+#define FUOTENLOGGING_P_H
+
+#include <QLoggingCategory>
+
+/*
+ * Logging categories of the library. Debug output is disabled by default and can be enabled
+ * at runtime, for example with QT_LOGGING_RULES="fuoten.storage.debug=true". The arguments of
+ * qCDebug() are only evaluated if the category is enabled.
+ */
+Q_DECLARE_LOGGING_CATEGORY(FUOTEN_CORE)
+Q_DECLARE_LOGGING_CATEGORY(FUOTEN_NETWORK)
+Q_DECLARE_LOGGING_CATEGORY(FUOTEN_STORAGE)
+Q_DECLARE_LOGGING_CATEGORY(FUOTEN_SYNC)
+Q_DECLARE_LOGGING_CATEGORY(FUOTEN_MODELS)
+
+#endif // FUOTENLOGGING_P_H
@@ -0,0 +1,62 @@
+/*
+ * SPDX-FileCopyrightText: (C) 2016-2022 Matthias Fehring <https://www.huessenbergnetz.de>
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#include "resourcereport.h"
+#include <QTest>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#ifdef Q_OS_UNIX
+#include <sys/resource.h>
+#endif
+
+static std::atomic<quint64> s_allocations(0);
+
+void *operator new(std::size_t size)
+{
+    ++s_allocations;
+    void *p = std::malloc(size ? size : 1);
+    if (Q_UNLIKELY(!p)) {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+void operator delete(void *p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void *p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+ResourceReport::ResourceReport() :
+    m_allocations(s_allocations.load())
+{
+
+}
+
+void ResourceReport::print(int iterations) const
+{
+    const quint64 allocs = (s_allocations.load() - m_allocations) / static_cast<quint64>(qMax(1, iterations));
+    qInfo("%s: %llu allocations per iteration, peak RSS %lli KiB", QTest::currentDataTag() ? QTest::currentDataTag() : QTest::currentTestFunction(), allocs, peakRss());
+}
+
+qint64 ResourceReport::peakRss()
+{
+#ifdef Q_OS_UNIX
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) == 0) {
+#ifdef Q_OS_MACOS
+        return static_cast<qint64>(usage.ru_maxrss) / 1024;
+#else
+        return static_cast<qint64>(usage.ru_maxrss);
+#endif
+    }
+#endif
+    return -1;
+}
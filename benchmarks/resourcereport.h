@@ -0,0 +1,31 @@
+/*
+ * SPDX-FileCopyrightText: (C) 2016-2022 Matthias Fehring <https://www.huessenbergnetz.de>
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#ifndef FUOTENRESOURCEREPORT_H
+#define FUOTENRESOURCEREPORT_H
+
+#include <QtGlobal>
+
+/*
+ * Prints the allocations and the peak resident set size after a benchmark.
+ * The wall time is reported by QBENCHMARK itself.
+ *
+ * Every allocation of the process, including the ones inside the library,
+ * goes through the operator new defined in resourcereport.cpp.
+ */
+class ResourceReport
+{
+public:
+    ResourceReport();
+
+    void print(int iterations = 1) const;
+
+    static qint64 peakRss();
+
+private:
+    quint64 m_allocations;
+};
+
+#endif // FUOTENRESOURCEREPORT_H
@@ -0,0 +1,374 @@
+/*
+ * SPDX-FileCopyrightText: (C) 2016-2022 Matthias Fehring <https://www.huessenbergnetz.de>
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#include "resourcereport.h"
+#include "syntheticdata.h"
+#include "storagehelpers.h"
+#include <Fuoten/Storage/SQLiteStorage>
+#include <Fuoten/Models/ArticleListModel>
+#include <QtTest>
+#include <QTemporaryDir>
+#include <QSignalSpy>
+#include <QScopedPointer>
+
+using namespace Fuoten;
+
+Q_DECLARE_METATYPE(Fuoten::QueryArgs)
+
+namespace {
+
+constexpr int waitTimeout = 600000;
+
+}
+
+/*
+ * Benchmarks for the storage ingest, the article queries, the enqueueing of actions and the article models.
+ *
+ * Query, action and model benchmarks use a database containing FUOTEN_BENCH_ITEMS items (default 10000).
+ */
+class StorageBench : public QObject
+{
+    Q_OBJECT
+private Q_SLOTS:
+    void initTestCase();
+    void cleanupTestCase();
+
+    void ingest_data();
+    void ingest();
+
+    void queries_data();
+    void queries();
+
+    void counts_data();
+    void counts();
+
+    void actionBursts_data();
+    void actionBursts();
+
+    void modelLoad_data();
+    void modelLoad();
+
+    void modelUpdate_data();
+    void modelUpdate();
+
+private:
+    QTemporaryDir m_dir;
+    SyntheticData m_data;
+    QScopedPointer<SQLiteStorage> m_storage;
+    int m_itemCount = 10000;
+    int m_revision = 0;
+};
+
+
+void StorageBench::initTestCase()
+{
+    QVERIFY(m_dir.isValid());
+
+    bool ok = false;
+    const int count = qEnvironmentVariableIntValue("FUOTEN_BENCH_ITEMS", &ok);
+    if (ok && count > 0) {
+        m_itemCount = count;
+    }
+
+    m_storage.reset(new SQLiteStorage(m_dir.filePath(QStringLiteral("bench.sqlite"))));
+    QVERIFY(initStorage(m_storage.data(), waitTimeout));
+    QVERIFY(ingestStructure(m_storage.data(), m_data, waitTimeout));
+    QVERIFY(::ingest(m_storage.data(), m_data.itemsReply(m_itemCount), waitTimeout));
+}
+
+
+void StorageBench::cleanupTestCase()
+{
+    m_storage.reset();
+}
+
+
+void StorageBench::ingest_data()
+{
+    QTest::addColumn<int>("count");
+    QTest::addColumn<bool>("update");
+
+    QTest::newRow("insert 1k") << 1000 << false;
+    QTest::newRow("insert 10k") << 10000 << false;
+    QTest::newRow("insert 100k") << 100000 << false;
+    QTest::newRow("update 1k") << 1000 << true;
+    QTest::newRow("update 10k") << 10000 << true;
+    QTest::newRow("update 100k") << 100000 << true;
+}
+
+
+void StorageBench::ingest()
+{
+    QFETCH(int, count);
+    QFETCH(bool, update);
+
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+
+    SQLiteStorage storage(dir.filePath(QStringLiteral("ingest.sqlite")));
+    QVERIFY(initStorage(&storage, waitTimeout));
+
+    SyntheticData data;
+    QVERIFY(ingestStructure(&storage, data, waitTimeout));
+
+    if (update) {
+        QVERIFY(::ingest(&storage, data.itemsReply(count), waitTimeout));
+    }
+
+    const QJsonDocument items = data.itemsReply(count, 1, update ? 1 : 0);
+
+    ResourceReport report;
+    bool ok = false;
+    QBENCHMARK_ONCE {
+        ok = ::ingest(&storage, items, waitTimeout);
+    }
+    report.print();
+
+    QVERIFY(ok);
+}
+
+
+void StorageBench::queries_data()
+{
+    QTest::addColumn<QueryArgs>("args");
+
+    QueryArgs qa;
+    QTest::newRow("all by id") << qa;
+
+    qa.sortingRole = FuotenEnums::Time;
+    qa.sortOrder = Qt::DescendingOrder;
+    QTest::newRow("all by time desc") << qa;
+
+    qa.sortingRole = FuotenEnums::Name;
+    qa.sortOrder = Qt::AscendingOrder;
+    QTest::newRow("all by title") << qa;
+
+    qa = QueryArgs();
+    qa.sortingRole = FuotenEnums::Time;
+    qa.sortOrder = Qt::DescendingOrder;
+    qa.unreadOnly = true;
+    QTest::newRow("unread only") << qa;
+
+    qa.unreadOnly = false;
+    qa.starredOnly = true;
+    QTest::newRow("starred only") << qa;
+
+    qa.starredOnly = false;
+    qa.queuedOnly = true;
+    QTest::newRow("queued only") << qa;
+
+    qa.queuedOnly = false;
+    qa.parentId = 1;
+    qa.parentIdType = FuotenEnums::Feed;
+    QTest::newRow("feed") << qa;
+
+    qa.parentIdType = FuotenEnums::Folder;
+    QTest::newRow("folder") << qa;
+
+    qa.unreadOnly = true;
+    QTest::newRow("folder unread") << qa;
+
+    qa = QueryArgs();
+    for (qint64 id = 1; id <= 1000; id += 2) {
+        qa.inIds.append(id);
+    }
+    qa.inIdsType = FuotenEnums::Item;
+    QTest::newRow("in 500 ids") << qa;
+
+    qa = QueryArgs();
+    qa.sortingRole = FuotenEnums::Time;
+    qa.sortOrder = Qt::DescendingOrder;
+    qa.bodyLimit = 200;
+    QTest::newRow("excerpt body") << qa;
+
+    qa.bodyLimit = 0;
+    QTest::newRow("full body") << qa;
+
+    qa.bodyLimit = -1;
+    qa.limit = 50;
+    QTest::newRow("first page of 50") << qa;
+
+    qa.cursorId = m_itemCount / 2;
+    qa.cursorPubDate = QDateTime::fromMSecsSinceEpoch((1500000000LL + qa.cursorId * 60) * 1000, Qt::UTC);
+    QTest::newRow("keyset page of 50") << qa;
+
+    qa = QueryArgs();
+    qa.search = QStringLiteral("kernel secur");
+    QTest::newRow("search") << qa;
+
+    qa.sortingRole = FuotenEnums::Relevance;
+    qa.sortOrder = Qt::DescendingOrder;
+    qa.searchSnippetTokens = 12;
+    qa.limit = 50;
+    QTest::newRow("search ranked with snippets") << qa;
+}
+
+
+void StorageBench::queries()
+{
+    QFETCH(QueryArgs, args);
+
+    int iterations = 0;
+    int rows = 0;
+    ResourceReport report;
+    QBENCHMARK {
+        rows = m_storage->getArticleRecords(args).size();
+        ++iterations;
+    }
+    report.print(iterations);
+
+    Q_UNUSED(rows)
+}
+
+
+void StorageBench::counts_data()
+{
+    QTest::addColumn<int>("grouping");
+
+    QTest::newRow("no grouping") << static_cast<int>(FuotenEnums::NoGrouping);
+    QTest::newRow("by feed") << static_cast<int>(FuotenEnums::GroupByFeed);
+    QTest::newRow("by folder") << static_cast<int>(FuotenEnums::GroupByFolder);
+    QTest::newRow("by day") << static_cast<int>(FuotenEnums::GroupByDay);
+}
+
+
+void StorageBench::counts()
+{
+    QFETCH(int, grouping);
+
+    const QueryArgs args;
+    int iterations = 0;
+    ResourceReport report;
+    QBENCHMARK {
+        m_storage->countArticlesGrouped(args, static_cast<FuotenEnums::ArticleGrouping>(grouping));
+        ++iterations;
+    }
+    report.print(iterations);
+}
+
+
+void StorageBench::actionBursts_data()
+{
+    QTest::addColumn<int>("count");
+    QTest::addColumn<bool>("mark");
+    QTest::addColumn<bool>("star");
+
+    QTest::newRow("mark 10") << 10 << true << false;
+    QTest::newRow("mark 100") << 100 << true << false;
+    QTest::newRow("mark 1000") << 1000 << true << false;
+    QTest::newRow("star 100") << 100 << false << true;
+    QTest::newRow("star 1000") << 1000 << false << true;
+    QTest::newRow("mark and star 1000") << 1000 << true << true;
+}
+
+
+void StorageBench::actionBursts()
+{
+    QFETCH(int, count);
+    QFETCH(bool, mark);
+    QFETCH(bool, star);
+
+    IdList ids;
+    ids.reserve(count);
+    for (qint64 id = 1; id <= qMin(count, m_itemCount); ++id) {
+        ids.append(id);
+    }
+
+    // every iteration performs an action and its opposite, so the state is the same afterwards
+    QMap<FuotenEnums::QueueAction, IdList> forward;
+    QMap<FuotenEnums::QueueAction, IdList> backward;
+    if (mark) {
+        forward.insert(FuotenEnums::MarkAsRead, ids);
+        backward.insert(FuotenEnums::MarkAsUnread, ids);
+    }
+    if (star) {
+        forward.insert(FuotenEnums::Star, ids);
+        backward.insert(FuotenEnums::Unstar, ids);
+    }
+
+    int iterations = 0;
+    bool ok = true;
+    ResourceReport report;
+    QBENCHMARK {
+        ok = m_storage->enqueueItems(forward) && ok;
+        ok = m_storage->enqueueItems(backward) && ok;
+        ++iterations;
+    }
+    report.print(iterations);
+
+    QVERIFY(ok);
+}
+
+
+void StorageBench::modelLoad_data()
+{
+    QTest::addColumn<int>("pageSize");
+    QTest::addColumn<int>("bodyLimit");
+
+    QTest::newRow("complete without body") << 0 << -1;
+    QTest::newRow("complete with excerpts") << 0 << 200;
+    QTest::newRow("first page of 100") << 100 << -1;
+}
+
+
+void StorageBench::modelLoad()
+{
+    QFETCH(int, pageSize);
+    QFETCH(int, bodyLimit);
+
+    int iterations = 0;
+    ResourceReport report;
+    QBENCHMARK {
+        ArticleListModel model;
+        model.setStorage(m_storage.data());
+        model.setPageSize(pageSize);
+        model.setBodyLimit(bodyLimit);
+        QSignalSpy spy(&model, &BaseModel::loadedChanged);
+        model.load();
+        QVERIFY(waitFor(spy, waitTimeout));
+        ++iterations;
+    }
+    report.print(iterations);
+}
+
+
+void StorageBench::modelUpdate_data()
+{
+    QTest::addColumn<int>("count");
+
+    QTest::newRow("update 10") << 10;
+    QTest::newRow("update 100") << 100;
+    QTest::newRow("update 1000") << 1000;
+}
+
+
+void StorageBench::modelUpdate()
+{
+    QFETCH(int, count);
+
+    ArticleListModel model;
+    model.setStorage(m_storage.data());
+    model.setBodyLimit(200);
+    QSignalSpy loadSpy(&model, &BaseModel::loadedChanged);
+    model.load();
+    QVERIFY(waitFor(loadSpy, waitTimeout));
+
+    const QJsonDocument items = m_data.itemsReply(qMin(count, m_itemCount), 1, ++m_revision);
+
+    ResourceReport report;
+    bool ok = false;
+    QBENCHMARK_ONCE {
+        ok = ::ingest(m_storage.data(), items, waitTimeout);
+        // the model is updated in the slots connected to the storage signals
+        QCoreApplication::processEvents();
+    }
+    report.print();
+
+    QVERIFY(ok);
+}
+
+QTEST_GUILESS_MAIN(StorageBench)
+
+#include "storagebench.moc"
@@ -0,0 +1,266 @@
+/*
+ * SPDX-FileCopyrightText: (C) 2016-2022 Matthias Fehring <https://www.huessenbergnetz.de>
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#include "resourcereport.h"
+#include "syntheticdata.h"
+#include "storagehelpers.h"
+#include "mocknewsserver.h"
+#include <Fuoten/Helpers/AbstractConfiguration>
+#include <Fuoten/Helpers/Synchronizer>
+#include <Fuoten/Storage/SQLiteStorage>
+#include <Fuoten/Error>
+#include <QtTest>
+#include <QTemporaryDir>
+#include <QSignalSpy>
+#include <QScopedPointer>
+#include <QEventLoop>
+#include <QTimer>
+
+using namespace Fuoten;
+
+namespace {
+
+constexpr int waitTimeout = 600000;
+
+/*
+ * Configuration pointing to the MockNewsServer on loopback.
+ */
+class BenchConfiguration : public AbstractConfiguration
+{
+public:
+    explicit BenchConfiguration(quint16 port) : m_port(port) {}
+
+    QString getUsername() const override { return QStringLiteral("bench"); }
+    QString getPassword() const override { return QStringLiteral("bench"); }
+    bool getUseSSL() const override { return false; }
+    QString getHost() const override { return QStringLiteral("127.0.0.1"); }
+    QString getInstallPath() const override { return QString(); }
+    bool isAccountValid() const override { return true; }
+    int getServerPort() const override { return m_port; }
+    QDateTime getLastSync() const override { return m_lastSync; }
+    void setLastSync(const QDateTime &syncTime) override { m_lastSync = syncTime; }
+
+protected:
+    void setIsAccountValid(bool nIsAccountValid) override { Q_UNUSED(nIsAccountValid) }
+
+private:
+    QDateTime m_lastSync;
+    quint16 m_port;
+};
+
+bool sync(AbstractConfiguration *config, AbstractStorage *storage)
+{
+    Synchronizer synchronizer;
+    synchronizer.setConfiguration(config);
+    synchronizer.setStorage(storage);
+
+    bool succeeded = false;
+    QString error;
+    QEventLoop loop;
+    QObject::connect(&synchronizer, &Synchronizer::succeeded, &loop, [&loop, &succeeded](){
+        succeeded = true;
+        loop.quit();
+    });
+    QObject::connect(&synchronizer, &Synchronizer::failed, &loop, [&loop, &error](Error *e){
+        error = e ? e->text() : QStringLiteral("unknown error");
+        loop.quit();
+    });
+    QTimer::singleShot(waitTimeout, &loop, &QEventLoop::quit);
+
+    synchronizer.sync();
+    loop.exec();
+
+    if (!error.isEmpty()) {
+        qWarning("Synchronization failed: %s", qUtf8Printable(error));
+    }
+
+    return succeeded;
+}
+
+void printTraffic(const MockNewsServer::Stats &stats)
+{
+    qInfo("%s: %lli requests, %lli bytes sent, %lli bytes uncompressed", QTest::currentDataTag() ? QTest::currentDataTag() : QTest::currentTestFunction(), stats.requests, stats.bytesSent, stats.uncompressedBytes);
+}
+
+}
+
+/*
+ * End-to-end benchmarks of the Synchronizer against a MockNewsServer on loopback.
+ *
+ * The server serves FUOTEN_BENCH_ITEMS items (default 10000). Delta synchronizations and
+ * queue flushes run against a database that has been fully synchronized in initTestCase().
+ */
+class SyncBench : public QObject
+{
+    Q_OBJECT
+private Q_SLOTS:
+    void initTestCase();
+    void cleanupTestCase();
+    void init();
+
+    void fullSync_data();
+    void fullSync();
+
+    void deltaSync_data();
+    void deltaSync();
+
+    void queueFlush_data();
+    void queueFlush();
+
+private:
+    QTemporaryDir m_dir;
+    SyntheticData m_data;
+    MockNewsServer m_server;
+    QScopedPointer<BenchConfiguration> m_config;
+    QScopedPointer<SQLiteStorage> m_storage;
+    int m_itemCount = 10000;
+    int m_revision = 0;
+};
+
+
+void SyncBench::initTestCase()
+{
+    QVERIFY(m_dir.isValid());
+
+    bool ok = false;
+    const int count = qEnvironmentVariableIntValue("FUOTEN_BENCH_ITEMS", &ok);
+    if (ok && count > 0) {
+        m_itemCount = count;
+    }
+
+    m_server.setData(m_data.folders(), m_data.feeds(), m_data.itemsReply(m_itemCount));
+    QVERIFY2(m_server.listen(), qPrintable(m_server.errorString()));
+
+    m_config.reset(new BenchConfiguration(m_server.port()));
+    m_storage.reset(new SQLiteStorage(m_dir.filePath(QStringLiteral("sync.sqlite"))));
+    QVERIFY(initStorage(m_storage.data(), waitTimeout));
+    QVERIFY(sync(m_config.data(), m_storage.data()));
+}
+
+
+void SyncBench::cleanupTestCase()
+{
+    m_storage.reset();
+}
+
+
+void SyncBench::init()
+{
+    m_server.latency = 0;
+    m_server.bandwidth = 0;
+    m_server.compression = true;
+    m_server.resetStats();
+}
+
+
+void SyncBench::fullSync_data()
+{
+    QTest::addColumn<int>("latency");
+    QTest::addColumn<qint64>("bandwidth");
+    QTest::addColumn<bool>("compression");
+
+    QTest::newRow("loopback") << 0 << Q_INT64_C(0) << true;
+    QTest::newRow("uncompressed") << 0 << Q_INT64_C(0) << false;
+    QTest::newRow("50 ms latency") << 50 << Q_INT64_C(0) << true;
+    QTest::newRow("10 MiB/s") << 0 << Q_INT64_C(10485760) << true;
+}
+
+
+void SyncBench::fullSync()
+{
+    QFETCH(int, latency);
+    QFETCH(qint64, bandwidth);
+    QFETCH(bool, compression);
+
+    m_server.latency = latency;
+    m_server.bandwidth = bandwidth;
+    m_server.compression = compression;
+
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+
+    SQLiteStorage storage(dir.filePath(QStringLiteral("full.sqlite")));
+    QVERIFY(initStorage(&storage, waitTimeout));
+
+    BenchConfiguration config(m_server.port());
+
+    ResourceReport report;
+    bool ok = false;
+    QBENCHMARK_ONCE {
+        ok = sync(&config, &storage);
+    }
+    report.print();
+    printTraffic(m_server.stats());
+
+    QVERIFY(ok);
+}
+
+
+void SyncBench::deltaSync_data()
+{
+    QTest::addColumn<int>("churn");
+    QTest::addColumn<int>("added");
+
+    QTest::newRow("unchanged") << 0 << 0;
+    QTest::newRow("1% changed") << 1 << 0;
+    QTest::newRow("10% changed") << 10 << 0;
+    QTest::newRow("10% changed, 1% added") << 10 << 1;
+}
+
+
+void SyncBench::deltaSync()
+{
+    QFETCH(int, churn);
+    QFETCH(int, added);
+
+    const int existing = m_server.itemCount();
+    const QJsonDocument updated = m_data.updatedItemsReply(existing, existing * churn / 100, m_itemCount * added / 100, ++m_revision);
+    m_server.updateItems(updated.object().value(QStringLiteral("items")).toArray());
+
+    ResourceReport report;
+    bool ok = false;
+    QBENCHMARK_ONCE {
+        ok = sync(m_config.data(), m_storage.data());
+    }
+    report.print();
+    printTraffic(m_server.stats());
+
+    QVERIFY(ok);
+}
+
+
+void SyncBench::queueFlush_data()
+{
+    QTest::addColumn<int>("count");
+
+    QTest::newRow("100 actions") << 100;
+    QTest::newRow("1000 actions") << 1000;
+}
+
+
+void SyncBench::queueFlush()
+{
+    QFETCH(int, count);
+
+    QMap<FuotenEnums::QueueAction, IdList> actions;
+    for (int i = 1; i <= qMin(count, m_itemCount); ++i) {
+        actions[(i % 2) ? FuotenEnums::MarkAsRead : FuotenEnums::Star].append(i);
+    }
+    QVERIFY(m_storage->enqueueItems(actions));
+
+    ResourceReport report;
+    bool ok = false;
+    QBENCHMARK_ONCE {
+        ok = sync(m_config.data(), m_storage.data());
+    }
+    report.print();
+    printTraffic(m_server.stats());
+
+    QVERIFY(ok);
+}
+
+QTEST_GUILESS_MAIN(SyncBench)
+
+#include "syncbench.moc"
@@ -22,10 +22,6 @@ DEFINES += FUOTEN_LIBRARY
 
 DEFINES += VERSION_STRING=\"\\\"$${VERSION}\\\"\"
 
-CONFIG(release, debug|release) {
-    DEFINES += QT_NO_DEBUG_OUTPUT
-}
-
 contains(CONFIG, asan) {
     QMAKE_CXXFLAGS += "-fsanitize=address -fno-omit-frame-pointer -Wformat -Werror=format-security -Werror=array-bounds -g -ggdb"
     QMAKE_LFLAGS += "-fsanitize=address"
@@ -48,6 +44,8 @@ isEmpty(INSTALL_TRANSLATIONS_DIR): INSTALL_TRANSLATIONS_DIR = $$[QT_INSTALL_TRAN
         Fuoten/Storage/SQLiteStorage \
         Fuoten/Storage/abstractstorage.h \
         Fuoten/Storage/sqlitestorage.h \
+        Fuoten/Storage/StorageRequest \
+        Fuoten/Storage/storagerequest.h \
         Fuoten/Storage/AbstractStorage \
         Fuoten/error.h \
         Fuoten/fuoten_global.h \
@@ -98,6 +96,8 @@ isEmpty(INSTALL_TRANSLATIONS_DIR): INSTALL_TRANSLATIONS_DIR = $$[QT_INSTALL_TRAN
         Fuoten/API/DeleteFeed \
         Fuoten/API/DeleteFolder \
         Fuoten/API/Component \
+        Fuoten/API/AbstractItemsComponent \
+        Fuoten/API/abstractitemscomponent.h \
         Fuoten/API/createfolder.h \
         Fuoten/API/getfolders.h \
         Fuoten/API/GetFeeds \
@@ -107,6 +107,12 @@ isEmpty(INSTALL_TRANSLATIONS_DIR): INSTALL_TRANSLATIONS_DIR = $$[QT_INSTALL_TRAN
         Fuoten/baseitem.h \
         Fuoten/Article \
         Fuoten/article.h \
+        Fuoten/ArticleChangeSet \
+        Fuoten/articlechangeset.h \
+        Fuoten/ArticleCount \
+        Fuoten/articlecount.h \
+        Fuoten/ArticleRecord \
+        Fuoten/articlerecord.h \
         Fuoten/Models/abstractarticlemodel.h \
         Fuoten/Models/AbstractArticleModel \
         Fuoten/API/GetItems \
@@ -144,7 +150,9 @@ isEmpty(INSTALL_TRANSLATIONS_DIR): INSTALL_TRANSLATIONS_DIR = $$[QT_INSTALL_TRAN
         Fuoten/Helpers/abstractnotificator.h \
         Fuoten/Helpers/AbstractNotificator \
         Fuoten/Helpers/WipeManager \
-        Fuoten/Helpers/wipemanager.h
+        Fuoten/Helpers/wipemanager.h \
+        Fuoten/Helpers/ArticleActionCoalescer \
+        Fuoten/Helpers/articleactioncoalescer.h
 
     basePath = $${dirname(PWD)}
     for(header, INSTALL_HEADERS) {
@@ -217,6 +225,9 @@ HEADERS += \
     Fuoten/API/getserverstatus_p.h \
     Fuoten/API/getwipestatus.h \
     Fuoten/API/getwipestatus_p.h \
+    Fuoten/API/itemsstreamreader_p.h \
+    Fuoten/API/abstractitemscomponent.h \
+    Fuoten/API/abstractitemscomponent_p.h \
     Fuoten/API/loginflowv2.h \
     Fuoten/API/loginflowv2_p.h \
     Fuoten/API/postwipesuccess.h \
@@ -226,8 +237,10 @@ HEADERS += \
     Fuoten/fuoten_global.h \
     Fuoten/error.h \
     Fuoten/error_p.h \
+    Fuoten/logging_p.h \
     Fuoten/API/component.h \
     Fuoten/API/component_p.h \
+    Fuoten/API/networksession_p.h \
     Fuoten/API/getversion.h \
     Fuoten/API/getversion_p.h \
     Fuoten/API/getstatus.h \
@@ -247,6 +260,9 @@ HEADERS += \
     Fuoten/Storage/abstractstorage_p.h \
     Fuoten/Storage/sqlitestorage.h \
     Fuoten/Storage/sqlitestorage_p.h \
+    Fuoten/Storage/sqlitestatementcache_p.h \
+    Fuoten/Storage/sqliteconnectionpool_p.h \
+    Fuoten/Storage/storagerequest.h \
     Fuoten/Models/basemodel_p.h \
     Fuoten/Models/basemodel.h \
     Fuoten/Models/abstractfoldermodel.h \
@@ -288,6 +304,9 @@ HEADERS += \
     Fuoten/API/markfeedread_p.h \
     Fuoten/article_p.h \
     Fuoten/article.h \
+    Fuoten/articlechangeset.h \
+    Fuoten/articlecount.h \
+    Fuoten/articlerecord.h \
     Fuoten/Models/abstractarticlemodel.h \
     Fuoten/Models/abstractarticlemodel_p.h \
     Fuoten/API/getitems_p.h \
@@ -310,18 +329,23 @@ HEADERS += \
     Fuoten/API/markallitemsread_p.h \
     Fuoten/Helpers/abstractnamfactory.h \
     Fuoten/Helpers/abstractnotificator.h \
-    Fuoten/Helpers/abstractnotificator_p.h
+    Fuoten/Helpers/abstractnotificator_p.h \
+    Fuoten/Helpers/articleactioncoalescer.h \
+    Fuoten/Helpers/articleactioncoalescer_p.h
 
 SOURCES += \
     Fuoten/API/converttoapppassword.cpp \
     Fuoten/API/deleteapppassword.cpp \
     Fuoten/API/getserverstatus.cpp \
     Fuoten/API/getwipestatus.cpp \
+    Fuoten/API/itemsstreamreader.cpp \
+    Fuoten/API/abstractitemscomponent.cpp \
     Fuoten/API/loginflowv2.cpp \
     Fuoten/API/postwipesuccess.cpp \
     Fuoten/Helpers/wipemanager.cpp \
     Fuoten/error.cpp \
     Fuoten/API/component.cpp \
+    Fuoten/API/networksession.cpp \
     Fuoten/API/getversion.cpp \
     Fuoten/API/getstatus.cpp \
     Fuoten/API/getuser.cpp \
@@ -331,6 +355,9 @@ SOURCES += \
     Fuoten/API/getfolders.cpp \
     Fuoten/Helpers/synchronizer.cpp \
     Fuoten/Storage/sqlitestorage.cpp \
+    Fuoten/Storage/sqlitestatementcache.cpp \
+    Fuoten/Storage/sqliteconnectionpool.cpp \
+    Fuoten/Storage/storagerequest.cpp \
     Fuoten/Models/basemodel.cpp \
     Fuoten/Models/abstractfoldermodel.cpp \
     Fuoten/Models/folderlistmodel.cpp \
@@ -364,7 +391,9 @@ SOURCES += \
     Fuoten/API/markallitemsread.cpp \
     Fuoten/Helpers/abstractnamfactory.cpp \
     Fuoten/Helpers/abstractnotificator.cpp \
-    Fuoten/fuoten.cpp
+    Fuoten/Helpers/articleactioncoalescer.cpp \
+    Fuoten/fuoten.cpp \
+    Fuoten/logging.cpp
 
 DISTFILES += \
     fuoten.pc.in \
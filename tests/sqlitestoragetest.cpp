@@ -0,0 +1,403 @@
+/*
+ * SPDX-FileCopyrightText: (C) 2016-2022 Matthias Fehring <https://www.huessenbergnetz.de>
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#include "syntheticdata.h"
+#include "storagehelpers.h"
+#include <Fuoten/Helpers/AbstractConfiguration>
+#include <Fuoten/Storage/SQLiteStorage>
+#include <Fuoten/Storage/sqlitestorage_p.h>
+#include <QtTest>
+#include <QTemporaryDir>
+#include <QSignalSpy>
+#include <QSqlDatabase>
+#include <QSqlQuery>
+#include <QRegularExpression>
+
+using namespace Fuoten;
+
+namespace {
+
+constexpr int waitTimeout = 60000;
+
+/*
+ * Configuration that only provides the item deletion settings.
+ */
+class TestConfiguration : public AbstractConfiguration
+{
+public:
+    QString getUsername() const override { return QString(); }
+    QString getPassword() const override { return QString(); }
+    QString getHost() const override { return QString(); }
+    QString getInstallPath() const override { return QString(); }
+    bool isAccountValid() const override { return false; }
+    FuotenEnums::ItemDeletionStrategy getPerFeedDeletionStrategy(qint64 feedId) const override { Q_UNUSED(feedId) return strategy; }
+    quint16 getPerFeedDeletionValue(qint64 feedId) const override { Q_UNUSED(feedId) return value; }
+
+    FuotenEnums::ItemDeletionStrategy strategy = FuotenEnums::NoItemDeletion;
+    quint16 value = 0;
+
+protected:
+    void setIsAccountValid(bool nIsAccountValid) override { Q_UNUSED(nIsAccountValid) }
+};
+
+/*
+ * Returns the result of the single value query \a sql on the database at \a dbpath,
+ * using a separate connection to see the committed state.
+ */
+qint64 queryValue(const QString &dbpath, const QString &sql)
+{
+    const QString connection = QStringLiteral("sqlitestoragetest");
+    qint64 value = -1;
+    {
+        QSqlDatabase db = QSqlDatabase::addDatabase(QStringLiteral("QSQLITE"), connection);
+        db.setDatabaseName(dbpath);
+        if (db.open()) {
+            QSqlQuery q(db);
+            if (q.exec(sql) && q.next()) {
+                value = q.value(0).toLongLong();
+            }
+        }
+    }
+    QSqlDatabase::removeDatabase(connection);
+    return value;
+}
+
+/*
+ * Returns the number of feeds and folders in the database at \a dbpath whose unread
+ * counter does not match the unread items they contain.
+ */
+qint64 unreadCountMismatches(const QString &dbpath)
+{
+    return queryValue(dbpath, QStringLiteral("SELECT COUNT(*) FROM feeds fe WHERE fe.unreadCount != (SELECT COUNT(*) FROM items WHERE feedId = fe.id AND unread = 1)"))
+            + queryValue(dbpath, QStringLiteral("SELECT COUNT(*) FROM folders fo WHERE fo.unreadCount != IFNULL((SELECT SUM(unreadCount) FROM feeds WHERE folderId = fo.id), 0)"));
+}
+
+/*
+ * Returns the details of the query plan of \a query on the database at \a dbpath. The statistics
+ * are gathered before, like PRAGMA optimize does it on the start of the storage.
+ */
+QStringList queryPlan(const QString &dbpath, const SQLiteQuery &query)
+{
+    const QString connection = QStringLiteral("sqlitestoragetest");
+    QStringList plan;
+    {
+        QSqlDatabase db = QSqlDatabase::addDatabase(QStringLiteral("QSQLITE"), connection);
+        db.setDatabaseName(dbpath);
+        if (db.open()) {
+            QSqlQuery q(db);
+            if (q.exec(QStringLiteral("ANALYZE")) && q.prepare(QStringLiteral("EXPLAIN QUERY PLAN ") + query.sql)) {
+                for (const QVariant &value : query.values) {
+                    q.addBindValue(value);
+                }
+                if (q.exec()) {
+                    while (q.next()) {
+                        plan.append(q.value(3).toString());
+                    }
+                }
+            }
+        }
+    }
+    QSqlDatabase::removeDatabase(connection);
+    return plan;
+}
+
+}
+
+class SQLiteStorageTest : public QObject
+{
+    Q_OBJECT
+private Q_SLOTS:
+    void retention_data();
+    void retention();
+
+    void batchedUnreadCounts();
+
+    void repeatedActions();
+
+    void bodyUpdates_data();
+    void bodyUpdates();
+
+    void queryPlans_data();
+    void queryPlans();
+};
+
+
+void SQLiteStorageTest::retention_data()
+{
+    QTest::addColumn<int>("strategy");
+    QTest::addColumn<int>("value");
+    QTest::addColumn<int>("starredPercent");
+
+    QTest::newRow("by count") << static_cast<int>(FuotenEnums::DeleteItemsByCount) << 10 << 0;
+    QTest::newRow("by count with starred") << static_cast<int>(FuotenEnums::DeleteItemsByCount) << 10 << 20;
+    QTest::newRow("by count above item count") << static_cast<int>(FuotenEnums::DeleteItemsByCount) << 1000 << 0;
+    QTest::newRow("by time") << static_cast<int>(FuotenEnums::DeleteItemsByTime) << 1 << 20;
+}
+
+
+void SQLiteStorageTest::retention()
+{
+    QFETCH(int, strategy);
+    QFETCH(int, value);
+    QFETCH(int, starredPercent);
+
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString dbpath = dir.filePath(QStringLiteral("retention.sqlite"));
+
+    TestConfiguration config;
+    config.strategy = static_cast<FuotenEnums::ItemDeletionStrategy>(strategy);
+    config.value = static_cast<quint16>(value);
+
+    const int itemCount = 200;
+    SyntheticData data;
+    data.folderCount = 2;
+    data.feedCount = 4;
+    data.starredPercent = starredPercent;
+
+    {
+        SQLiteStorage storage(dbpath);
+        storage.setConfiguration(&config);
+        QVERIFY(initStorage(&storage));
+        QVERIFY(ingestStructure(&storage, data));
+        QVERIFY(ingest(&storage, data.itemsReply(itemCount)));
+    }
+
+    if (config.strategy == FuotenEnums::DeleteItemsByCount) {
+        // every feed keeps its most recent non-starred items, starred items are never removed
+        const qint64 perFeed = qMin<qint64>(value, itemCount / data.feedCount);
+        QCOMPARE(queryValue(dbpath, QStringLiteral("SELECT MAX(c) FROM (SELECT COUNT(*) AS c FROM items WHERE starred = 0 GROUP BY feedId)")), perFeed);
+        QCOMPARE(queryValue(dbpath, QStringLiteral("SELECT MIN(c) FROM (SELECT COUNT(*) AS c FROM items WHERE starred = 0 GROUP BY feedId)")), perFeed);
+        QCOMPARE(queryValue(dbpath, QStringLiteral("SELECT COUNT(*) FROM items i WHERE starred = 0 AND (SELECT COUNT(*) FROM items n WHERE n.feedId = i.feedId AND n.starred = 0 AND n.id > i.id) >= %1").arg(value)), Q_INT64_C(0));
+    } else {
+        // the synthetic items are all older than a day
+        QCOMPARE(queryValue(dbpath, QStringLiteral("SELECT COUNT(*) FROM items WHERE starred = 0")), Q_INT64_C(0));
+    }
+
+    // the unread counters have to match the remaining items
+    QCOMPARE(unreadCountMismatches(dbpath), Q_INT64_C(0));
+}
+
+
+
+void SQLiteStorageTest::batchedUnreadCounts()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString dbpath = dir.filePath(QStringLiteral("batches.sqlite"));
+
+    SyntheticData data;
+    data.folderCount = 2;
+    data.feedCount = 4;
+
+    SQLiteStorage storage(dbpath);
+    QVERIFY(initStorage(&storage));
+    QVERIFY(ingestStructure(&storage, data));
+
+    // the counters of a batch are committed together with its items, so they are
+    // consistent before the last batch arrives
+    storage.itemsBatchRequested(data.items(100, 1), false);
+    QTRY_COMPARE_WITH_TIMEOUT(queryValue(dbpath, QStringLiteral("SELECT COUNT(*) FROM items")), Q_INT64_C(100), waitTimeout);
+    QCOMPARE(unreadCountMismatches(dbpath), Q_INT64_C(0));
+
+    // updated items change the unread state of some of the already stored ones
+    storage.itemsBatchRequested(data.items(100, 51, 1), false);
+    QTRY_COMPARE_WITH_TIMEOUT(queryValue(dbpath, QStringLiteral("SELECT COUNT(*) FROM items")), Q_INT64_C(150), waitTimeout);
+    QCOMPARE(unreadCountMismatches(dbpath), Q_INT64_C(0));
+
+    // the deltas of the previous batches must not be applied again by the last one
+    QSignalSpy spy(&storage, &AbstractStorage::requestedItems);
+    storage.itemsBatchRequested(data.items(50, 151), true);
+    QVERIFY(waitFor(spy));
+    QCOMPARE(queryValue(dbpath, QStringLiteral("SELECT COUNT(*) FROM items")), Q_INT64_C(200));
+    QCOMPARE(unreadCountMismatches(dbpath), Q_INT64_C(0));
+}
+
+
+
+void SQLiteStorageTest::repeatedActions()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString dbpath = dir.filePath(QStringLiteral("actions.sqlite"));
+
+    SyntheticData data;
+    data.folderCount = 2;
+    data.feedCount = 4;
+
+    SQLiteStorage storage(dbpath);
+    QVERIFY(initStorage(&storage));
+    QVERIFY(ingestStructure(&storage, data));
+    QVERIFY(ingest(&storage, data.itemsReply(100)));
+
+    // applying the same state twice, like a server reply for an item that has already
+    // been changed locally, must only change the counters once
+    for (int i = 0; i < 2; ++i) {
+        storage.itemMarked(1, true);
+        storage.itemMarked(2, false);
+    }
+    QCOMPARE(unreadCountMismatches(dbpath), Q_INT64_C(0));
+    QCOMPARE(static_cast<qint64>(storage.totalUnread()), queryValue(dbpath, QStringLiteral("SELECT COUNT(*) FROM items WHERE unread = 1")));
+
+    for (int i = 0; i < 2; ++i) {
+        QVERIFY(storage.enqueueItems(FuotenEnums::MarkAsRead, IdList({3, 4, 5})));
+        QVERIFY(storage.enqueueItems(FuotenEnums::Star, IdList({3, 4, 5})));
+    }
+    QCOMPARE(unreadCountMismatches(dbpath), Q_INT64_C(0));
+    QCOMPARE(static_cast<qint64>(storage.totalUnread()), queryValue(dbpath, QStringLiteral("SELECT COUNT(*) FROM items WHERE unread = 1")));
+    QCOMPARE(static_cast<qint64>(storage.starred()), queryValue(dbpath, QStringLiteral("SELECT COUNT(*) FROM items WHERE starred = 1")));
+}
+
+
+
+void SQLiteStorageTest::bodyUpdates_data()
+{
+    QTest::addColumn<bool>("storedFingerprint");
+    QTest::addColumn<bool>("updatedFingerprint");
+    QTest::addColumn<bool>("bodyChanged");
+
+    QTest::newRow("without fingerprints") << false << false << true;
+    QTest::newRow("fingerprint removed") << true << false << true;
+    QTest::newRow("fingerprint added") << false << true << true;
+    QTest::newRow("fingerprint changed") << true << true << true;
+    QTest::newRow("fingerprint unchanged") << true << true << false;
+}
+
+
+void SQLiteStorageTest::bodyUpdates()
+{
+    QFETCH(bool, storedFingerprint);
+    QFETCH(bool, updatedFingerprint);
+    QFETCH(bool, bodyChanged);
+
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString dbpath = dir.filePath(QStringLiteral("bodies.sqlite"));
+
+    SyntheticData data;
+    data.folderCount = 1;
+    data.feedCount = 1;
+
+    SQLiteStorage storage(dbpath);
+    QVERIFY(initStorage(&storage));
+    QVERIFY(ingestStructure(&storage, data));
+
+    QJsonObject item = data.items(1).first().toObject();
+    if (!storedFingerprint) {
+        item.remove(QStringLiteral("fingerprint"));
+    }
+    QVERIFY(ingest(&storage, QJsonDocument(QJsonObject({{QStringLiteral("items"), QJsonArray({item})}}))));
+    const QString storedBody = storage.getArticleBody(1);
+
+    // only the body changes, an unchanged fingerprint is trusted to mean the same content
+    const QString updatedBody = QStringLiteral("<p>Updated body</p>");
+    item.insert(QStringLiteral("body"), updatedBody);
+    item.insert(QStringLiteral("lastModified"), item.value(QStringLiteral("lastModified")).toInt() + 60);
+    if (!updatedFingerprint) {
+        item.remove(QStringLiteral("fingerprint"));
+    } else if (bodyChanged) {
+        item.insert(QStringLiteral("fingerprint"), QStringLiteral("updated"));
+    }
+    QVERIFY(ingest(&storage, QJsonDocument(QJsonObject({{QStringLiteral("items"), QJsonArray({item})}}))));
+
+    if (bodyChanged) {
+        QCOMPARE(storage.getArticleBody(1), updatedBody);
+        QCOMPARE(queryValue(dbpath, QStringLiteral("SELECT COUNT(*) FROM items WHERE id = 1 AND excerpt = 'Updated body'")), Q_INT64_C(1));
+    } else {
+        QCOMPARE(storage.getArticleBody(1), storedBody);
+    }
+}
+
+
+void SQLiteStorageTest::queryPlans_data()
+{
+    QTest::addColumn<bool>("counts");
+    QTest::addColumn<int>("grouping");
+    QTest::addColumn<int>("parentIdType");
+    QTest::addColumn<bool>("unreadOnly");
+    QTest::addColumn<bool>("starredOnly");
+    QTest::addColumn<bool>("queuedOnly");
+    QTest::addColumn<QString>("index");
+
+    // an empty index only requires that the items are read through any of the items indexes
+    QTest::newRow("articles") << false << 0 << static_cast<int>(FuotenEnums::All) << false << false << false << QStringLiteral("items_pubdate_index");
+    QTest::newRow("articles of feed") << false << 0 << static_cast<int>(FuotenEnums::Feed) << false << false << false << QStringLiteral("items_feed_pubdate_index");
+    QTest::newRow("articles of folder") << false << 0 << static_cast<int>(FuotenEnums::Folder) << false << false << false << QString();
+    QTest::newRow("unread articles") << false << 0 << static_cast<int>(FuotenEnums::All) << true << false << false << QStringLiteral("items_unread_pubdate_index");
+    QTest::newRow("unread articles of feed") << false << 0 << static_cast<int>(FuotenEnums::Feed) << true << false << false << QStringLiteral("items_unread_feed_index");
+    QTest::newRow("starred articles") << false << 0 << static_cast<int>(FuotenEnums::All) << false << true << false << QStringLiteral("items_starred_pubdate_index");
+    QTest::newRow("queued articles") << false << 0 << static_cast<int>(FuotenEnums::All) << false << false << true << QString();
+    QTest::newRow("counts") << true << static_cast<int>(FuotenEnums::NoGrouping) << static_cast<int>(FuotenEnums::All) << false << false << false << QString();
+    QTest::newRow("counts per feed") << true << static_cast<int>(FuotenEnums::GroupByFeed) << static_cast<int>(FuotenEnums::All) << false << false << false << QString();
+    QTest::newRow("unread counts per feed") << true << static_cast<int>(FuotenEnums::GroupByFeed) << static_cast<int>(FuotenEnums::All) << true << false << false << QString();
+    QTest::newRow("counts of folder per feed") << true << static_cast<int>(FuotenEnums::GroupByFeed) << static_cast<int>(FuotenEnums::Folder) << false << false << false << QString();
+    QTest::newRow("starred counts") << true << static_cast<int>(FuotenEnums::NoGrouping) << static_cast<int>(FuotenEnums::All) << false << true << false << QString();
+}
+
+
+void SQLiteStorageTest::queryPlans()
+{
+    QFETCH(bool, counts);
+    QFETCH(int, grouping);
+    QFETCH(int, parentIdType);
+    QFETCH(bool, unreadOnly);
+    QFETCH(bool, starredOnly);
+    QFETCH(bool, queuedOnly);
+    QFETCH(QString, index);
+
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString dbpath = dir.filePath(QStringLiteral("plans.sqlite"));
+
+    // the planner decides by the statistics, so the database needs a realistic amount of items
+    SyntheticData data;
+    {
+        SQLiteStorage storage(dbpath);
+        QVERIFY(initStorage(&storage));
+        QVERIFY(ingestStructure(&storage, data));
+        QVERIFY(ingest(&storage, data.itemsReply(2000)));
+    }
+
+    QueryArgs args;
+    args.sortingRole = FuotenEnums::Time;
+    args.sortOrder = Qt::DescendingOrder;
+    args.limit = 50;
+    args.unreadOnly = unreadOnly;
+    args.starredOnly = starredOnly;
+    args.queuedOnly = queuedOnly;
+    if (parentIdType != FuotenEnums::All) {
+        args.parentId = 1;
+        args.parentIdType = static_cast<FuotenEnums::Type>(parentIdType);
+    }
+
+    const SQLiteQuery query = counts ? SQLiteStoragePrivate::articleCountsQuery(args, static_cast<FuotenEnums::ArticleGrouping>(grouping), false) : SQLiteStoragePrivate::articlesQuery(args, false);
+    const QStringList plan = queryPlan(dbpath, query);
+    QVERIFY2(!plan.isEmpty(), qUtf8Printable(query.sql));
+
+    // depending on the SQLite version the items table is printed with or without its name
+    const QRegularExpression itemsStep(QStringLiteral("^(SCAN|SEARCH) (TABLE items AS )?it( |$)"));
+    const QRegularExpression indexName(QStringLiteral("INDEX (items_\\w+)"));
+
+    QStringList usedIndexes;
+    for (const QString &step : plan) {
+        if (!itemsStep.match(step).hasMatch()) {
+            continue;
+        }
+        QVERIFY2(!step.startsWith(QLatin1String("SCAN")) || step.contains(QLatin1String("INDEX")), qUtf8Printable(QStringLiteral("Full scan of the items table: ") + plan.join(QStringLiteral("; "))));
+        const QRegularExpressionMatch match = indexName.match(step);
+        if (match.hasMatch()) {
+            usedIndexes.append(match.captured(1));
+        }
+    }
+
+    QVERIFY2(!usedIndexes.isEmpty(), qUtf8Printable(plan.join(QStringLiteral("; "))));
+    if (!index.isEmpty()) {
+        QVERIFY2(usedIndexes.contains(index), qUtf8Printable(plan.join(QStringLiteral("; "))));
+    }
+}
+
+QTEST_GUILESS_MAIN(SQLiteStorageTest)
+
+#include "sqlitestoragetest.moc"
@@ -0,0 +1,188 @@
+/*
+ * SPDX-FileCopyrightText: (C) 2016-2022 Matthias Fehring <https://www.huessenbergnetz.de>
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#include "syntheticdata.h"
+#include <Fuoten/Storage/SQLiteStorage>
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QDir>
+#include <QFile>
+#include <QEventLoop>
+#include <QTimer>
+#include <cstdio>
+#include <cstdlib>
+
+using namespace Fuoten;
+
+namespace {
+
+bool writeJson(const QDir &dir, const QString &fileName, const QJsonDocument &json, QJsonDocument::JsonFormat format)
+{
+    QFile f(dir.absoluteFilePath(fileName));
+    if (!f.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        std::fprintf(stderr, "Failed to open %s: %s\n", qUtf8Printable(f.fileName()), qUtf8Printable(f.errorString()));
+        return false;
+    }
+
+    f.write(json.toJson(format));
+    std::printf("Wrote %s\n", qUtf8Printable(f.fileName()));
+    return true;
+}
+
+/*
+ * Runs the event loop until the signal of sender has been emitted or the timeout is reached.
+ */
+template<typename Object, typename Signal>
+bool waitFor(Object *sender, Signal signal)
+{
+    QEventLoop loop;
+    bool emitted = false;
+    QObject::connect(sender, signal, &loop, [&loop, &emitted](){
+        emitted = true;
+        loop.quit();
+    });
+    QTimer::singleShot(3600000, &loop, &QEventLoop::quit);
+    loop.exec();
+    return emitted;
+}
+
+bool fillDatabase(const QString &dbpath, const QJsonDocument &folders, const QJsonDocument &feeds, const QJsonDocument &items)
+{
+    SQLiteStorage storage(dbpath);
+
+    storage.init();
+    if (!storage.ready() && !waitFor(&storage, &AbstractStorage::readyChanged)) {
+        std::fprintf(stderr, "Failed to initialize the database %s\n", qUtf8Printable(dbpath));
+        return false;
+    }
+
+    QTimer::singleShot(0, &storage, [&storage, &folders](){ storage.foldersRequested(folders); });
+    if (!waitFor(&storage, &AbstractStorage::requestedFolders)) {
+        return false;
+    }
+
+    QTimer::singleShot(0, &storage, [&storage, &feeds](){ storage.feedsRequested(feeds); });
+    if (!waitFor(&storage, &AbstractStorage::requestedFeeds)) {
+        return false;
+    }
+
+    QTimer::singleShot(0, &storage, [&storage, &items](){ storage.itemsRequested(items); });
+    if (!waitFor(&storage, &AbstractStorage::requestedItems)) {
+        return false;
+    }
+
+    std::printf("Filled %s\n", qUtf8Printable(dbpath));
+    return true;
+}
+
+int intOption(const QCommandLineParser &parser, const QCommandLineOption &option, int min, int max)
+{
+    bool ok = false;
+    const int value = parser.value(option).toInt(&ok);
+    if (!ok || value < min || value > max) {
+        std::fprintf(stderr, "Invalid value for --%s: %s\n", qUtf8Printable(option.names().constFirst()), qUtf8Printable(parser.value(option)));
+        std::exit(1);
+    }
+    return value;
+}
+
+}
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+    app.setApplicationName(QStringLiteral("fuoten-datagen"));
+    app.setApplicationVersion(QStringLiteral(FUOTEN_VERSION));
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription(QStringLiteral("Creates reproducible synthetic Nextcloud News API replies. "
+                                                    "The output directory will contain folders.json, feeds.json, items.json and items-updated.json "
+                                                    "in the format of the replies of the /folders, /feeds, /items and /items/updated routes."));
+    parser.addHelpOption();
+    parser.addVersionOption();
+
+    const QCommandLineOption seedOpt(QStringLiteral("seed"), QStringLiteral("Seed of the random number generator."), QStringLiteral("number"), QStringLiteral("4711"));
+    const QCommandLineOption foldersOpt(QStringLiteral("folders"), QStringLiteral("Number of folders."), QStringLiteral("count"), QStringLiteral("10"));
+    const QCommandLineOption feedsOpt(QStringLiteral("feeds"), QStringLiteral("Number of feeds."), QStringLiteral("count"), QStringLiteral("100"));
+    const QCommandLineOption itemsOpt(QStringLiteral("items"), QStringLiteral("Number of items."), QStringLiteral("count"), QStringLiteral("10000"));
+    const QCommandLineOption bodyWordsOpt(QStringLiteral("body-words"), QStringLiteral("Average number of words in an item body."), QStringLiteral("count"), QStringLiteral("120"));
+    const QCommandLineOption bodyDistOpt(QStringLiteral("body-distribution"), QStringLiteral("Distribution of the body sizes: fixed, uniform or lognormal."), QStringLiteral("name"), QStringLiteral("lognormal"));
+    const QCommandLineOption unreadOpt(QStringLiteral("unread"), QStringLiteral("Percentage of unread items."), QStringLiteral("percent"), QStringLiteral("70"));
+    const QCommandLineOption starredOpt(QStringLiteral("starred"), QStringLiteral("Percentage of starred items."), QStringLiteral("percent"), QStringLiteral("5"));
+    const QCommandLineOption churnOpt(QStringLiteral("churn"), QStringLiteral("Percentage of the items that are changed in items-updated.json."), QStringLiteral("percent"), QStringLiteral("10"));
+    const QCommandLineOption newItemsOpt(QStringLiteral("new-items"), QStringLiteral("Number of new items in items-updated.json."), QStringLiteral("count"), QStringLiteral("100"));
+    const QCommandLineOption indentedOpt(QStringLiteral("indented"), QStringLiteral("Write indented instead of compact JSON."));
+    const QCommandLineOption sqliteOpt(QStringLiteral("sqlite"), QStringLiteral("Additionally store folders, feeds and items into the SQLite database at path using SQLiteStorage."), QStringLiteral("path"));
+
+    parser.addOptions({seedOpt, foldersOpt, feedsOpt, itemsOpt, bodyWordsOpt, bodyDistOpt, unreadOpt, starredOpt, churnOpt, newItemsOpt, indentedOpt, sqliteOpt});
+    parser.addPositionalArgument(QStringLiteral("directory"), QStringLiteral("Output directory, will be created if it does not exist."));
+
+    parser.process(app);
+
+    const QStringList args = parser.positionalArguments();
+    if (args.size() != 1) {
+        parser.showHelp(1);
+    }
+
+    bool ok = false;
+    const quint32 seed = parser.value(seedOpt).toUInt(&ok);
+    if (!ok) {
+        std::fprintf(stderr, "Invalid value for --seed: %s\n", qUtf8Printable(parser.value(seedOpt)));
+        return 1;
+    }
+
+    SyntheticData data(seed);
+    data.folderCount = intOption(parser, foldersOpt, 0, 100000);
+    data.feedCount = intOption(parser, feedsOpt, 1, 1000000);
+    data.bodyWords = intOption(parser, bodyWordsOpt, 1, 1000000);
+    data.unreadPercent = intOption(parser, unreadOpt, 0, 100);
+    data.starredPercent = intOption(parser, starredOpt, 0, 100);
+
+    const QString dist = parser.value(bodyDistOpt);
+    if (dist == QLatin1String("fixed")) {
+        data.bodyDistribution = SyntheticData::Fixed;
+    } else if (dist == QLatin1String("uniform")) {
+        data.bodyDistribution = SyntheticData::Uniform;
+    } else if (dist == QLatin1String("lognormal")) {
+        data.bodyDistribution = SyntheticData::LogNormal;
+    } else {
+        std::fprintf(stderr, "Invalid value for --body-distribution: %s\n", qUtf8Printable(dist));
+        return 1;
+    }
+
+    const int itemCount = intOption(parser, itemsOpt, 0, 100000000);
+    const int churn = intOption(parser, churnOpt, 0, 100);
+    const int newItems = intOption(parser, newItemsOpt, 0, 100000000);
+    const QJsonDocument::JsonFormat format = parser.isSet(indentedOpt) ? QJsonDocument::Indented : QJsonDocument::Compact;
+
+    QDir dir(args.constFirst());
+    if (!dir.mkpath(QStringLiteral("."))) {
+        std::fprintf(stderr, "Failed to create output directory %s\n", qUtf8Printable(dir.absolutePath()));
+        return 1;
+    }
+
+    const QJsonDocument folders = data.folders();
+    const QJsonDocument feeds = data.feeds();
+    const QJsonDocument items = data.itemsReply(itemCount);
+
+    if (!writeJson(dir, QStringLiteral("folders.json"), folders, format) ||
+            !writeJson(dir, QStringLiteral("feeds.json"), feeds, format) ||
+            !writeJson(dir, QStringLiteral("items.json"), items, format)) {
+        return 1;
+    }
+
+    const QJsonDocument updated = data.updatedItemsReply(itemCount, static_cast<int>(static_cast<qint64>(itemCount) * churn / 100), newItems);
+    if (!writeJson(dir, QStringLiteral("items-updated.json"), updated, format)) {
+        return 1;
+    }
+
+    if (parser.isSet(sqliteOpt)) {
+        if (!fillDatabase(parser.value(sqliteOpt), folders, feeds, items)) {
+            return 1;
+        }
+    }
+
+    return 0;
+}
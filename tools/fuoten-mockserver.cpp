@@ -0,0 +1,135 @@
+/*
+ * SPDX-FileCopyrightText: (C) 2016-2022 Matthias Fehring <https://www.huessenbergnetz.de>
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#include "mocknewsserver.h"
+#include "syntheticdata.h"
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QHostAddress>
+#include <QDir>
+#include <QFile>
+#include <cstdio>
+#include <cstdlib>
+
+namespace {
+
+QJsonDocument readJson(const QDir &dir, const QString &fileName, bool required = true)
+{
+    QFile f(dir.absoluteFilePath(fileName));
+    if (!f.exists() && !required) {
+        return QJsonDocument();
+    }
+
+    if (!f.open(QIODevice::ReadOnly)) {
+        std::fprintf(stderr, "Failed to open %s: %s\n", qUtf8Printable(f.fileName()), qUtf8Printable(f.errorString()));
+        std::exit(1);
+    }
+
+    QJsonParseError error;
+    const QJsonDocument json = QJsonDocument::fromJson(f.readAll(), &error);
+    if (error.error != QJsonParseError::NoError) {
+        std::fprintf(stderr, "Failed to parse %s: %s\n", qUtf8Printable(f.fileName()), qUtf8Printable(error.errorString()));
+        std::exit(1);
+    }
+
+    return json;
+}
+
+int intOption(const QCommandLineParser &parser, const QCommandLineOption &option, int min, int max)
+{
+    bool ok = false;
+    const int value = parser.value(option).toInt(&ok);
+    if (!ok || value < min || value > max) {
+        std::fprintf(stderr, "Invalid value for --%s: %s\n", qUtf8Printable(option.names().constFirst()), qUtf8Printable(parser.value(option)));
+        std::exit(1);
+    }
+    return value;
+}
+
+}
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+    app.setApplicationName(QStringLiteral("fuoten-mockserver"));
+    app.setApplicationVersion(QStringLiteral(FUOTEN_VERSION));
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription(QStringLiteral("Local stand-in for a Nextcloud server with the News App to benchmark synchronization. "
+                                                    "Serves folders.json, feeds.json and items.json from the given directory as created by fuoten-datagen, "
+                                                    "or synthetic data if no directory is given. POST /mock/update applies items-updated.json, "
+                                                    "GET /mock/stats returns the request statistics and POST /mock/reset resets them."));
+    parser.addHelpOption();
+    parser.addVersionOption();
+
+    const QCommandLineOption addressOpt(QStringLiteral("address"), QStringLiteral("Address to listen on."), QStringLiteral("address"), QStringLiteral("127.0.0.1"));
+    const QCommandLineOption portOpt(QStringLiteral("port"), QStringLiteral("Port to listen on, 0 selects a free port."), QStringLiteral("port"), QStringLiteral("8080"));
+    const QCommandLineOption latencyOpt(QStringLiteral("latency"), QStringLiteral("Milliseconds to wait before a reply is sent."), QStringLiteral("ms"), QStringLiteral("0"));
+    const QCommandLineOption bandwidthOpt(QStringLiteral("bandwidth"), QStringLiteral("Bytes per second a connection can send, 0 for unlimited."), QStringLiteral("bytes"), QStringLiteral("0"));
+    const QCommandLineOption errorRateOpt(QStringLiteral("error-rate"), QStringLiteral("Percentage of API requests that fail."), QStringLiteral("percent"), QStringLiteral("0"));
+    const QCommandLineOption errorStatusOpt(QStringLiteral("error-status"), QStringLiteral("HTTP status code of failed requests, 0 closes the connection."), QStringLiteral("code"), QStringLiteral("500"));
+    const QCommandLineOption noCompressionOpt(QStringLiteral("no-compression"), QStringLiteral("Do not compress replies, even if the client accepts gzip or deflate."));
+    const QCommandLineOption userOpt(QStringLiteral("user"), QStringLiteral("Require basic authentication with this user name."), QStringLiteral("name"));
+    const QCommandLineOption passwordOpt(QStringLiteral("password"), QStringLiteral("Password for the basic authentication."), QStringLiteral("password"));
+    const QCommandLineOption seedOpt(QStringLiteral("seed"), QStringLiteral("Seed of the synthetic data and the error injection."), QStringLiteral("number"), QStringLiteral("4711"));
+    const QCommandLineOption feedsOpt(QStringLiteral("feeds"), QStringLiteral("Number of synthetic feeds."), QStringLiteral("count"), QStringLiteral("100"));
+    const QCommandLineOption itemsOpt(QStringLiteral("items"), QStringLiteral("Number of synthetic items."), QStringLiteral("count"), QStringLiteral("10000"));
+    const QCommandLineOption churnOpt(QStringLiteral("churn"), QStringLiteral("Percentage of the synthetic items changed by /mock/update."), QStringLiteral("percent"), QStringLiteral("10"));
+
+    parser.addOptions({addressOpt, portOpt, latencyOpt, bandwidthOpt, errorRateOpt, errorStatusOpt, noCompressionOpt, userOpt, passwordOpt, seedOpt, feedsOpt, itemsOpt, churnOpt});
+    parser.addPositionalArgument(QStringLiteral("directory"), QStringLiteral("Directory with the output of fuoten-datagen."), QStringLiteral("[directory]"));
+
+    parser.process(app);
+
+    const QStringList args = parser.positionalArguments();
+    if (args.size() > 1) {
+        parser.showHelp(1);
+    }
+
+    bool ok = false;
+    const quint32 seed = parser.value(seedOpt).toUInt(&ok);
+    if (!ok) {
+        std::fprintf(stderr, "Invalid value for --seed: %s\n", qUtf8Printable(parser.value(seedOpt)));
+        return 1;
+    }
+
+    const QHostAddress address(parser.value(addressOpt));
+    if (address.isNull()) {
+        std::fprintf(stderr, "Invalid value for --address: %s\n", qUtf8Printable(parser.value(addressOpt)));
+        return 1;
+    }
+
+    MockNewsServer server(seed);
+    server.latency = intOption(parser, latencyOpt, 0, 600000);
+    server.bandwidth = intOption(parser, bandwidthOpt, 0, 2147483647);
+    server.errorRate = intOption(parser, errorRateOpt, 0, 100);
+    server.errorStatus = intOption(parser, errorStatusOpt, 0, 599);
+    server.compression = !parser.isSet(noCompressionOpt);
+    server.username = parser.value(userOpt);
+    server.password = parser.value(passwordOpt);
+
+    if (args.isEmpty()) {
+        SyntheticData data(seed);
+        data.feedCount = intOption(parser, feedsOpt, 1, 1000000);
+        const int itemCount = intOption(parser, itemsOpt, 0, 100000000);
+        const int churn = intOption(parser, churnOpt, 0, 100);
+        server.setData(data.folders(), data.feeds(), data.itemsReply(itemCount));
+        server.pendingUpdates = data.updatedItemsReply(itemCount, static_cast<int>(static_cast<qint64>(itemCount) * churn / 100), 0).object().value(QStringLiteral("items")).toArray();
+    } else {
+        const QDir dir(args.constFirst());
+        server.setData(readJson(dir, QStringLiteral("folders.json")), readJson(dir, QStringLiteral("feeds.json")), readJson(dir, QStringLiteral("items.json")));
+        server.pendingUpdates = readJson(dir, QStringLiteral("items-updated.json"), false).object().value(QStringLiteral("items")).toArray();
+    }
+
+    if (!server.listen(address, static_cast<quint16>(intOption(parser, portOpt, 0, 65535)))) {
+        std::fprintf(stderr, "Failed to listen on %s: %s\n", qUtf8Printable(address.toString()), qUtf8Printable(server.errorString()));
+        return 1;
+    }
+
+    std::printf("Serving %i items on %s port %u\n", server.itemCount(), qUtf8Printable(address.toString()), static_cast<unsigned int>(server.port()));
+    std::fflush(stdout);
+
+    return app.exec();
+}
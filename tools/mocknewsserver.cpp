@@ -0,0 +1,726 @@
+/*
+ * SPDX-FileCopyrightText: (C) 2016-2022 Matthias Fehring <https://www.huessenbergnetz.de>
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#include "mocknewsserver.h"
+#include <QTcpSocket>
+#include <QTimer>
+#include <QUrl>
+#include <QDateTime>
+#include <QStringList>
+
+namespace {
+
+const QString apiBase = QStringLiteral("/index.php/apps/news/api/v1-2");
+
+// maximum size of the request line and headers
+const int maxHeaderSize = 64 * 1024;
+
+// interval of the bandwidth throttle in milliseconds
+const int throttleInterval = 10;
+
+qint64 now()
+{
+    return QDateTime::currentMSecsSinceEpoch() / 1000;
+}
+
+quint32 crc32(const QByteArray &data)
+{
+    static quint32 table[256] = {0};
+    if (table[1] == 0) {
+        for (quint32 i = 0; i < 256; ++i) {
+            quint32 c = i;
+            for (int k = 0; k < 8; ++k) {
+                c = (c & 1) ? (0xedb88320u ^ (c >> 1)) : (c >> 1);
+            }
+            table[i] = c;
+        }
+    }
+
+    quint32 crc = 0xffffffffu;
+    const uchar *p = reinterpret_cast<const uchar *>(data.constData());
+    for (int i = 0, size = data.size(); i < size; ++i) {
+        crc = table[(crc ^ p[i]) & 0xff] ^ (crc >> 8);
+    }
+    return crc ^ 0xffffffffu;
+}
+
+void appendLittleEndian(QByteArray &ba, quint32 value)
+{
+    for (int i = 0; i < 4; ++i) {
+        ba.append(static_cast<char>((value >> (8 * i)) & 0xff));
+    }
+}
+
+}
+
+MockNewsServer::MockNewsServer(quint32 seed) :
+    m_rng(seed)
+{
+    QObject::connect(&m_server, &QTcpServer::newConnection, &m_server, [this](){ newConnection(); });
+}
+
+MockNewsServer::~MockNewsServer()
+{
+    m_server.close();
+
+    // the sockets would otherwise emit disconnected while this object is already gone
+    const QList<QTcpSocket*> sockets = m_connections.keys();
+    for (QTcpSocket *socket : sockets) {
+        QObject::disconnect(socket, nullptr, nullptr, nullptr);
+        delete socket;
+    }
+}
+
+bool MockNewsServer::listen(const QHostAddress &address, quint16 port)
+{
+    return m_server.listen(address, port);
+}
+
+quint16 MockNewsServer::port() const
+{
+    return m_server.serverPort();
+}
+
+QString MockNewsServer::errorString() const
+{
+    return m_server.errorString();
+}
+
+void MockNewsServer::setData(const QJsonDocument &folders, const QJsonDocument &feeds, const QJsonDocument &items)
+{
+    const QJsonArray feedArray = feeds.object().value(QStringLiteral("feeds")).toArray();
+    m_folders = folders.object().value(QStringLiteral("folders")).toArray();
+    m_feeds = feedArray;
+
+    m_feedFolders.clear();
+    for (const QJsonValue &v : feedArray) {
+        const QJsonObject feed = v.toObject();
+        m_feedFolders.insert(static_cast<qint64>(feed.value(QStringLiteral("id")).toDouble()), static_cast<qint64>(feed.value(QStringLiteral("folderId")).toDouble()));
+    }
+
+    m_items.clear();
+    m_guidHashes.clear();
+    const QJsonArray itemArray = items.object().value(QStringLiteral("items")).toArray();
+    for (const QJsonValue &v : itemArray) {
+        const QJsonObject item = v.toObject();
+        const qint64 id = static_cast<qint64>(item.value(QStringLiteral("id")).toDouble());
+        m_items.insert(id, item);
+        m_guidHashes.insert(item.value(QStringLiteral("guidHash")).toString(), id);
+    }
+
+    changed();
+}
+
+void MockNewsServer::updateItems(const QJsonArray &items)
+{
+    const qint64 lastModified = now();
+    for (const QJsonValue &v : items) {
+        QJsonObject item = v.toObject();
+        const qint64 id = static_cast<qint64>(item.value(QStringLiteral("id")).toDouble());
+        item.insert(QStringLiteral("lastModified"), lastModified);
+        m_items.insert(id, item);
+        m_guidHashes.insert(item.value(QStringLiteral("guidHash")).toString(), id);
+    }
+
+    changed();
+}
+
+QJsonObject MockNewsServer::item(qint64 id) const
+{
+    return m_items.value(id);
+}
+
+int MockNewsServer::itemCount() const
+{
+    return m_items.size();
+}
+
+MockNewsServer::Stats MockNewsServer::stats() const
+{
+    return m_stats;
+}
+
+void MockNewsServer::resetStats()
+{
+    m_stats = Stats();
+}
+
+void MockNewsServer::newConnection()
+{
+    while (QTcpSocket *socket = m_server.nextPendingConnection()) {
+        m_connections.insert(socket, Connection());
+        QObject::connect(socket, &QTcpSocket::readyRead, socket, [this, socket](){ readRequests(socket); });
+        QObject::connect(socket, &QTcpSocket::disconnected, socket, [this, socket](){
+            m_connections.remove(socket);
+            socket->deleteLater();
+        });
+    }
+}
+
+void MockNewsServer::readRequests(QTcpSocket *socket)
+{
+    m_connections[socket].in.append(socket->readAll());
+
+    for (;;) {
+        // an aborted reply removes the connection
+        if (!m_connections.contains(socket)) {
+            return;
+        }
+
+        Connection &c = m_connections[socket];
+        if (c.closeAfterWrite) {
+            c.in.clear();
+            return;
+        }
+
+        const int headerEnd = c.in.indexOf("\r\n\r\n");
+        if (headerEnd < 0) {
+            if (c.in.size() > maxHeaderSize) {
+                socket->abort();
+            }
+            return;
+        }
+
+        const QList<QByteArray> lines = c.in.left(headerEnd).split('\n');
+        const QList<QByteArray> requestLine = lines.constFirst().trimmed().split(' ');
+        if (requestLine.size() != 3) {
+            socket->abort();
+            return;
+        }
+
+        Request request;
+        request.method = requestLine.at(0);
+
+        const QByteArray target = requestLine.at(1);
+        const int queryStart = target.indexOf('?');
+        request.path = QUrl::fromPercentEncoding(queryStart < 0 ? target : target.left(queryStart));
+        if (queryStart >= 0) {
+            request.query.setQuery(QString::fromLatin1(target.mid(queryStart + 1)));
+        }
+
+        for (int i = 1; i < lines.size(); ++i) {
+            const QByteArray &line = lines.at(i);
+            const int colon = line.indexOf(':');
+            if (colon > 0) {
+                request.headers.insert(line.left(colon).trimmed().toLower(), line.mid(colon + 1).trimmed());
+            }
+        }
+
+        // HTTP/1.1 connections are persistent unless the client asks for the opposite
+        const QByteArray connection = request.headers.value(QByteArrayLiteral("connection")).toLower();
+        if (requestLine.at(2) == "HTTP/1.0" ? connection != "keep-alive" : connection == "close") {
+            request.headers.insert(QByteArrayLiteral("connection"), QByteArrayLiteral("close"));
+        }
+
+        const int contentLength = request.headers.value(QByteArrayLiteral("content-length"), QByteArrayLiteral("0")).toInt();
+        const int requestSize = headerEnd + 4 + contentLength;
+        if (c.in.size() < requestSize) {
+            return;
+        }
+
+        request.body = c.in.mid(headerEnd + 4, contentLength);
+        c.in.remove(0, requestSize);
+
+        handleRequest(socket, request);
+    }
+}
+
+void MockNewsServer::handleRequest(QTcpSocket *socket, const Request &request)
+{
+    ++m_stats.requests;
+
+    // the request is applied immediately, only the reply is delayed
+    const Reply reply = route(request);
+    const QByteArray acceptEncoding = request.headers.value(QByteArrayLiteral("accept-encoding"));
+    const bool close = (request.headers.value(QByteArrayLiteral("connection")) == "close");
+
+    Connection &c = m_connections[socket];
+    ++c.pendingReplies;
+    if (close) {
+        c.closeAfterWrite = true;
+    }
+
+    if (latency > 0) {
+        QTimer::singleShot(latency, socket, [this, socket, reply, acceptEncoding, close](){ writeReply(socket, reply, acceptEncoding, close); });
+    } else {
+        writeReply(socket, reply, acceptEncoding, close);
+    }
+}
+
+void MockNewsServer::writeReply(QTcpSocket *socket, const Reply &reply, const QByteArray &acceptEncoding, bool close)
+{
+    if (!m_connections.contains(socket)) {
+        return;
+    }
+
+    Connection &c = m_connections[socket];
+    --c.pendingReplies;
+
+    if (reply.status == 0) {
+        socket->abort();
+        return;
+    }
+
+    QByteArray body = reply.body;
+    QByteArray encoding;
+    if (compression && !body.isEmpty()) {
+        if (acceptEncoding.contains("gzip")) {
+            encoding = QByteArrayLiteral("gzip");
+        } else if (acceptEncoding.contains("deflate")) {
+            encoding = QByteArrayLiteral("deflate");
+        }
+    }
+
+    if (!encoding.isEmpty()) {
+        const QString key = QString::fromLatin1(encoding) + QLatin1Char(' ') + reply.cacheKey;
+        auto it = reply.cacheKey.isEmpty() ? m_compressedCache.end() : m_compressedCache.find(key);
+        if (it != m_compressedCache.end()) {
+            body = it.value();
+        } else {
+            body = (encoding == "gzip") ? gzip(reply.body) : deflate(reply.body);
+            if (!reply.cacheKey.isEmpty()) {
+                m_compressedCache.insert(key, body);
+            }
+        }
+    }
+
+    QByteArray header;
+    header.reserve(256);
+    header.append("HTTP/1.1 ").append(QByteArray::number(reply.status)).append(' ').append(reasonPhrase(reply.status)).append("\r\n");
+    header.append("Content-Type: application/json; charset=utf-8\r\n");
+    header.append("Content-Length: ").append(QByteArray::number(body.size())).append("\r\n");
+    if (!encoding.isEmpty()) {
+        header.append("Content-Encoding: ").append(encoding).append("\r\n");
+    }
+    header.append(close ? "Connection: close\r\n" : "Connection: keep-alive\r\n");
+    header.append("\r\n");
+
+    m_stats.bytesSent += header.size() + body.size();
+    m_stats.uncompressedBytes += reply.body.size();
+
+    c.out.append(header).append(body);
+
+    if (!c.throttle || !c.throttle->isActive()) {
+        sendPending(socket);
+    }
+}
+
+void MockNewsServer::sendPending(QTcpSocket *socket)
+{
+    if (!m_connections.contains(socket)) {
+        return;
+    }
+
+    Connection &c = m_connections[socket];
+
+    if (bandwidth <= 0) {
+        socket->write(c.out);
+        c.out.clear();
+    } else {
+        if (!c.throttle) {
+            c.throttle = new QTimer(socket);
+            c.throttle->setInterval(throttleInterval);
+            QObject::connect(c.throttle, &QTimer::timeout, socket, [this, socket](){ sendPending(socket); });
+        }
+
+        const int chunk = static_cast<int>(qBound<qint64>(1, bandwidth * throttleInterval / 1000, c.out.size()));
+        socket->write(c.out.constData(), chunk);
+        c.out.remove(0, chunk);
+
+        if (c.out.isEmpty()) {
+            c.throttle->stop();
+        } else if (!c.throttle->isActive()) {
+            c.throttle->start();
+        }
+    }
+
+    if (c.out.isEmpty() && c.closeAfterWrite && c.pendingReplies == 0) {
+        socket->disconnectFromHost();
+    }
+}
+
+MockNewsServer::Reply MockNewsServer::route(const Request &request)
+{
+    if (request.path.endsWith(QLatin1String("/status.php"))) {
+        QJsonObject status;
+        status.insert(QStringLiteral("installed"), true);
+        status.insert(QStringLiteral("maintenance"), false);
+        status.insert(QStringLiteral("needsDbUpgrade"), false);
+        status.insert(QStringLiteral("version"), QStringLiteral("25.0.0.0"));
+        status.insert(QStringLiteral("versionstring"), QStringLiteral("25.0.0"));
+        status.insert(QStringLiteral("edition"), QString());
+        status.insert(QStringLiteral("productname"), QStringLiteral("Nextcloud"));
+        status.insert(QStringLiteral("extendedSupport"), false);
+        return jsonReply(QJsonDocument(status));
+    }
+
+    if (request.path.startsWith(QLatin1String("/mock/"))) {
+        return controlRoute(request);
+    }
+
+    const int apiStart = request.path.indexOf(apiBase);
+    if (apiStart < 0) {
+        return messageReply(404, QStringLiteral("Not found"));
+    }
+
+    if (!username.isEmpty()) {
+        const QByteArray expected = QByteArrayLiteral("Basic ") + QString(username + QLatin1Char(':') + password).toUtf8().toBase64();
+        if (request.headers.value(QByteArrayLiteral("authorization")) != expected) {
+            return messageReply(401, QStringLiteral("Unauthorized"));
+        }
+    }
+
+    if (errorRate > 0 && std::uniform_int_distribution<int>(0, 99)(m_rng) < errorRate) {
+        ++m_stats.errors;
+        return messageReply(errorStatus, QStringLiteral("Injected error"));
+    }
+
+    return apiRoute(request, request.path.mid(apiStart + apiBase.size()));
+}
+
+MockNewsServer::Reply MockNewsServer::apiRoute(const Request &request, const QString &route)
+{
+    if (request.method == "GET") {
+        if (route == QLatin1String("/folders")) {
+            return cached(route, [this](){
+                QJsonObject o;
+                o.insert(QStringLiteral("folders"), m_folders);
+                return QJsonDocument(o);
+            });
+        }
+
+        if (route == QLatin1String("/feeds")) {
+            return cached(route, [this](){ return feedsReply(); });
+        }
+
+        if (route == QLatin1String("/items")) {
+            return cached(route + QLatin1Char('?') + request.query.toString(), [this, &request](){ return itemsReply(request.query); });
+        }
+
+        if (route == QLatin1String("/items/updated")) {
+            return cached(route + QLatin1Char('?') + request.query.toString(), [this, &request](){ return updatedItemsReply(request.query); });
+        }
+
+        if (route == QLatin1String("/version")) {
+            QJsonObject o;
+            o.insert(QStringLiteral("version"), QStringLiteral("18.0.0"));
+            return jsonReply(QJsonDocument(o));
+        }
+
+        if (route == QLatin1String("/user")) {
+            QJsonObject o;
+            o.insert(QStringLiteral("userId"), username.isEmpty() ? QStringLiteral("fuoten") : username);
+            o.insert(QStringLiteral("displayName"), QStringLiteral("Fuoten Mock"));
+            o.insert(QStringLiteral("lastLoginTimestamp"), now());
+            o.insert(QStringLiteral("avatar"), QJsonValue());
+            return jsonReply(QJsonDocument(o));
+        }
+
+        return messageReply(404, QStringLiteral("Not found"));
+    }
+
+    if (request.method != "PUT" && request.method != "POST") {
+        return messageReply(405, QStringLiteral("Method not allowed"));
+    }
+
+    const QJsonObject payload = QJsonDocument::fromJson(request.body).object();
+    const QStringList parts = route.mid(1).split(QLatin1Char('/'));
+
+    if (parts.size() == 3 && parts.at(0) == QLatin1String("items") && parts.at(2) == QLatin1String("multiple")) {
+        const QJsonArray items = payload.value(QStringLiteral("items")).toArray();
+        const QString action = parts.at(1);
+        if (action == QLatin1String("read") || action == QLatin1String("unread")) {
+            markItems(items, action == QLatin1String("unread"));
+            return Reply();
+        }
+        if (action == QLatin1String("star") || action == QLatin1String("unstar")) {
+            starItems(items, action == QLatin1String("star"));
+            return Reply();
+        }
+    }
+
+    if (parts.size() == 3 && parts.at(0) == QLatin1String("items") && (parts.at(2) == QLatin1String("read") || parts.at(2) == QLatin1String("unread"))) {
+        if (!setItemValue(parts.at(1).toLongLong(), QStringLiteral("unread"), parts.at(2) == QLatin1String("unread"))) {
+            return messageReply(404, QStringLiteral("Item not found"));
+        }
+        changed();
+        return Reply();
+    }
+
+    if (parts.size() == 4 && parts.at(0) == QLatin1String("items") && (parts.at(3) == QLatin1String("star") || parts.at(3) == QLatin1String("unstar"))) {
+        if (!setItemValue(m_guidHashes.value(parts.at(2), -1), QStringLiteral("starred"), parts.at(3) == QLatin1String("star"))) {
+            return messageReply(404, QStringLiteral("Item not found"));
+        }
+        changed();
+        return Reply();
+    }
+
+    const qint64 newestItemId = static_cast<qint64>(payload.value(QStringLiteral("newestItemId")).toDouble());
+
+    if (parts.size() == 2 && parts.at(0) == QLatin1String("items") && parts.at(1) == QLatin1String("read")) {
+        markRead(3, 0, newestItemId);
+        return Reply();
+    }
+
+    if (parts.size() == 3 && parts.at(2) == QLatin1String("read") && (parts.at(0) == QLatin1String("feeds") || parts.at(0) == QLatin1String("folders"))) {
+        markRead(parts.at(0) == QLatin1String("feeds") ? 0 : 1, parts.at(1).toLongLong(), newestItemId);
+        return Reply();
+    }
+
+    return messageReply(404, QStringLiteral("Not found"));
+}
+
+MockNewsServer::Reply MockNewsServer::controlRoute(const Request &request)
+{
+    if (request.path == QLatin1String("/mock/stats")) {
+        QJsonObject o;
+        o.insert(QStringLiteral("requests"), m_stats.requests);
+        o.insert(QStringLiteral("errors"), m_stats.errors);
+        o.insert(QStringLiteral("bytesSent"), m_stats.bytesSent);
+        o.insert(QStringLiteral("uncompressedBytes"), m_stats.uncompressedBytes);
+        o.insert(QStringLiteral("items"), m_items.size());
+        return jsonReply(QJsonDocument(o));
+    }
+
+    if (request.method != "POST") {
+        return messageReply(405, QStringLiteral("Method not allowed"));
+    }
+
+    if (request.path == QLatin1String("/mock/reset")) {
+        resetStats();
+        return Reply();
+    }
+
+    if (request.path == QLatin1String("/mock/update")) {
+        updateItems(pendingUpdates);
+        return Reply();
+    }
+
+    return messageReply(404, QStringLiteral("Not found"));
+}
+
+MockNewsServer::Reply MockNewsServer::cached(const QString &key, const std::function<QJsonDocument ()> &create)
+{
+    Reply reply;
+    reply.cacheKey = key;
+
+    auto it = m_cache.constFind(key);
+    if (it != m_cache.constEnd()) {
+        reply.body = it.value();
+    } else {
+        reply.body = create().toJson(QJsonDocument::Compact);
+        m_cache.insert(key, reply.body);
+    }
+
+    return reply;
+}
+
+QJsonDocument MockNewsServer::feedsReply() const
+{
+    QHash<qint64, int> unreadCounts;
+    int starredCount = 0;
+    for (const QJsonObject &item : m_items) {
+        if (item.value(QStringLiteral("unread")).toBool()) {
+            unreadCounts[static_cast<qint64>(item.value(QStringLiteral("feedId")).toDouble())]++;
+        }
+        if (item.value(QStringLiteral("starred")).toBool()) {
+            ++starredCount;
+        }
+    }
+
+    QJsonArray feeds;
+    for (const QJsonValue &v : m_feeds) {
+        QJsonObject feed = v.toObject();
+        feed.insert(QStringLiteral("unreadCount"), unreadCounts.value(static_cast<qint64>(feed.value(QStringLiteral("id")).toDouble())));
+        feeds.append(feed);
+    }
+
+    QJsonObject o;
+    o.insert(QStringLiteral("feeds"), feeds);
+    o.insert(QStringLiteral("starredCount"), starredCount);
+    o.insert(QStringLiteral("newestItemId"), m_items.isEmpty() ? 0 : m_items.lastKey());
+    return QJsonDocument(o);
+}
+
+QJsonDocument MockNewsServer::itemsReply(const QUrlQuery &query) const
+{
+    const int batchSize = query.hasQueryItem(QStringLiteral("batchSize")) ? query.queryItemValue(QStringLiteral("batchSize")).toInt() : -1;
+    const qint64 offset = query.queryItemValue(QStringLiteral("offset")).toLongLong();
+    const int type = query.hasQueryItem(QStringLiteral("type")) ? query.queryItemValue(QStringLiteral("type")).toInt() : 3;
+    const qint64 id = query.queryItemValue(QStringLiteral("id")).toLongLong();
+    const bool getRead = query.queryItemValue(QStringLiteral("getRead")) != QLatin1String("false");
+    const bool oldestFirst = query.queryItemValue(QStringLiteral("oldestFirst")) == QLatin1String("true");
+
+    QJsonArray items;
+
+    auto add = [&](const QJsonObject &item) {
+        if ((getRead || item.value(QStringLiteral("unread")).toBool()) && matchesType(item, type, id)) {
+            items.append(item);
+        }
+        return batchSize <= 0 || items.size() < batchSize;
+    };
+
+    // like the News App, the offset is an item ID, not a position
+    if (oldestFirst) {
+        for (auto it = m_items.upperBound(offset), end = m_items.cend(); it != end; ++it) {
+            if (!add(it.value())) {
+                break;
+            }
+        }
+    } else {
+        auto it = offset > 0 ? m_items.lowerBound(offset) : m_items.cend();
+        while (it != m_items.cbegin()) {
+            --it;
+            if (!add(it.value())) {
+                break;
+            }
+        }
+    }
+
+    QJsonObject o;
+    o.insert(QStringLiteral("items"), items);
+    return QJsonDocument(o);
+}
+
+QJsonDocument MockNewsServer::updatedItemsReply(const QUrlQuery &query) const
+{
+    const qint64 lastModified = query.queryItemValue(QStringLiteral("lastModified")).toLongLong();
+    const int type = query.hasQueryItem(QStringLiteral("type")) ? query.queryItemValue(QStringLiteral("type")).toInt() : 3;
+    const qint64 id = query.queryItemValue(QStringLiteral("id")).toLongLong();
+
+    QJsonArray items;
+    for (const QJsonObject &item : m_items) {
+        if (static_cast<qint64>(item.value(QStringLiteral("lastModified")).toDouble()) >= lastModified && matchesType(item, type, id)) {
+            items.append(item);
+        }
+    }
+
+    QJsonObject o;
+    o.insert(QStringLiteral("items"), items);
+    return QJsonDocument(o);
+}
+
+bool MockNewsServer::matchesType(const QJsonObject &item, int type, qint64 id) const
+{
+    switch (type) {
+    case 0:
+        return static_cast<qint64>(item.value(QStringLiteral("feedId")).toDouble()) == id;
+    case 1:
+        return m_feedFolders.value(static_cast<qint64>(item.value(QStringLiteral("feedId")).toDouble())) == id;
+    case 2:
+        return item.value(QStringLiteral("starred")).toBool();
+    default:
+        return true;
+    }
+}
+
+void MockNewsServer::markItems(const QJsonArray &ids, bool unread)
+{
+    for (const QJsonValue &v : ids) {
+        setItemValue(static_cast<qint64>(v.toDouble()), QStringLiteral("unread"), unread);
+    }
+    changed();
+}
+
+void MockNewsServer::starItems(const QJsonArray &items, bool starred)
+{
+    for (const QJsonValue &v : items) {
+        setItemValue(m_guidHashes.value(v.toObject().value(QStringLiteral("guidHash")).toString(), -1), QStringLiteral("starred"), starred);
+    }
+    changed();
+}
+
+void MockNewsServer::markRead(int type, qint64 id, qint64 newestItemId)
+{
+    for (auto it = m_items.begin(), end = m_items.upperBound(newestItemId); it != end; ++it) {
+        if (matchesType(it.value(), type, id)) {
+            setItemValue(it.key(), QStringLiteral("unread"), false);
+        }
+    }
+    changed();
+}
+
+bool MockNewsServer::setItemValue(qint64 id, const QString &key, bool value)
+{
+    auto it = m_items.find(id);
+    if (it == m_items.end()) {
+        return false;
+    }
+
+    if (it.value().value(key).toBool() != value) {
+        it.value().insert(key, value);
+        it.value().insert(QStringLiteral("lastModified"), now());
+    }
+
+    return true;
+}
+
+void MockNewsServer::changed()
+{
+    m_cache.clear();
+    m_compressedCache.clear();
+}
+
+MockNewsServer::Reply MockNewsServer::jsonReply(const QJsonDocument &json, int status)
+{
+    Reply reply;
+    reply.status = status;
+    reply.body = json.toJson(QJsonDocument::Compact);
+    return reply;
+}
+
+MockNewsServer::Reply MockNewsServer::messageReply(int status, const QString &message)
+{
+    if (status == 0) {
+        Reply reply;
+        reply.status = 0;
+        return reply;
+    }
+
+    QJsonObject o;
+    o.insert(QStringLiteral("message"), message);
+    return jsonReply(QJsonDocument(o), status);
+}
+
+QByteArray MockNewsServer::gzip(const QByteArray &data)
+{
+    // qCompress() returns a four byte length, a two byte zlib header, the raw
+    // deflate stream and a four byte Adler-32 checksum, gzip only needs the stream
+    const QByteArray compressed = qCompress(data);
+
+    QByteArray ba;
+    ba.reserve(compressed.size() + 12);
+    static const char header[10] = {'\x1f', '\x8b', '\x08', 0, 0, 0, 0, 0, 0, '\xff'};
+    ba.append(header, sizeof(header));
+    ba.append(compressed.constData() + 6, compressed.size() - 10);
+    appendLittleEndian(ba, crc32(data));
+    appendLittleEndian(ba, static_cast<quint32>(data.size()));
+    return ba;
+}
+
+QByteArray MockNewsServer::deflate(const QByteArray &data)
+{
+    // the deflate content coding is a zlib stream
+    return qCompress(data).mid(4);
+}
+
+const char *MockNewsServer::reasonPhrase(int status)
+{
+    switch (status) {
+    case 200: return "OK";
+    case 400: return "Bad Request";
+    case 401: return "Unauthorized";
+    case 403: return "Forbidden";
+    case 404: return "Not Found";
+    case 405: return "Method Not Allowed";
+    case 409: return "Conflict";
+    case 429: return "Too Many Requests";
+    case 500: return "Internal Server Error";
+    case 502: return "Bad Gateway";
+    case 503: return "Service Unavailable";
+    case 504: return "Gateway Timeout";
+    default: return "Unknown";
+    }
+}
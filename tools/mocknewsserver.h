@@ -0,0 +1,179 @@
+/*
+ * SPDX-FileCopyrightText: (C) 2016-2022 Matthias Fehring <https://www.huessenbergnetz.de>
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#ifndef FUOTENMOCKNEWSSERVER_H
+#define FUOTENMOCKNEWSSERVER_H
+
+#include <QTcpServer>
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QJsonObject>
+#include <QHash>
+#include <QMap>
+#include <QUrlQuery>
+#include <functional>
+#include <random>
+
+class QTcpSocket;
+class QTimer;
+
+/*!
+ * \brief Local stand-in for a Nextcloud server with the News App, used to benchmark synchronization.
+ *
+ * Implements the routes of the News App API v1-2 that are used by the library on top of a
+ * minimal HTTP/1.1 server with keep-alive: /folders, /feeds, /items, /items/updated, the
+ * single and multiple read, unread, star and unstar routes, /items/read, /version and /user,
+ * as well as /status.php. Read and star state changes are applied to the served data and
+ * update the lastModified time of the items, so a following request of /items/updated will
+ * return them like a real server.
+ *
+ * Latency, bandwidth, error injection and compression can be configured through the public
+ * members. Random errors use a generator seeded by \a seed, so the same sequence of requests
+ * will always fail at the same positions.
+ *
+ * Some additional routes control the server from scripts: GET /mock/stats returns the request
+ * statistics, POST /mock/reset resets them and POST /mock/update applies pendingUpdates.
+ */
+class MockNewsServer
+{
+public:
+    explicit MockNewsServer(quint32 seed = 4711);
+    ~MockNewsServer();
+
+    int latency = 0;            /**< Milliseconds to wait before a reply is sent. */
+    qint64 bandwidth = 0;       /**< Bytes per second a connection can send, 0 for unlimited. */
+    int errorRate = 0;          /**< Percentage of API requests that are answered with errorStatus. */
+    int errorStatus = 500;      /**< HTTP status code of injected errors, 0 closes the connection without reply. */
+    bool compression = true;    /**< Compresses replies with gzip or deflate if the client accepts it. */
+    QString username;           /**< If not empty, requests have to use basic authentication with username and password. */
+    QString password;           /**< Password for the basic authentication. */
+    QJsonArray pendingUpdates;  /**< Items applied by updateItems() on a POST request to /mock/update. */
+
+    /*!
+     * \brief Request statistics, reset by resetStats().
+     */
+    struct Stats {
+        qint64 requests = 0;            /**< Number of handled requests. */
+        qint64 errors = 0;              /**< Number of injected errors. */
+        qint64 bytesSent = 0;           /**< Reply bytes including headers as sent over the wire. */
+        qint64 uncompressedBytes = 0;   /**< Reply body bytes before compression. */
+    };
+
+    /*!
+     * \brief Starts listening on \a address and \a port, a \a port of \c 0 selects a free port.
+     */
+    bool listen(const QHostAddress &address = QHostAddress::LocalHost, quint16 port = 0);
+
+    /*!
+     * \brief Returns the port the server is listening on.
+     */
+    quint16 port() const;
+
+    /*!
+     * \brief Returns the last error of the underlying QTcpServer.
+     */
+    QString errorString() const;
+
+    /*!
+     * \brief Replaces the served data by the replies of the folders, feeds and items routes.
+     */
+    void setData(const QJsonDocument &folders, const QJsonDocument &feeds, const QJsonDocument &items);
+
+    /*!
+     * \brief Adds or replaces \a items and sets their lastModified time to now.
+     *
+     * Use it with the reply of SyntheticData::updatedItemsReply() or items-updated.json of
+     * fuoten-datagen to simulate new and changed items for a delta synchronization.
+     */
+    void updateItems(const QJsonArray &items);
+
+    /*!
+     * \brief Returns the currently served item with \a id or an empty object.
+     */
+    QJsonObject item(qint64 id) const;
+
+    /*!
+     * \brief Returns the number of served items.
+     */
+    int itemCount() const;
+
+    /*!
+     * \brief Returns the request statistics.
+     */
+    Stats stats() const;
+
+    /*!
+     * \brief Resets the request statistics.
+     */
+    void resetStats();
+
+private:
+    Q_DISABLE_COPY(MockNewsServer)
+
+    struct Request {
+        QByteArray method;
+        QString path;
+        QUrlQuery query;
+        QHash<QByteArray, QByteArray> headers;
+        QByteArray body;
+    };
+
+    struct Reply {
+        int status = 200;
+        QByteArray body;
+        QString cacheKey;
+    };
+
+    struct Connection {
+        QByteArray in;
+        QByteArray out;
+        QTimer *throttle = nullptr;
+        int pendingReplies = 0;
+        bool closeAfterWrite = false;
+    };
+
+    void newConnection();
+    void readRequests(QTcpSocket *socket);
+    void handleRequest(QTcpSocket *socket, const Request &request);
+    void writeReply(QTcpSocket *socket, const Reply &reply, const QByteArray &acceptEncoding, bool close);
+    void sendPending(QTcpSocket *socket);
+    Reply route(const Request &request);
+    Reply apiRoute(const Request &request, const QString &route);
+    Reply controlRoute(const Request &request);
+    Reply cached(const QString &key, const std::function<QJsonDocument()> &create);
+
+    QJsonDocument feedsReply() const;
+    QJsonDocument itemsReply(const QUrlQuery &query) const;
+    QJsonDocument updatedItemsReply(const QUrlQuery &query) const;
+    bool matchesType(const QJsonObject &item, int type, qint64 id) const;
+    void markItems(const QJsonArray &ids, bool unread);
+    void starItems(const QJsonArray &items, bool starred);
+    void markRead(int type, qint64 id, qint64 newestItemId);
+    bool setItemValue(qint64 id, const QString &key, bool value);
+    void changed();
+
+    static Reply jsonReply(const QJsonDocument &json, int status = 200);
+    static Reply messageReply(int status, const QString &message);
+    static QByteArray gzip(const QByteArray &data);
+    static QByteArray deflate(const QByteArray &data);
+    static const char *reasonPhrase(int status);
+
+    QTcpServer m_server;
+    QHash<QTcpSocket*, Connection> m_connections;
+    std::mt19937 m_rng;
+    Stats m_stats;
+
+    QJsonArray m_folders;
+    QJsonArray m_feeds;
+    QHash<qint64, qint64> m_feedFolders;
+    QMap<qint64, QJsonObject> m_items;
+    QHash<QString, qint64> m_guidHashes;
+
+    // serialized and compressed replies of the read-only routes, dropped on every change
+    QHash<QString, QByteArray> m_cache;
+    QHash<QString, QByteArray> m_compressedCache;
+};
+
+#endif // FUOTENMOCKNEWSSERVER_H
@@ -0,0 +1,46 @@
+/*
+ * SPDX-FileCopyrightText: (C) 2016-2022 Matthias Fehring <https://www.huessenbergnetz.de>
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#include "storagehelpers.h"
+#include "syntheticdata.h"
+#include <Fuoten/Storage/AbstractStorage>
+#include <QSignalSpy>
+
+using namespace Fuoten;
+
+bool initStorage(AbstractStorage *storage, int timeout)
+{
+    QSignalSpy spy(storage, &AbstractStorage::readyChanged);
+    storage->init();
+    return storage->ready() || spy.wait(timeout);
+}
+
+
+bool waitFor(QSignalSpy &spy, int timeout)
+{
+    return !spy.isEmpty() || spy.wait(timeout);
+}
+
+
+bool ingest(AbstractStorage *storage, const QJsonDocument &items, int timeout)
+{
+    QSignalSpy spy(storage, &AbstractStorage::requestedItems);
+    storage->itemsRequested(items);
+    return waitFor(spy, timeout);
+}
+
+
+bool ingestStructure(AbstractStorage *storage, SyntheticData &data, int timeout)
+{
+    QSignalSpy foldersSpy(storage, &AbstractStorage::requestedFolders);
+    storage->foldersRequested(data.folders());
+    if (!waitFor(foldersSpy, timeout)) {
+        return false;
+    }
+
+    QSignalSpy feedsSpy(storage, &AbstractStorage::requestedFeeds);
+    storage->feedsRequested(data.feeds());
+    return waitFor(feedsSpy, timeout);
+}
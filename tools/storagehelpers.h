@@ -0,0 +1,38 @@
+/*
+ * SPDX-FileCopyrightText: (C) 2016-2022 Matthias Fehring <https://www.huessenbergnetz.de>
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#ifndef FUOTENSTORAGEHELPERS_H
+#define FUOTENSTORAGEHELPERS_H
+
+#include <QJsonDocument>
+
+class QSignalSpy;
+class SyntheticData;
+
+namespace Fuoten {
+class AbstractStorage;
+}
+
+/*!
+ * \brief Initializes the \a storage and waits up to \a timeout milliseconds until it is ready.
+ */
+bool initStorage(Fuoten::AbstractStorage *storage, int timeout = 60000);
+
+/*!
+ * \brief Returns \c true if the \a spy has already caught a signal or catches one within \a timeout milliseconds.
+ */
+bool waitFor(QSignalSpy &spy, int timeout = 60000);
+
+/*!
+ * \brief Hands the \a items reply to the \a storage and waits up to \a timeout milliseconds until they have been stored.
+ */
+bool ingest(Fuoten::AbstractStorage *storage, const QJsonDocument &items, int timeout = 60000);
+
+/*!
+ * \brief Hands the folders and feeds of \a data to the \a storage and waits up to \a timeout milliseconds for each until they have been stored.
+ */
+bool ingestStructure(Fuoten::AbstractStorage *storage, SyntheticData &data, int timeout = 60000);
+
+#endif // FUOTENSTORAGEHELPERS_H
@@ -0,0 +1,190 @@
+/*
+ * SPDX-FileCopyrightText: (C) 2016-2022 Matthias Fehring <https://www.huessenbergnetz.de>
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#include "syntheticdata.h"
+#include <QJsonObject>
+#include <QJsonValue>
+#include <QCryptographicHash>
+#include <QVector>
+#include <algorithm>
+#include <cmath>
+
+SyntheticData::SyntheticData(quint32 seed) :
+    m_rng(seed)
+{
+    m_dictionary = QStringLiteral("qt library news feed article storage query model sqlite network sync folder "
+                                  "release kernel desktop plasma kde nextcloud server update security patch "
+                                  "performance memory thread index search privacy mobile sailfish ubuntu linux "
+                                  "developer community conference sprint design window widget display font "
+                                  "network router cloud backup music video camera battery phone tablet").split(QLatin1Char(' '));
+}
+
+
+QJsonDocument SyntheticData::folders()
+{
+    QJsonArray folders;
+    for (int i = 1; i <= folderCount; ++i) {
+        QJsonObject folder;
+        folder.insert(QStringLiteral("id"), i);
+        folder.insert(QStringLiteral("name"), QStringLiteral("Folder %1").arg(i));
+        folders.append(folder);
+    }
+
+    QJsonObject o;
+    o.insert(QStringLiteral("folders"), folders);
+    return QJsonDocument(o);
+}
+
+
+QJsonDocument SyntheticData::feeds()
+{
+    QJsonArray feeds;
+    for (int i = 1; i <= feedCount; ++i) {
+        QJsonObject feed;
+        feed.insert(QStringLiteral("id"), i);
+        feed.insert(QStringLiteral("url"), QStringLiteral("https://feed%1.example.com/rss.xml").arg(i));
+        feed.insert(QStringLiteral("title"), QStringLiteral("Feed %1").arg(i));
+        feed.insert(QStringLiteral("faviconLink"), QStringLiteral("https://feed%1.example.com/favicon.ico").arg(i));
+        feed.insert(QStringLiteral("added"), 1500000000 + i);
+        feed.insert(QStringLiteral("folderId"), folderCount > 0 ? ((i - 1) % folderCount) + 1 : 0);
+        feed.insert(QStringLiteral("unreadCount"), 0);
+        feed.insert(QStringLiteral("ordering"), 0);
+        feed.insert(QStringLiteral("link"), QStringLiteral("https://feed%1.example.com").arg(i));
+        feed.insert(QStringLiteral("pinned"), false);
+        feed.insert(QStringLiteral("updateErrorCount"), 0);
+        feed.insert(QStringLiteral("lastUpdateError"), QJsonValue());
+        feeds.append(feed);
+    }
+
+    QJsonObject o;
+    o.insert(QStringLiteral("feeds"), feeds);
+    o.insert(QStringLiteral("starredCount"), 0);
+    o.insert(QStringLiteral("newestItemId"), 0);
+    return QJsonDocument(o);
+}
+
+
+QJsonArray SyntheticData::items(int count, qint64 firstId, int revision)
+{
+    QJsonArray items;
+
+    for (qint64 id = firstId; id < firstId + count; ++id) {
+        items.append(item(id, revision));
+    }
+
+    return items;
+}
+
+
+QJsonDocument SyntheticData::itemsReply(int count, qint64 firstId, int revision)
+{
+    QJsonObject o;
+    o.insert(QStringLiteral("items"), items(count, firstId, revision));
+    return QJsonDocument(o);
+}
+
+
+QJsonDocument SyntheticData::updatedItemsReply(int existingCount, int changedCount, int addedCount, int revision)
+{
+    QJsonArray items;
+
+    changedCount = qBound(0, changedCount, existingCount);
+
+    // partial Fisher-Yates shuffle to choose distinct items
+    QVector<qint64> ids(existingCount);
+    for (int i = 0; i < existingCount; ++i) {
+        ids[i] = i + 1;
+    }
+    for (int i = 0; i < changedCount; ++i) {
+        std::uniform_int_distribution<int> dist(i, existingCount - 1);
+        std::swap(ids[i], ids[dist(m_rng)]);
+    }
+    std::sort(ids.begin(), ids.begin() + changedCount);
+
+    for (int i = 0; i < changedCount; ++i) {
+        items.append(item(ids.at(i), revision));
+    }
+
+    for (qint64 id = existingCount + 1; id <= existingCount + addedCount; ++id) {
+        items.append(item(id, 0));
+    }
+
+    QJsonObject o;
+    o.insert(QStringLiteral("items"), items);
+    return QJsonDocument(o);
+}
+
+
+QJsonObject SyntheticData::item(qint64 id, int revision)
+{
+    const QString guid = QStringLiteral("https://example.com/article/%1").arg(id);
+    const int size = bodySize();
+    const QString body = QStringLiteral("<p>") + words(size / 2) + QStringLiteral("</p><p><b>") + words(size / 10) + QStringLiteral("</b> ") + words(size - size / 2 - size / 10) + QStringLiteral("</p>");
+
+    QJsonObject item;
+    item.insert(QStringLiteral("id"), id);
+    item.insert(QStringLiteral("guid"), guid);
+    item.insert(QStringLiteral("guidHash"), QString::fromLatin1(QCryptographicHash::hash(guid.toUtf8(), QCryptographicHash::Md5).toHex()));
+    item.insert(QStringLiteral("url"), guid);
+    item.insert(QStringLiteral("title"), words(8));
+    item.insert(QStringLiteral("author"), QStringLiteral("Author %1").arg(id % 50));
+    item.insert(QStringLiteral("pubDate"), 1500000000 + id * 60);
+    item.insert(QStringLiteral("body"), body);
+    item.insert(QStringLiteral("enclosureMime"), QJsonValue());
+    item.insert(QStringLiteral("enclosureLink"), QJsonValue());
+    item.insert(QStringLiteral("mediaThumbnail"), QJsonValue());
+    item.insert(QStringLiteral("mediaDescription"), QJsonValue());
+    item.insert(QStringLiteral("feedId"), feedCount > 0 ? ((id - 1) % feedCount) + 1 : 0);
+    item.insert(QStringLiteral("unread"), percent() < unreadPercent);
+    item.insert(QStringLiteral("starred"), percent() < starredPercent);
+    item.insert(QStringLiteral("rtl"), false);
+    item.insert(QStringLiteral("lastModified"), 1500000000 + id * 60 + revision);
+    item.insert(QStringLiteral("fingerprint"), QString::fromLatin1(QCryptographicHash::hash((guid + QString::number(revision)).toUtf8(), QCryptographicHash::Md5).toHex()));
+
+    return item;
+}
+
+
+int SyntheticData::bodySize()
+{
+    switch (bodyDistribution) {
+    case Uniform:
+    {
+        std::uniform_int_distribution<int> dist(bodyWords / 4, bodyWords * 7 / 4);
+        return dist(m_rng);
+    }
+    case LogNormal:
+    {
+        // sigma 0.8 with the mean of the distribution matching bodyWords
+        const double sigma = 0.8;
+        std::lognormal_distribution<double> dist(std::log(qMax(1, bodyWords)) - sigma * sigma / 2.0, sigma);
+        return qBound(1, static_cast<int>(dist(m_rng)), bodyWords * 50);
+    }
+    case Fixed:
+    default:
+        return bodyWords;
+    }
+}
+
+
+QString SyntheticData::words(int count)
+{
+    std::uniform_int_distribution<int> dist(0, m_dictionary.size() - 1);
+
+    QStringList ws;
+    ws.reserve(count);
+    for (int i = 0; i < count; ++i) {
+        ws.append(m_dictionary.at(dist(m_rng)));
+    }
+
+    return ws.join(QLatin1Char(' '));
+}
+
+
+int SyntheticData::percent()
+{
+    std::uniform_int_distribution<int> dist(0, 99);
+    return dist(m_rng);
+}
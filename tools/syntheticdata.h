@@ -0,0 +1,85 @@
+/*
+ * SPDX-FileCopyrightText: (C) 2016-2022 Matthias Fehring <https://www.huessenbergnetz.de>
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#ifndef FUOTENSYNTHETICDATA_H
+#define FUOTENSYNTHETICDATA_H
+
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QJsonObject>
+#include <QStringList>
+#include <random>
+
+/*!
+ * \brief Creates reproducible Nextcloud News API replies with synthetic content.
+ *
+ * The created JSON uses the same layout as the replies of the folders, feeds, items and
+ * updated items routes of the News App API. The same seed and the same settings will always
+ * create the same data. Items are distributed round robin over the feeds, the feeds round
+ * robin over the folders.
+ */
+class SyntheticData
+{
+public:
+    /*!
+     * \brief Distribution of the number of words in the item bodies.
+     */
+    enum BodyDistribution {
+        Fixed,      /**< Every body has SyntheticData::bodyWords words. */
+        Uniform,    /**< Uniformly distributed between a quarter and seven quarters of SyntheticData::bodyWords. */
+        LogNormal   /**< Log-normal distributed around SyntheticData::bodyWords, a few bodies are very long. */
+    };
+
+    explicit SyntheticData(quint32 seed = 4711);
+
+    int folderCount = 10;                       /**< Number of folders. */
+    int feedCount = 100;                        /**< Number of feeds. */
+    int bodyWords = 120;                        /**< Average number of words in an item body. */
+    BodyDistribution bodyDistribution = Fixed;  /**< Distribution of the body sizes. */
+    int unreadPercent = 70;                     /**< Percentage of unread items. */
+    int starredPercent = 5;                     /**< Percentage of starred items. */
+
+    /*!
+     * \brief Returns the reply of the folders route.
+     */
+    QJsonDocument folders();
+
+    /*!
+     * \brief Returns the reply of the feeds route.
+     */
+    QJsonDocument feeds();
+
+    /*!
+     * \brief Returns \a count item objects starting with ID \a firstId.
+     *
+     * Items created with a different \a revision but the same IDs have a different
+     * fingerprint, title and body, so they will update the stored items.
+     */
+    QJsonArray items(int count, qint64 firstId = 1, int revision = 0);
+
+    /*!
+     * \brief Returns the reply of the items route containing \a count items starting with ID \a firstId.
+     */
+    QJsonDocument itemsReply(int count, qint64 firstId = 1, int revision = 0);
+
+    /*!
+     * \brief Returns the reply of the updated items route for a server that has \a existingCount items.
+     *
+     * The reply contains \a changedCount randomly chosen existing items with a new \a revision and
+     * \a addedCount new items with IDs following the existing ones.
+     */
+    QJsonDocument updatedItemsReply(int existingCount, int changedCount, int addedCount, int revision = 1);
+
+private:
+    QJsonObject item(qint64 id, int revision);
+    QString words(int count);
+    int bodySize();
+    int percent();
+
+    std::mt19937 m_rng;
+    QStringList m_dictionary;
+};
+
+#endif // FUOTENSYNTHETICDATA_H